@@ -21,6 +21,7 @@
 
 #include <cmath>
 #include <functional>
+#include <iterator>
 #include <numeric>
 
 namespace aprn{
@@ -62,7 +63,7 @@ constexpr auto
 Sum(const T... values) { return (values + ... + 0); }
 
 /** Sum the terms of a sequence between two iterators. */
-template<class It>
+template<std::input_iterator It>
 constexpr auto
 Sum(const It first, const It last)
 {
@@ -76,7 +77,7 @@ constexpr auto
 Product(const T... values) { return (values * ... * 1); }
 
 /** Product the terms of a sequence between two iterators. */
-template<class It>
+template<std::input_iterator It>
 constexpr auto
 Product(const It first, const It last)
 {
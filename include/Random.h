@@ -32,6 +32,9 @@ class RandomBase
 protected:
   RandomBase() : Generator_(Device_()) {}
 
+  /** Copies share the distribution, but are independently seeded. */
+  RandomBase(const RandomBase&) : Generator_(Device_()) {}
+
 public:
   /** Subscript operator overload to generate a random number. */
   virtual T operator()() = 0;
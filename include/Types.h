@@ -111,6 +111,11 @@ template<typename T = Real> requires std::floating_point<T> constexpr T InfFloat
 template<typename T = Real> requires std::floating_point<T> constexpr T QuietNaN    (std::numeric_limits<T>::quiet_NaN());
 template<typename T = Real> requires std::floating_point<T> constexpr T SignalNaN   (std::numeric_limits<T>::signaling_NaN());
 
+/** Type in which sums of a given type are accumulated: single-precision sums are accumulated in double precision, which preserves their accuracy at
+    little cost, as the summands are still loaded and multiplied at single precision. Other types are accumulated as they are. */
+template<typename T>
+using AccumulationType = std::conditional_t<std::is_same_v<T, float>, double, T>;
+
 /** Check if a value is NaN. */
 template<typename T>
 constexpr bool
@@ -0,0 +1,155 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+
+#include <limits>
+#include <memory_resource>
+#include <new>
+
+namespace aprn {
+
+/** Alignment of cache lines, and of the widest (AVX-512) SIMD registers. */
+constexpr size_t CacheLineSize = 64;
+
+/***************************************************************************************************************************************************************
+* Aligned Allocator Class
+***************************************************************************************************************************************************************/
+
+/** Allocator whose allocations start on an alignment boundary (by default a cache line), so that they suit aligned SIMD loads/stores and are never
+    shared with unrelated data on the same cache line. */
+template<typename T, size_t alignment = CacheLineSize>
+class AlignedAllocator
+{
+  static_assert(alignment >= alignof(T) && (alignment & (alignment - 1)) == 0, "The alignment must be a power of two, and at least that of the type.");
+
+public:
+  using value_type = T;
+
+  template<typename T2>
+  struct rebind { using other = AlignedAllocator<T2, alignment>; };
+
+  constexpr AlignedAllocator() noexcept = default;
+
+  template<typename T2>
+  constexpr AlignedAllocator(const AlignedAllocator<T2, alignment>&) noexcept {}
+
+  [[nodiscard]] T*
+  allocate(const size_t n)
+  {
+    if(n > std::numeric_limits<size_t>::max() / sizeof(T)) throw std::bad_array_new_length();
+    return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignment)));
+  }
+
+  void
+  deallocate(T* ptr, const size_t n) noexcept { ::operator delete(ptr, n * sizeof(T), std::align_val_t(alignment)); }
+
+  template<typename T2>
+  constexpr bool operator==(const AlignedAllocator<T2, alignment>&) const noexcept { return true; }
+};
+
+/***************************************************************************************************************************************************************
+* Monotonic Arena Class
+***************************************************************************************************************************************************************/
+
+/** Memory resource which bump-allocates from a list of blocks, and only frees them in one go when released or destroyed. Every allocation is aligned to
+    at least a cache line. Suited to short-lived workspaces, which can be cheaply reused by releasing the arena between uses. Not thread-safe, so each
+    thread should use its own arena. */
+class MonotonicArena final : public std::pmr::memory_resource
+{
+public:
+  explicit MonotonicArena(const size_t initial_block_size = 1 << 16)
+    : InitialBlockSize_(Max(initial_block_size, CacheLineSize)), NextBlockSize_(InitialBlockSize_) {}
+
+  MonotonicArena(const MonotonicArena&) = delete;
+
+  MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+  ~MonotonicArena() override { Release(); }
+
+  /** Free all blocks, invalidating all previous allocations. */
+  void
+  Release() noexcept
+  {
+    while(Head_)
+    {
+      Block* next = Head_->Next;
+      ::operator delete(Head_, Head_->Size, std::align_val_t(CacheLineSize));
+      Head_ = next;
+    }
+    Current_ = End_ = nullptr;
+    NextBlockSize_ = InitialBlockSize_;
+  }
+
+  /** Total number of bytes held by the arena. */
+  size_t
+  Capacity() const noexcept
+  {
+    size_t capacity(0);
+    for(Block* block = Head_; block; block = block->Next) capacity += block->Size;
+    return capacity;
+  }
+
+private:
+  /** Block header, placed at the start of every block. */
+  struct alignas(CacheLineSize) Block
+  {
+    Block* Next;
+    size_t Size;
+  };
+
+  void*
+  do_allocate(const size_t bytes, const size_t alignment) override
+  {
+    const size_t align = Max(alignment, CacheLineSize);
+    auto address = (reinterpret_cast<uintptr_t>(Current_) + align - 1) & ~(align - 1);
+
+    if(!Current_ || address + bytes > reinterpret_cast<uintptr_t>(End_))
+    {
+      // Grow geometrically, so that the number of blocks is logarithmic in the total number of bytes allocated.
+      const size_t block_size = Max(NextBlockSize_, sizeof(Block) + bytes + align);
+      Head_ = ::new(::operator new(block_size, std::align_val_t(CacheLineSize))) Block{Head_, block_size};
+      Current_ = reinterpret_cast<std::byte*>(Head_) + sizeof(Block);
+      End_ = reinterpret_cast<std::byte*>(Head_) + block_size;
+      NextBlockSize_ = 2 * block_size;
+      address = (reinterpret_cast<uintptr_t>(Current_) + align - 1) & ~(align - 1);
+    }
+
+    Current_ = reinterpret_cast<std::byte*>(address + bytes);
+    return reinterpret_cast<void*>(address);
+  }
+
+  void
+  do_deallocate(void*, size_t, size_t) override {}
+
+  bool
+  do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+  size_t     InitialBlockSize_;
+  size_t     NextBlockSize_;
+  Block*     Head_{nullptr};
+  std::byte* Current_{nullptr};
+  std::byte* End_{nullptr};
+};
+
+/***************************************************************************************************************************************************************
+* Allocator Aliases
+***************************************************************************************************************************************************************/
+
+/** Allocator drawing from a std::pmr memory resource, e.g. a MonotonicArena. */
+template<typename T> using ArenaAllocator = std::pmr::polymorphic_allocator<T>;
+
+}
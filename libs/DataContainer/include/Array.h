@@ -15,6 +15,8 @@
 #pragma once
 
 #include "../../../include/Global.h"
+#include "Allocator.h"
+#include "Parallel.h"
 
 #include <array>
 #include <initializer_list>
@@ -90,32 +92,36 @@ class StaticArray : public std::array<T, N>,
 /***************************************************************************************************************************************************************
 * Dynamic Array Class
 ***************************************************************************************************************************************************************/
-template<typename T>
-class DynamicArray : public std::vector<T>,
-                     public Array<T, DynamicArray<T>>
+template<typename T, class A = std::allocator<T>>
+class DynamicArray : public std::vector<T, A>,
+                     public Array<T, DynamicArray<T, A>>
 {
-   using Base = Array<T, DynamicArray<T>>;
+   using Base = Array<T, DynamicArray<T, A>>;
 
  public:
+   using allocator_type = A;
+
    DynamicArray();
 
-   explicit DynamicArray(const size_t size);
+   explicit DynamicArray(const A& allocator);
+
+   explicit DynamicArray(const size_t size, const A& allocator = A());
 
-   DynamicArray(const size_t size, const std::convertible_to<T> auto& value);
+   DynamicArray(const size_t size, const std::convertible_to<T> auto& value, const A& allocator = A());
 
    template<std::convertible_to<T> T2>
-   DynamicArray(const std::initializer_list<T2>& list);
+   DynamicArray(const std::initializer_list<T2>& list, const A& allocator = A());
 
    template<class It>
-   DynamicArray(It first, It last);
+   DynamicArray(It first, It last, const A& allocator = A());
 
    void Append(const T& value);
 
    void Append(T&& value) noexcept;
 
-   void Append(const DynamicArray<T>& other);
+   void Append(const DynamicArray<T, A>& other);
 
-   void Append(DynamicArray<T>&& other) noexcept;
+   void Append(DynamicArray<T, A>&& other) noexcept;
 
    template<class It>
    void Append(It first, It last, const bool move_all = false);
@@ -153,6 +159,10 @@ using DArrayU = DArray<size_t>;
 using DArrayI = DArray<int>;
 using DArrayF = DArray<Real>;
 
+/** Dynamic arrays with cache-line aligned storage, and with storage drawn from a memory resource (e.g. a MonotonicArena). */
+template<typename T> using AlignedArray = DynamicArray<T, AlignedAllocator<T>>;
+template<typename T> using ArenaArray   = DynamicArray<T, ArenaAllocator<T>>;
+
 /***************************************************************************************************************************************************************
 * Static Array Conversion
 ***************************************************************************************************************************************************************/
@@ -60,7 +60,9 @@ template<typename T, class D>
 constexpr D&
 Array<T, D>::operator=(const std::convertible_to<T> auto value) noexcept
 {
-   FOR_EACH(entry, Derived()) entry = static_cast<T>(value);
+   if(!std::is_constant_evaluated() && parallel::isParallel(Derived().size()))
+      parallel::For(Derived().size(), [&](const size_t first, const size_t last) { FOR(i, first, last) Derived()[i] = static_cast<T>(value); });
+   else FOR_EACH(entry, Derived()) entry = static_cast<T>(value);
    return Derived();
 }
 
@@ -69,7 +71,7 @@ template<std::convertible_to<T> T2>
 constexpr D&
 Array<T, D>::operator=(const std::initializer_list<T2>& value_list) noexcept
 {
-   if constexpr(isTypeSame<D, DynamicArray<T>>()) Derived().resize(value_list.size());
+   if constexpr(requires(D& d) { d.resize(value_list.size()); }) Derived().resize(value_list.size());
    size_t index(0);
    FOR_EACH(entry, value_list) Derived()[index++] = entry;
    return Derived();
@@ -132,48 +134,52 @@ constexpr StaticArray<T, N>::StaticArray(It first, It last)
 /***************************************************************************************************************************************************************
 * Dynamic Array Class
 ***************************************************************************************************************************************************************/
-template<typename T>
-DynamicArray<T>::DynamicArray()
-   : std::vector<T>() {}
+template<typename T, class A>
+DynamicArray<T, A>::DynamicArray()
+   : std::vector<T, A>() {}
 
-template<typename T>
-DynamicArray<T>::DynamicArray(const size_t size)
-   : DynamicArray(size, DynamicInitValue<T>()) {}
+template<typename T, class A>
+DynamicArray<T, A>::DynamicArray(const A& allocator)
+   : std::vector<T, A>(allocator) {}
 
-template<typename T>
-DynamicArray<T>::DynamicArray(const size_t size, const std::convertible_to<T> auto& value)
-   : std::vector<T>(size, value) {}
+template<typename T, class A>
+DynamicArray<T, A>::DynamicArray(const size_t size, const A& allocator)
+   : DynamicArray(size, DynamicInitValue<T>(), allocator) {}
 
-template<typename T>
+template<typename T, class A>
+DynamicArray<T, A>::DynamicArray(const size_t size, const std::convertible_to<T> auto& value, const A& allocator)
+   : std::vector<T, A>(size, value, allocator) {}
+
+template<typename T, class A>
 template<std::convertible_to<T> T2>
-DynamicArray<T>::DynamicArray(const std::initializer_list<T2>& list)
-   : std::vector<T>(list) {}
+DynamicArray<T, A>::DynamicArray(const std::initializer_list<T2>& list, const A& allocator)
+   : std::vector<T, A>(list, allocator) {}
 
-template<typename T>
+template<typename T, class A>
 template<class It>
-DynamicArray<T>::DynamicArray(It first, It last)
-   : std::vector<T>(first, last) {}
+DynamicArray<T, A>::DynamicArray(It first, It last, const A& allocator)
+   : std::vector<T, A>(first, last, allocator) {}
 
-template<typename T>
+template<typename T, class A>
 void
-DynamicArray<T>::Append(const T& value) { this->push_back(value); }
+DynamicArray<T, A>::Append(const T& value) { this->push_back(value); }
 
-template<typename T>
+template<typename T, class A>
 void
-DynamicArray<T>::Append(T&& value) noexcept { this->push_back(std::move(value)); }
+DynamicArray<T, A>::Append(T&& value) noexcept { this->push_back(std::move(value)); }
 
-template<typename T>
+template<typename T, class A>
 void
-DynamicArray<T>::Append(const DynamicArray<T>& other) { Append(other.cbegin(), other.cend(), false); }
+DynamicArray<T, A>::Append(const DynamicArray<T, A>& other) { Append(other.cbegin(), other.cend(), false); }
 
-template<typename T>
+template<typename T, class A>
 void
-DynamicArray<T>::Append(DynamicArray<T>&& other) noexcept { Append(other.begin(), other.end(), true); }
+DynamicArray<T, A>::Append(DynamicArray<T, A>&& other) noexcept { Append(other.begin(), other.end(), true); }
 
-template<typename T>
+template<typename T, class A>
 template<class It>
 void
-DynamicArray<T>::Append(It first, It last, const bool move_all)
+DynamicArray<T, A>::Append(It first, It last, const bool move_all)
 {
    this->reserve(this->size() + std::distance(first, last));
 
@@ -181,9 +187,9 @@ DynamicArray<T>::Append(It first, It last, const bool move_all)
    else          this->insert(this->end(), std::make_move_iterator(first), std::make_move_iterator(last));
 }
 
-template<typename T>
+template<typename T, class A>
 void
-DynamicArray<T>::Erase()
+DynamicArray<T, A>::Erase()
 {
    this->clear();
    this->shrink_to_fit();
@@ -0,0 +1,297 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "MultiArrayView.h"
+
+#include <bit>
+
+/***************************************************************************************************************************************************************
+* Multi-dimensional Array Memory Layouts
+*
+* A layout policy maps the multi-indices of a multi-array with the given dimensions to storage indices, and back. Each policy provides:
+*
+*   Capacity(dims)                   - the number of stored entries, which may exceed the number of entries if the layout pads the dimensions.
+*   LinearIndex(dims, multi_index)   - the storage index of a multi-index (passed as a pointer to its components).
+*   MultiIndex(dims, index, result)  - the multi-index of a storage index, written into the indexable result.
+*   ForEach(dims, function)          - calls function(index, multi_index) for every entry, in increasing storage order.
+*
+* Strided layouts, for which the storage index is linear in the multi-index, also provide Strides(dims), and can hence be viewed by a MultiArrayView.
+***************************************************************************************************************************************************************/
+
+namespace aprn::layout {
+
+/***************************************************************************************************************************************************************
+* Strided Layouts
+***************************************************************************************************************************************************************/
+
+/** Layout in which the first index varies fastest, i.e. consecutive entries along the first dimension are adjacent in memory. */
+struct ColumnMajor
+{
+  static constexpr bool isStrided = true;
+
+  template<class Dims>
+  static constexpr size_t
+  Capacity(const Dims& dims) { return Product(dims.begin(), dims.end()); }
+
+  template<class Dims>
+  static constexpr size_t
+  LinearIndex(const Dims& dims, const size_t* multi_index)
+  {
+    size_t index(0);
+    for(size_t i = dims.size(); i-- > 0;) index = index * dims[i] + multi_index[i];
+    return index;
+  }
+
+  template<class Dims, class M>
+  static constexpr void
+  MultiIndex(const Dims& dims, size_t index, M& multi_index)
+  {
+    FOR(i, dims.size())
+    {
+      multi_index[i] = index % dims[i];
+      index /= dims[i];
+    }
+  }
+
+  template<class Dims, class F>
+  static constexpr void
+  ForEach(const Dims& dims, F&& function)
+  {
+    auto multi_index = dims;
+    std::fill(multi_index.begin(), multi_index.end(), 0);
+
+    const size_t n_entries = Capacity(dims);
+    FOR(index, n_entries)
+    {
+      function(index, std::as_const(multi_index));
+      for(size_t i = 0; i < dims.size() && ++multi_index[i] == dims[i]; ++i) multi_index[i] = 0;
+    }
+  }
+
+  template<class Dims>
+  static StrideArray
+  Strides(const Dims& dims)
+  {
+    StrideArray strides(dims.size());
+    std::ptrdiff_t stride(1);
+    FOR(i, dims.size())
+    {
+      strides[i] = stride;
+      stride *= static_cast<std::ptrdiff_t>(dims[i]);
+    }
+    return strides;
+  }
+};
+
+/** Layout in which the last index varies fastest, i.e. consecutive entries along the last dimension are adjacent in memory. */
+struct RowMajor
+{
+  static constexpr bool isStrided = true;
+
+  template<class Dims>
+  static constexpr size_t
+  Capacity(const Dims& dims) { return Product(dims.begin(), dims.end()); }
+
+  template<class Dims>
+  static constexpr size_t
+  LinearIndex(const Dims& dims, const size_t* multi_index)
+  {
+    size_t index(0);
+    FOR(i, dims.size()) index = index * dims[i] + multi_index[i];
+    return index;
+  }
+
+  template<class Dims, class M>
+  static constexpr void
+  MultiIndex(const Dims& dims, size_t index, M& multi_index)
+  {
+    for(size_t i = dims.size(); i-- > 0;)
+    {
+      multi_index[i] = index % dims[i];
+      index /= dims[i];
+    }
+  }
+
+  template<class Dims, class F>
+  static constexpr void
+  ForEach(const Dims& dims, F&& function)
+  {
+    auto multi_index = dims;
+    std::fill(multi_index.begin(), multi_index.end(), 0);
+
+    const size_t n_entries = Capacity(dims);
+    FOR(index, n_entries)
+    {
+      function(index, std::as_const(multi_index));
+      for(size_t i = dims.size(); i-- > 0 && ++multi_index[i] == dims[i];) multi_index[i] = 0;
+    }
+  }
+
+  template<class Dims>
+  static StrideArray
+  Strides(const Dims& dims)
+  {
+    StrideArray strides(dims.size());
+    std::ptrdiff_t stride(1);
+    for(size_t i = dims.size(); i-- > 0;)
+    {
+      strides[i] = stride;
+      stride *= static_cast<std::ptrdiff_t>(dims[i]);
+    }
+    return strides;
+  }
+};
+
+/***************************************************************************************************************************************************************
+* Tiled Layout
+***************************************************************************************************************************************************************/
+
+/** Layout for 1D-3D arrays which stores the entries in square/cubic tiles of the given size, ordered along a Z-order (Morton) curve within each tile, with
+    the tiles themselves in column-major order. Entries that are close in every dimension are hence close in memory, so that neighbourhood (e.g. stencil)
+    access stays within a few cache lines. The dimensions are padded up to multiples of the tile size. */
+template<size_t tile_size = 8>
+struct Tiled
+{
+  static_assert(std::has_single_bit(tile_size) && 1 < tile_size && tile_size <= 1024, "The tile size must be a power of two in the range [2, 1024].");
+
+  static constexpr bool   isStrided = false;
+  static constexpr size_t TileBits  = std::countr_zero(tile_size);
+
+  template<class Dims>
+  static constexpr size_t
+  TileCount(const Dims& dims, const size_t i) { return (dims[i] + tile_size - 1) >> TileBits; }
+
+  template<class Dims>
+  static constexpr size_t
+  TileVolume(const Dims& dims)
+  {
+    ASSERT(0 < dims.size() && dims.size() <= 3, "Tiled layouts are only supported for 1D, 2D, and 3D arrays.")
+    return size_t(1) << (TileBits * dims.size());
+  }
+
+  template<class Dims>
+  static constexpr size_t
+  Capacity(const Dims& dims)
+  {
+    size_t n_tiles(1);
+    FOR(i, dims.size()) n_tiles *= TileCount(dims, i);
+    return n_tiles * TileVolume(dims);
+  }
+
+  template<class Dims>
+  static constexpr size_t
+  LinearIndex(const Dims& dims, const size_t* multi_index)
+  {
+    size_t tile(0), code(0);
+    for(size_t i = dims.size(); i-- > 0;)
+    {
+      tile = tile * TileCount(dims, i) + (multi_index[i] >> TileBits);
+      code |= Spread(multi_index[i] & (tile_size - 1), dims.size()) << i;
+    }
+    return tile * TileVolume(dims) + code;
+  }
+
+  template<class Dims, class M>
+  static constexpr void
+  MultiIndex(const Dims& dims, size_t index, M& multi_index)
+  {
+    const size_t code = index & (TileVolume(dims) - 1);
+    size_t tile = index >> (TileBits * dims.size());
+    FOR(i, dims.size())
+    {
+      multi_index[i] = ((tile % TileCount(dims, i)) << TileBits) | Compact(code >> i, dims.size());
+      tile /= TileCount(dims, i);
+    }
+  }
+
+  /** Walks the tiles in storage order, skipping the padding entries beyond the dimensions. */
+  template<class Dims, class F>
+  static constexpr void
+  ForEach(const Dims& dims, F&& function)
+  {
+    auto origin = dims;
+    auto multi_index = dims;
+    std::fill(origin.begin(), origin.end(), 0);
+
+    const size_t tile_volume = TileVolume(dims);
+    const size_t n_tiles = Capacity(dims) / tile_volume;
+    size_t index(0);
+    FOR(tile, n_tiles)
+    {
+      FOR(code, tile_volume)
+      {
+        bool is_padding(false);
+        FOR(i, dims.size())
+        {
+          multi_index[i] = origin[i] + Compact(code >> i, dims.size());
+          is_padding |= multi_index[i] >= dims[i];
+        }
+        if(!is_padding) function(index, std::as_const(multi_index));
+        ++index;
+      }
+      for(size_t i = 0; i < dims.size() && (origin[i] += tile_size) >= TileCount(dims, i) * tile_size; ++i) origin[i] = 0;
+    }
+  }
+
+private:
+  /** Spread the bits of a tile-local index apart, leaving rank - 1 zero bits between consecutive bits. */
+  static constexpr size_t
+  Spread(size_t bits, const size_t rank)
+  {
+    if(rank == 2)
+    {
+      bits = (bits | (bits << 8)) & 0x00FF00FF;
+      bits = (bits | (bits << 4)) & 0x0F0F0F0F;
+      bits = (bits | (bits << 2)) & 0x33333333;
+      bits = (bits | (bits << 1)) & 0x55555555;
+    }
+    else if(rank == 3)
+    {
+      bits = (bits | (bits << 16)) & 0x030000FF;
+      bits = (bits | (bits <<  8)) & 0x0300F00F;
+      bits = (bits | (bits <<  4)) & 0x030C30C3;
+      bits = (bits | (bits <<  2)) & 0x09249249;
+    }
+    return bits;
+  }
+
+  /** Inverse of Spread, gathering every rank-th bit. */
+  static constexpr size_t
+  Compact(size_t bits, const size_t rank)
+  {
+    if(rank == 2)
+    {
+      bits &= 0x55555555;
+      bits = (bits | (bits >> 1)) & 0x33333333;
+      bits = (bits | (bits >> 2)) & 0x0F0F0F0F;
+      bits = (bits | (bits >> 4)) & 0x00FF00FF;
+      bits = (bits | (bits >> 8)) & 0x0000FFFF;
+    }
+    else if(rank == 3)
+    {
+      bits &= 0x09249249;
+      bits = (bits | (bits >>  2)) & 0x030C30C3;
+      bits = (bits | (bits >>  4)) & 0x0300F00F;
+      bits = (bits | (bits >>  8)) & 0x030000FF;
+      bits = (bits | (bits >> 16)) & 0x000003FF;
+    }
+    else bits &= tile_size - 1;
+    return bits;
+  }
+};
+
+}
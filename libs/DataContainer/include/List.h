@@ -14,62 +14,245 @@
 
 #pragma once
 
-#include "../include/Global.h"
+#include "../../../include/Global.h"
 
-#include <list>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace aprn {
 
-template<typename T>
-class List : public std::list<T>
+template<typename T, size_t chunk_size> class List;
+
+/***************************************************************************************************************************************************************
+* List Iterator
+***************************************************************************************************************************************************************/
+
+/** Random-access iterator over a list, which addresses an entry by its chunk and its position within the chunk. */
+template<typename T, size_t chunk_size, bool is_const>
+class ListIterator
 {
+  using ListType = std::conditional_t<is_const, const List<T, chunk_size>, List<T, chunk_size>>;
+
 public:
-  List() = default;
-  ~List() = default;
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type        = T;
+  using difference_type   = std::ptrdiff_t;
+  using pointer           = std::conditional_t<is_const, const T*, T*>;
+  using reference         = std::conditional_t<is_const, const T&, T&>;
 
-  /** Size and Index Range-checking ***************************************************************************************************************************/
-  void IndexBoundCheck(const size_t index) const
+  ListIterator() = default;
+
+  ListIterator(ListType* list, const size_t chunk, const size_t position)
+    : List_(list), Chunk_(chunk), Position_(position) {}
+
+  /** Conversion of a mutable iterator to a const iterator. */
+  operator ListIterator<T, chunk_size, true>() const requires (!is_const) { return {List_, Chunk_, Position_}; }
+
+  reference operator*() const { return *List_->Chunks_[Chunk_][Position_]; }
+
+  pointer operator->() const { return List_->Chunks_[Chunk_][Position_]; }
+
+  reference operator[](const difference_type n) const { return *(*this + n); }
+
+  ListIterator& operator++()
   {
-    DEBUG_ASSERT(this->size(), "The list has not yet been sized.")
-    DEBUG_ASSERT(isBounded(index, size_t(0), this->size()), "The list index ", index, " must be in the range [0, ", this->size() - 1, "].")
+    if(++Position_ == List_->Chunks_[Chunk_].size()) { ++Chunk_; Position_ = 0; }
+    return *this;
   }
 
-  void SizeCheck(const size_t _size0, const size_t _size1) const
+  ListIterator& operator--()
   {
-    DEBUG_ASSERT(areSizesEqual(_size0, _size1), "The list sizes ", _size0, " and ", _size1, " must be equal.")
+    if(Position_-- == 0) Position_ = List_->Chunks_[--Chunk_].size() - 1;
+    return *this;
   }
 
-  /** Subscript Operator Overloads ****************************************************************************************************************************/
-  T& operator[](const size_t index)
+  ListIterator operator++(int) { auto it = *this; ++*this; return it; }
+
+  ListIterator operator--(int) { auto it = *this; --*this; return it; }
+
+  ListIterator& operator+=(const difference_type n)
   {
-    IndexBoundCheck(index);
-    auto iterator = this->begin();
-    FOR(i, index) ++iterator;
-    return *iterator;
+    std::tie(Chunk_, Position_) = List_->Locate(static_cast<size_t>(static_cast<difference_type>(Index()) + n));
+    return *this;
   }
 
-  const T& operator[](const size_t index) const
+  ListIterator& operator-=(const difference_type n) { return *this += -n; }
+
+  ListIterator operator+(const difference_type n) const { auto it = *this; return it += n; }
+
+  ListIterator operator-(const difference_type n) const { auto it = *this; return it -= n; }
+
+  difference_type operator-(const ListIterator& other) const
+  { return static_cast<difference_type>(Index()) - static_cast<difference_type>(other.Index()); }
+
+  bool operator==(const ListIterator& other) const { return Chunk_ == other.Chunk_ && Position_ == other.Position_; }
+
+  auto operator<=>(const ListIterator& other) const { return std::tie(Chunk_, Position_) <=> std::tie(other.Chunk_, other.Position_); }
+
+  friend ListIterator operator+(const difference_type n, const ListIterator& it) { return it + n; }
+
+  /** Index of the addressed entry in the list. */
+  size_t Index() const { return Chunk_ < List_->Offsets_.size() ? List_->Offsets_[Chunk_] + Position_ : List_->size(); }
+
+private:
+  ListType* List_{nullptr};
+  size_t    Chunk_{0};
+  size_t    Position_{0};
+
+  friend List<T, chunk_size>;
+};
+
+/***************************************************************************************************************************************************************
+* List Class
+***************************************************************************************************************************************************************/
+
+/** Sequence container supporting both insertion/removal anywhere and indexed access, implemented as a tiered vector. The list order is kept as a vector of
+    chunks of (at most chunk_size) entry pointers, so that an entry is located by a binary search over the chunk offsets, and an insertion/removal only
+    shifts the pointers of a single chunk and the offsets of the chunks after it. The entries themselves are allocated from a pool and never move, hence
+    pointers and references to entries remain valid until the entry is erased, whereas iterators are invalidated by any insertion or removal.
+
+    Complexities, for n entries: indexing O(log(n / chunk_size)), insertion/removal O(chunk_size + n / chunk_size), iteration O(1) per entry. */
+template<typename T, size_t chunk_size = 256>
+class List
+{
+  static_assert(chunk_size > 1, "The chunk size of a list must be at least 2.");
+
+public:
+  using value_type      = T;
+  using size_type       = size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference       = T&;
+  using const_reference = const T&;
+  using iterator        = ListIterator<T, chunk_size, false>;
+  using const_iterator  = ListIterator<T, chunk_size, true>;
+
+  /** Constructors/Destructor */
+  List() = default;
+
+  List(const std::initializer_list<T>& list);
+
+  template<std::input_iterator It>
+  List(It first, It last);
+
+  List(const List& other);
+
+  List(List&& other) noexcept;
+
+  ~List() { clear(); }
+
+  /** Copy/Move Assignment */
+  List& operator=(const List& other);
+
+  List& operator=(List&& other) noexcept;
+
+  /** Size and Index Range-checking */
+  size_t size() const noexcept { return Size_; }
+
+  bool empty() const noexcept { return Size_ == 0; }
+
+  void IndexBoundCheck(const size_t index) const
   {
-    IndexBoundCheck(index);
-    auto iterator = this->begin();
-    FOR(i, index) ++iterator;
-    return *iterator;
+    DEBUG_ASSERT(Size_, "The list has not yet been sized.")
+    DEBUG_ASSERT(isBounded(index, size_t(0), Size_), "The list index ", index, " must be in the range [0, ", Size_ - 1, "].")
   }
 
-  /** Assignment Operator Overloads ***************************************************************************************************************************/
-  List& operator=(const T& value) noexcept
+  void SizeCheck(const size_t _size0, const size_t _size1) const
   {
-    FOR_EACH(entry, *this) entry = value;
-    return *this;
+    DEBUG_ASSERT(areSizesEqual(_size0, _size1), "The list sizes ", _size0, " and ", _size1, " must be equal.")
   }
 
-  List& operator=(const std::initializer_list<T>& value_list)
+  /** Subscript Operator Overloads */
+  T& operator[](const size_t index);
+
+  const T& operator[](const size_t index) const;
+
+  T& front() { return (*this)[0]; }
+
+  const T& front() const { return (*this)[0]; }
+
+  T& back() { return *Chunks_.back().back(); }
+
+  const T& back() const { return *Chunks_.back().back(); }
+
+  /** Assignment Operator Overloads */
+  List& operator=(const T& value) noexcept;
+
+  List& operator=(const std::initializer_list<T>& value_list);
+
+  /** Iterators */
+  iterator begin() noexcept { return {this, 0, 0}; }
+
+  const_iterator begin() const noexcept { return {this, 0, 0}; }
+
+  const_iterator cbegin() const noexcept { return begin(); }
+
+  iterator end() noexcept { return {this, Chunks_.size(), 0}; }
+
+  const_iterator end() const noexcept { return {this, Chunks_.size(), 0}; }
+
+  const_iterator cend() const noexcept { return end(); }
+
+  /** Modifiers */
+  template<class... Args>
+  iterator emplace(const_iterator position, Args&&... args);
+
+  iterator insert(const_iterator position, const T& value) { return emplace(position, value); }
+
+  iterator insert(const_iterator position, T&& value) { return emplace(position, std::move(value)); }
+
+  template<class... Args>
+  T& emplace_back(Args&&... args) { return *emplace(end(), std::forward<Args>(args)...); }
+
+  template<class... Args>
+  T& emplace_front(Args&&... args) { return *emplace(begin(), std::forward<Args>(args)...); }
+
+  void push_back(const T& value) { emplace_back(value); }
+
+  void push_back(T&& value) { emplace_back(std::move(value)); }
+
+  void push_front(const T& value) { emplace_front(value); }
+
+  void push_front(T&& value) { emplace_front(std::move(value)); }
+
+  iterator erase(const_iterator position);
+
+  void pop_back() { erase(end() - 1); }
+
+  void pop_front() { erase(begin()); }
+
+  void clear() noexcept;
+
+private:
+  /** Pool slot, which either holds an entry or links to the next free slot. */
+  union Slot
   {
-    SizeCheck(value_list.size(), this->size());
-    size_t index(0);
-    FOR_EACH(entry, value_list) (*this)[index++] = entry;
-    return *this;
-  }
+    Slot* Next;
+    alignas(T) std::byte Storage[sizeof(T)];
+  };
+
+  /** Chunk and position of the entry at the given index (the end position if index equals the size). */
+  std::pair<size_t, size_t> Locate(const size_t index) const;
+
+  template<class... Args>
+  T* Allocate(Args&&... args);
+
+  void Deallocate(T* entry) noexcept;
+
+  /** Shift the offsets of all chunks after the given one. */
+  void ShiftOffsets(const size_t chunk, const std::ptrdiff_t shift);
+
+  std::vector<std::vector<T*>>         Chunks_;
+  std::vector<size_t>                  Offsets_;
+  std::vector<std::unique_ptr<Slot[]>> Blocks_;
+  Slot*                                FreeSlots_{nullptr};
+  size_t                               nBlockSlots_{chunk_size};
+  size_t                               Size_{0};
+
+  friend iterator;
+  friend const_iterator;
 };
 
 }
+
+#include "List.tpp"
@@ -0,0 +1,253 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* List Class
+***************************************************************************************************************************************************************/
+
+/** Constructors */
+template<typename T, size_t chunk_size>
+List<T, chunk_size>::List(const std::initializer_list<T>& list)
+  : List(list.begin(), list.end()) {}
+
+template<typename T, size_t chunk_size>
+template<std::input_iterator It>
+List<T, chunk_size>::List(It first, It last) { for(; first != last; ++first) emplace_back(*first); }
+
+template<typename T, size_t chunk_size>
+List<T, chunk_size>::List(const List& other)
+  : List(other.begin(), other.end()) {}
+
+template<typename T, size_t chunk_size>
+List<T, chunk_size>::List(List&& other) noexcept
+  : Chunks_(std::move(other.Chunks_)), Offsets_(std::move(other.Offsets_)), Blocks_(std::move(other.Blocks_)),
+    FreeSlots_(std::exchange(other.FreeSlots_, nullptr)), nBlockSlots_(std::exchange(other.nBlockSlots_, chunk_size)), Size_(std::exchange(other.Size_, 0))
+{
+  other.Chunks_.clear();
+  other.Offsets_.clear();
+}
+
+/** Copy/Move Assignment */
+template<typename T, size_t chunk_size>
+List<T, chunk_size>&
+List<T, chunk_size>::operator=(const List& other)
+{
+  if(this != &other)
+  {
+    clear();
+    FOR_EACH_CONST(entry, other) emplace_back(entry);
+  }
+  return *this;
+}
+
+template<typename T, size_t chunk_size>
+List<T, chunk_size>&
+List<T, chunk_size>::operator=(List&& other) noexcept
+{
+  if(this != &other)
+  {
+    clear();
+    Chunks_      = std::move(other.Chunks_);
+    Offsets_     = std::move(other.Offsets_);
+    Blocks_      = std::move(other.Blocks_);
+    FreeSlots_   = std::exchange(other.FreeSlots_, nullptr);
+    nBlockSlots_ = std::exchange(other.nBlockSlots_, chunk_size);
+    Size_        = std::exchange(other.Size_, 0);
+    other.Chunks_.clear();
+    other.Offsets_.clear();
+  }
+  return *this;
+}
+
+/** Subscript Operator Overloads */
+template<typename T, size_t chunk_size>
+T&
+List<T, chunk_size>::operator[](const size_t index)
+{
+  IndexBoundCheck(index);
+  const auto [chunk, position] = Locate(index);
+  return *Chunks_[chunk][position];
+}
+
+template<typename T, size_t chunk_size>
+const T&
+List<T, chunk_size>::operator[](const size_t index) const
+{
+  IndexBoundCheck(index);
+  const auto [chunk, position] = Locate(index);
+  return *Chunks_[chunk][position];
+}
+
+/** Assignment Operator Overloads */
+template<typename T, size_t chunk_size>
+List<T, chunk_size>&
+List<T, chunk_size>::operator=(const T& value) noexcept
+{
+  FOR_EACH(entry, *this) entry = value;
+  return *this;
+}
+
+template<typename T, size_t chunk_size>
+List<T, chunk_size>&
+List<T, chunk_size>::operator=(const std::initializer_list<T>& value_list)
+{
+  SizeCheck(value_list.size(), Size_);
+  std::copy(value_list.begin(), value_list.end(), begin());
+  return *this;
+}
+
+/** Modifiers */
+template<typename T, size_t chunk_size>
+template<class... Args>
+typename List<T, chunk_size>::iterator
+List<T, chunk_size>::emplace(const_iterator position, Args&&... args)
+{
+  T* entry = Allocate(std::forward<Args>(args)...);
+  size_t chunk = position.Chunk_, index = position.Position_;
+
+  if(chunk == Chunks_.size())
+  {
+    // Append to the last chunk, or start a new one if it is full.
+    if(Chunks_.empty() || Chunks_.back().size() == chunk_size)
+    {
+      Chunks_.emplace_back().reserve(chunk_size);
+      Offsets_.push_back(Size_);
+    }
+    chunk = Chunks_.size() - 1;
+    index = Chunks_[chunk].size();
+  }
+  else if(Chunks_[chunk].size() == chunk_size)
+  {
+    // Split a full chunk in half, and insert into the half containing the position.
+    constexpr size_t half_size = chunk_size / 2;
+    std::vector<T*> second_half;
+    second_half.reserve(chunk_size);
+    second_half.assign(Chunks_[chunk].begin() + half_size, Chunks_[chunk].end());
+    Chunks_[chunk].resize(half_size);
+    Chunks_.insert(Chunks_.begin() + chunk + 1, std::move(second_half));
+    Offsets_.insert(Offsets_.begin() + chunk + 1, Offsets_[chunk] + half_size);
+    if(index > half_size) { ++chunk; index -= half_size; }
+  }
+
+  Chunks_[chunk].insert(Chunks_[chunk].begin() + index, entry);
+  ShiftOffsets(chunk, 1);
+  ++Size_;
+  return {this, chunk, index};
+}
+
+template<typename T, size_t chunk_size>
+typename List<T, chunk_size>::iterator
+List<T, chunk_size>::erase(const_iterator position)
+{
+  DEBUG_ASSERT(position.Chunk_ < Chunks_.size(), "Cannot erase the end of a list.")
+
+  size_t chunk = position.Chunk_, index = position.Position_;
+  Deallocate(Chunks_[chunk][index]);
+  Chunks_[chunk].erase(Chunks_[chunk].begin() + index);
+  ShiftOffsets(chunk, -1);
+  --Size_;
+
+  // Merge sparse neighbouring chunks, so that the number of chunks stays proportional to the size.
+  if(chunk > 0 && Chunks_[chunk - 1].size() + Chunks_[chunk].size() <= chunk_size / 2)
+  {
+    index += Chunks_[chunk - 1].size();
+    --chunk;
+  }
+  if(chunk + 1 < Chunks_.size() && Chunks_[chunk].size() + Chunks_[chunk + 1].size() <= chunk_size / 2)
+  {
+    Chunks_[chunk].insert(Chunks_[chunk].end(), Chunks_[chunk + 1].begin(), Chunks_[chunk + 1].end());
+    Chunks_.erase(Chunks_.begin() + chunk + 1);
+    Offsets_.erase(Offsets_.begin() + chunk + 1);
+  }
+  if(Chunks_[chunk].empty())
+  {
+    Chunks_.erase(Chunks_.begin() + chunk);
+    Offsets_.erase(Offsets_.begin() + chunk);
+  }
+  else if(index == Chunks_[chunk].size()) { ++chunk; index = 0; }
+
+  return {this, chunk, index};
+}
+
+template<typename T, size_t chunk_size>
+void
+List<T, chunk_size>::clear() noexcept
+{
+  FOR_EACH(entries, Chunks_) FOR_EACH(entry, entries) std::destroy_at(entry);
+  Chunks_.clear();
+  Offsets_.clear();
+  Blocks_.clear();
+  FreeSlots_ = nullptr;
+  nBlockSlots_ = chunk_size;
+  Size_ = 0;
+}
+
+/** Private Helpers */
+template<typename T, size_t chunk_size>
+std::pair<size_t, size_t>
+List<T, chunk_size>::Locate(const size_t index) const
+{
+  DEBUG_ASSERT(index <= Size_, "The list index ", index, " must not exceed the list size ", Size_, ".")
+  if(index == Size_) return {Chunks_.size(), 0};
+
+  const size_t chunk = std::upper_bound(Offsets_.begin(), Offsets_.end(), index) - Offsets_.begin() - 1;
+  return {chunk, index - Offsets_[chunk]};
+}
+
+/** Construct an entry in a free slot, taking a new block of slots if none are left. */
+template<typename T, size_t chunk_size>
+template<class... Args>
+T*
+List<T, chunk_size>::Allocate(Args&&... args)
+{
+  Slot* slot;
+  if(FreeSlots_)
+  {
+    slot = FreeSlots_;
+    FreeSlots_ = slot->Next;
+  }
+  else
+  {
+    if(nBlockSlots_ == chunk_size)
+    {
+      Blocks_.push_back(std::make_unique<Slot[]>(chunk_size));
+      nBlockSlots_ = 0;
+    }
+    slot = &Blocks_.back()[nBlockSlots_++];
+  }
+  return std::construct_at(reinterpret_cast<T*>(slot->Storage), std::forward<Args>(args)...);
+}
+
+template<typename T, size_t chunk_size>
+void
+List<T, chunk_size>::Deallocate(T* entry) noexcept
+{
+  std::destroy_at(entry);
+  Slot* slot = reinterpret_cast<Slot*>(entry);
+  slot->Next = FreeSlots_;
+  FreeSlots_ = slot;
+}
+
+template<typename T, size_t chunk_size>
+void
+List<T, chunk_size>::ShiftOffsets(const size_t chunk, const std::ptrdiff_t shift)
+{
+  FOR(i, chunk + 1, Offsets_.size()) Offsets_[i] = static_cast<size_t>(static_cast<std::ptrdiff_t>(Offsets_[i]) + shift);
+}
+
+}
@@ -16,12 +16,17 @@
 
 #include "../../../include/Global.h"
 #include "Array.h"
+#include "Layout.h"
+#include "MultiArrayView.h"
 
 namespace aprn{
 
 /***************************************************************************************************************************************************************
 * Multi-dimensional Array Abstract Base Class
 ***************************************************************************************************************************************************************/
+
+/** Multi-dimensional array whose entries are arranged in memory by the derived class's layout policy (see Layout.h). Multi-indices are always given in
+    the same (dimension) order; only the mapping to storage changes with the layout. */
 template<typename T, class D>
 class MultiArray
 {
@@ -33,13 +38,28 @@ public:
   constexpr void
   MultiIndexBoundCheck(const std::convertible_to<size_t> auto... multi_index) const;
 
-  /** Multi-dimensional subscript index toggling. */
+  /** Multi-dimensional subscript index toggling. Linear indices are storage indices, as determined by the layout. */
   constexpr size_t
   ComputeLinearIndex(const std::convertible_to<size_t> auto... multi_index) const;
 
   constexpr auto
   ComputeMultiIndex(size_t index) const;
 
+  /** Number of dimensions, and the size of a given dimension. */
+  constexpr size_t
+  Rank() const { return Derived().Dimensions.size(); }
+
+  constexpr size_t
+  Dimension(const size_t dimension) const
+  {
+    DEBUG_ASSERT(dimension < Rank(), "The dimension ", dimension, " must be lesser than the rank ", Rank(), ".")
+    return Derived().Dimensions[dimension];
+  }
+
+  /** Number of entries between consecutive indices of each dimension, for strided layouts. */
+  StrideArray
+  Strides() const requires D::layout_type::isStrided;
+
   /** Operator overloads. */
   constexpr T&
   operator()(std::convertible_to<size_t> auto... multi_index);
@@ -53,7 +73,43 @@ public:
   constexpr D&
   operator=(const std::initializer_list<std::initializer_list<T>>& _value_matrix) noexcept;
 
-  /** Iterators */
+  /** Non-owning views of all entries, a slice at a fixed index of one dimension, or a sub-block, for strided layouts. */
+  MultiArrayView<T>
+  View() requires D::layout_type::isStrided;
+
+  MultiArrayView<const T>
+  View() const requires D::layout_type::isStrided;
+
+  MultiArrayView<T>
+  Slice(const size_t dimension, const size_t index) requires D::layout_type::isStrided { return View().Slice(dimension, index); }
+
+  MultiArrayView<const T>
+  Slice(const size_t dimension, const size_t index) const requires D::layout_type::isStrided { return View().Slice(dimension, index); }
+
+  MultiArrayView<T>
+  Block(const MultiIndex& first, const MultiIndex& extents) requires D::layout_type::isStrided { return View().Block(first, extents); }
+
+  MultiArrayView<const T>
+  Block(const MultiIndex& first, const MultiIndex& extents) const requires D::layout_type::isStrided { return View().Block(first, extents); }
+
+  /** Layout-aware iteration, calling function(entry, multi_index) for every entry in storage order, so that memory is always walked contiguously
+      (skipping any padding of the layout). Prefer this over nested loops of subscripts, whose traversal order may not match the layout. */
+  template<class F>
+  constexpr void
+  ForEach(F&& function);
+
+  template<class F>
+  constexpr void
+  ForEach(F&& function) const;
+
+  /** Stored entries, in storage order (including any padding of the layout). */
+  constexpr T*
+  data() { return Derived().Entries.data(); }
+
+  constexpr const T*
+  data() const { return Derived().Entries.data(); }
+
+  /** Iterators over the stored entries, in storage order (including any padding of the layout). */
   constexpr auto
   begin() { return Derived().Entries.begin(); }
 
@@ -78,44 +134,59 @@ private:
 /***************************************************************************************************************************************************************
 * Static Multi-dimensional Array Class
 ***************************************************************************************************************************************************************/
-template<typename T, size_t ...dims>
-class StaticMultiArray : public MultiArray<T, StaticMultiArray<T, dims...>>
+template<typename T, class L, size_t ...dims>
+class StaticLayoutMultiArray : public MultiArray<T, StaticLayoutMultiArray<T, L, dims...>>
 {
 public:
+  using layout_type = L;
+
   /** Constructors. */
-  constexpr StaticMultiArray();
+  constexpr StaticLayoutMultiArray();
 
-  explicit constexpr StaticMultiArray(const T value);
+  explicit constexpr StaticLayoutMultiArray(const T value);
 
 private:
   constexpr static StaticArray<size_t, sizeof...(dims)> Dimensions{dims...};
   constexpr static size_t nEntries{Product(dims...)};
-  StaticArray<T, nEntries> Entries;
+  StaticArray<T, L::Capacity(Dimensions)> Entries;
 
-  friend MultiArray<T, StaticMultiArray<T, dims...>>;
+  friend MultiArray<T, StaticLayoutMultiArray<T, L, dims...>>;
 };
 
+template<typename T, size_t ...dims>
+using StaticMultiArray = StaticLayoutMultiArray<T, layout::ColumnMajor, dims...>;
+
 /***************************************************************************************************************************************************************
 * Dynamic Multi-dimensional Array Class
 ***************************************************************************************************************************************************************/
-template<typename T>
-class DynamicMultiArray : public MultiArray<T, DynamicMultiArray<T>>
+template<typename T, class L = layout::ColumnMajor, class A = std::allocator<T>>
+class DynamicMultiArray : public MultiArray<T, DynamicMultiArray<T, L, A>>
 {
 public:
+  using layout_type = L;
+
   /** Constructors. */
   DynamicMultiArray();
 
   DynamicMultiArray(const std::convertible_to<size_t> auto... _dimensions);
 
+  /** Construction of an empty multi-array whose entries are allocated with the given allocator once it is resized. */
+  explicit DynamicMultiArray(const A& allocator);
+
+  /** Construction from a run-time list of dimensions, which may be empty for a rank-0 (scalar) multi-array. */
+  explicit DynamicMultiArray(const MultiIndex& _dimensions);
+
   /** Multi-array resize. */
   void Resize(const std::convertible_to<size_t> auto... _dimensions);
 
+  void Resize(const MultiIndex& _dimensions);
+
 private:
   DynamicArray<size_t> Dimensions;
   size_t nEntries;
-  DynamicArray<T> Entries;
+  DynamicArray<T, A> Entries;
 
-  friend MultiArray<T, DynamicMultiArray<T>>;
+  friend MultiArray<T, DynamicMultiArray<T, L, A>>;
 };
 
 }
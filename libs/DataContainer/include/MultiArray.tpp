@@ -31,7 +31,7 @@ MultiArray<T, D>::MultiIndexBoundCheck(const std::convertible_to<size_t> auto...
   ASSERT(sizeof...(multi_index) == Derived().Dimensions.size(), "Multi-index size mismatch.")
 
   auto& dims = Derived().Dimensions;
-  const size_t indices[] = {static_cast<size_t>(multi_index)...};
+  const std::array<size_t, sizeof...(multi_index)> indices{static_cast<size_t>(multi_index)...};
   FOR(i, dims.size()) ASSERT(indices[i] < dims[i], "Multi index component ", indices[i], " must be lesser than ", dims[i], ".")
 #endif
 }
@@ -43,44 +43,27 @@ MultiArray<T, D>::ComputeLinearIndex(const std::convertible_to<size_t> auto... m
 {
   MultiIndexBoundCheck(multi_index...);
 
-  auto& dims = Derived().Dimensions;
-  const size_t indices[] = {static_cast<size_t>(multi_index)...};
-
-  size_t index(0), factor(1);
-  FOR(i, dims.size())
-  {
-    index += factor * indices[i];
-    factor *= dims[i];
-  }
-//  this->IndexBoundCheck(index);
-
-  return index;
+  // Rank-0 multi-arrays are indexed by an empty multi-index.
+  const std::array<size_t, sizeof...(multi_index)> indices{static_cast<size_t>(multi_index)...};
+  return D::layout_type::LinearIndex(Derived().Dimensions, indices.data());
 }
 
 template<typename T, class D>
 constexpr auto
 MultiArray<T, D>::ComputeMultiIndex(size_t index) const
 {
-  EXIT("Yet to complete.")
-
-//  constexpr auto& dims = Derived().Dimensions;
-//  constexpr auto& n_entries = Derived().nEntries;
-//
-//  DEBUG_ASSERT(isBounded(index, 0, n_entries), "The passed index ", index, " should be in the range [0, ", n_entries, "].")
-//
-//  StaticArray<size_t, dims.size()> res;
-
-//  size_t factor = Multiply(dims...);
-//  for (size_t i = sizeof...(dims); i != 0; --i) {
-//    factor /= dims[i - 1];
-//    res[i - 1] = index / factor;
-//    assert(res[i - 1] < dims[i - 1]);
-//    index -= res[i - 1] * factor;
-//  }
-//  return res;
-  return 0;
+  const auto& dims = Derived().Dimensions;
+  DEBUG_ASSERT(index < Derived().Entries.size(), "The index ", index, " must be lesser than the number of stored entries ", Derived().Entries.size(), ".")
+
+  auto multi_index = dims;
+  D::layout_type::MultiIndex(dims, index, multi_index);
+  return multi_index;
 }
 
+template<typename T, class D>
+StrideArray
+MultiArray<T, D>::Strides() const requires D::layout_type::isStrided { return D::layout_type::Strides(Derived().Dimensions); }
+
 /** Operator overloads. */
 template<typename T, class D>
 constexpr T&
@@ -96,32 +79,73 @@ MultiArray<T, D>::operator()(const std::convertible_to<size_t> auto... multi_ind
   return Derived().Entries[ComputeLinearIndex(multi_index...)];
 }
 
+/** Views */
+template<typename T, class D>
+MultiArrayView<T>
+MultiArray<T, D>::View() requires D::layout_type::isStrided
+{
+  const auto& dims = Derived().Dimensions;
+  return MultiArrayView<T>(Derived().Entries.data(), MultiIndex(dims.begin(), dims.end()), Strides());
+}
+
+template<typename T, class D>
+MultiArrayView<const T>
+MultiArray<T, D>::View() const requires D::layout_type::isStrided
+{
+  const auto& dims = Derived().Dimensions;
+  return MultiArrayView<const T>(Derived().Entries.data(), MultiIndex(dims.begin(), dims.end()), Strides());
+}
+
+/** Layout-aware iteration */
+template<typename T, class D>
+template<class F>
+constexpr void
+MultiArray<T, D>::ForEach(F&& function)
+{
+  auto& entries = Derived().Entries;
+  D::layout_type::ForEach(Derived().Dimensions, [&](const size_t index, const auto& multi_index) { function(entries[index], multi_index); });
+}
+
+template<typename T, class D>
+template<class F>
+constexpr void
+MultiArray<T, D>::ForEach(F&& function) const
+{
+  const auto& entries = Derived().Entries;
+  D::layout_type::ForEach(Derived().Dimensions, [&](const size_t index, const auto& multi_index) { function(entries[index], multi_index); });
+}
+
 template<typename T, class D>
 constexpr D&
 MultiArray<T, D>::operator=(const std::initializer_list<T>& _value_array) noexcept
 {
   D& derived_class = Derived();
 
-  SizeCheck(derived_class.Dimensions.size(), 1);
-  SizeCheck(_value_array.size(), derived_class.Dimensions[0].size());
-  FOR(i, _value_array.size()) derived_class.Entries[i] = _value_array[i];
+  DEBUG_ASSERT(Rank() == 1, "Only one-dimensional arrays can be assigned a list of values.")
+  DEBUG_ASSERT(_value_array.size() == Dimension(0), "The list size ", _value_array.size(), " must equal the array size ", Dimension(0), ".")
+  size_t i = 0;
+  FOR_EACH_CONST(value, _value_array) derived_class(i++) = value;
 
   return derived_class;
 }
 
+/** Assignment of a list of rows, i.e. _value_matrix[i][j] is assigned to entry (i, j). */
 template<typename T, class D>
 constexpr D&
 MultiArray<T, D>::operator=(const std::initializer_list<std::initializer_list<T>>& _value_matrix) noexcept
 {
   D& derived_class = Derived();
 
-  SizeCheck(derived_class.Dimensions.size(), 2);
-  SizeCheck(_value_matrix.size(), derived_class.Dimensions[0].size());
+  DEBUG_ASSERT(Rank() == 2, "Only two-dimensional arrays can be assigned a list of rows.")
+  DEBUG_ASSERT(_value_matrix.size() == Dimension(0), "The number of rows ", _value_matrix.size(), " must equal ", Dimension(0), ".")
 
-  FOR(i, _value_matrix.size())
+  size_t i = 0;
+  FOR_EACH_CONST(row, _value_matrix)
   {
-    SizeCheck(_value_matrix[i].size(), derived_class.Dimensions[1].size());
-    FOR(j, _value_matrix[i].size()) derived_class(i, j) = _value_matrix[i][j];
+    DEBUG_ASSERT(row.size() == Dimension(1), "The number of columns ", row.size(), " must equal ", Dimension(1), ".")
+    size_t j = 0;
+    FOR_EACH_CONST(value, row) derived_class(i, j++) = value;
+    ++i;
   }
 
   return derived_class;
@@ -130,12 +154,12 @@ MultiArray<T, D>::operator=(const std::initializer_list<std::initializer_list<T>
 /***************************************************************************************************************************************************************
 * Static Multi-dimensional Array Class
 ***************************************************************************************************************************************************************/
-template<typename T, size_t... dims>
-constexpr StaticMultiArray<T, dims...>::StaticMultiArray()
-  : StaticMultiArray(StaticInitValue<T>()) {}
+template<typename T, class L, size_t... dims>
+constexpr StaticLayoutMultiArray<T, L, dims...>::StaticLayoutMultiArray()
+  : StaticLayoutMultiArray(StaticInitValue<T>()) {}
 
-template<typename T, size_t ...dims>
-constexpr StaticMultiArray<T, dims...>::StaticMultiArray(const T value)
+template<typename T, class L, size_t ...dims>
+constexpr StaticLayoutMultiArray<T, L, dims...>::StaticLayoutMultiArray(const T value)
   : Entries(value)
 {
   STATIC_ASSERT(0 < sizeof...(dims), "A multi-dimensional array must have at least 1 dimension.")
@@ -146,21 +170,38 @@ constexpr StaticMultiArray<T, dims...>::StaticMultiArray(const T value)
 ***************************************************************************************************************************************************************/
 
 /** Constructors/Destructors */
-template<typename T>
-DynamicMultiArray<T>::DynamicMultiArray()
+template<typename T, class L, class A>
+DynamicMultiArray<T, L, A>::DynamicMultiArray()
   : DynamicMultiArray(0) {}
 
-template<typename T>
-DynamicMultiArray<T>::DynamicMultiArray(const std::convertible_to<size_t> auto... _dimensions)
-  : Dimensions{static_cast<size_t>(_dimensions)...}, nEntries(Product(_dimensions...)), Entries(nEntries, DynamicInitValue<T>()) {}
+template<typename T, class L, class A>
+DynamicMultiArray<T, L, A>::DynamicMultiArray(const std::convertible_to<size_t> auto... _dimensions)
+  : Dimensions{static_cast<size_t>(_dimensions)...}, nEntries(Product(_dimensions...)), Entries(L::Capacity(Dimensions), DynamicInitValue<T>()) {}
+
+template<typename T, class L, class A>
+DynamicMultiArray<T, L, A>::DynamicMultiArray(const A& allocator)
+  : Dimensions{size_t(0)}, nEntries(0), Entries(allocator) {}
+
+template<typename T, class L, class A>
+DynamicMultiArray<T, L, A>::DynamicMultiArray(const MultiIndex& _dimensions)
+  : Dimensions(_dimensions.begin(), _dimensions.end()), nEntries(Product(_dimensions.begin(), _dimensions.end())),
+    Entries(L::Capacity(Dimensions), DynamicInitValue<T>()) {}
 
 /** Multi-array Resize Functions */
-template<typename T>
-void DynamicMultiArray<T>::Resize(const std::convertible_to<size_t> auto... _dimensions)
+template<typename T, class L, class A>
+void DynamicMultiArray<T, L, A>::Resize(const std::convertible_to<size_t> auto... _dimensions)
 {
-  Dimensions = {_dimensions...};
+  Dimensions = {static_cast<size_t>(_dimensions)...};
   nEntries = Product(_dimensions...);
-  Entries.resize(nEntries, DynamicInitValue<T>());
+  Entries.resize(L::Capacity(Dimensions), DynamicInitValue<T>());
+}
+
+template<typename T, class L, class A>
+void DynamicMultiArray<T, L, A>::Resize(const MultiIndex& _dimensions)
+{
+  Dimensions.assign(_dimensions.begin(), _dimensions.end());
+  nEntries = Product(_dimensions.begin(), _dimensions.end());
+  Entries.resize(L::Capacity(Dimensions), DynamicInitValue<T>());
 }
 
 }
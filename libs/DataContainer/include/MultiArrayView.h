@@ -0,0 +1,205 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "Array.h"
+#include "NumericContainer.h"
+#include "SmallArray.h"
+
+namespace aprn {
+
+/** Multi-index, dimension and stride arrays, stored inline for up to four dimensions. */
+using MultiIndex  = SmallArray<size_t, 4>;
+using StrideArray = SmallArray<std::ptrdiff_t, 4>;
+
+template<typename T> class MultiArrayView;
+
+/***************************************************************************************************************************************************************
+* Multi-dimensional Array View Iterator
+***************************************************************************************************************************************************************/
+
+/** Random-access iterator over the entries of a view, in the view's linear order (first index fastest). Sequential traversal steps through the strides
+    without any divisions. */
+template<typename T>
+class MultiArrayViewIterator
+{
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type        = RemoveConst<T>;
+  using difference_type   = std::ptrdiff_t;
+  using pointer           = T*;
+  using reference         = T&;
+
+  MultiArrayViewIterator() = default;
+
+  MultiArrayViewIterator(const MultiArrayView<T>* view, const size_t index);
+
+  reference operator*() const { return View_->Origin()[Offset_]; }
+
+  pointer operator->() const { return View_->Origin() + Offset_; }
+
+  reference operator[](const difference_type n) const { return *(*this + n); }
+
+  MultiArrayViewIterator& operator++();
+
+  MultiArrayViewIterator& operator--() { return *this -= 1; }
+
+  MultiArrayViewIterator operator++(int) { auto it = *this; ++*this; return it; }
+
+  MultiArrayViewIterator operator--(int) { auto it = *this; --*this; return it; }
+
+  MultiArrayViewIterator& operator+=(const difference_type n);
+
+  MultiArrayViewIterator& operator-=(const difference_type n) { return *this += -n; }
+
+  MultiArrayViewIterator operator+(const difference_type n) const { auto it = *this; return it += n; }
+
+  MultiArrayViewIterator operator-(const difference_type n) const { auto it = *this; return it -= n; }
+
+  difference_type operator-(const MultiArrayViewIterator& other) const
+  { return static_cast<difference_type>(Index_) - static_cast<difference_type>(other.Index_); }
+
+  bool operator==(const MultiArrayViewIterator& other) const { return Index_ == other.Index_; }
+
+  auto operator<=>(const MultiArrayViewIterator& other) const { return Index_ <=> other.Index_; }
+
+  friend MultiArrayViewIterator operator+(const difference_type n, const MultiArrayViewIterator& it) { return it + n; }
+
+private:
+  const MultiArrayView<T>* View_{nullptr};
+  size_t                   Index_{0};
+  MultiIndex               MultiIndex_;
+  std::ptrdiff_t           Offset_{0};
+};
+
+/***************************************************************************************************************************************************************
+* Multi-dimensional Array View Class
+***************************************************************************************************************************************************************/
+
+/** Non-owning view of a strided multi-dimensional block of entries, e.g. a slice or sub-block of a multi-array. Copying a view copies the reference to the
+    entries, whereas assigning to a view (from a view, scalar, or expression) assigns its entries. The viewed entries must outlive the view. Views are
+    numeric containers, and can hence be used directly in entry-wise arithmetic, which evaluates into an owning DynamicArray. */
+template<typename T>
+class MultiArrayView : public detail::NumericContainer<RemoveConst<T>, MultiArrayView<T>>
+{
+  using Base = detail::NumericContainer<RemoveConst<T>, MultiArrayView<T>>;
+
+public:
+  using value_type     = RemoveConst<T>;
+  using result_type    = DynamicArray<value_type>;
+  using iterator       = MultiArrayViewIterator<T>;
+  using const_iterator = MultiArrayViewIterator<T>;
+
+  /** Constructors. */
+  MultiArrayView() = default;
+
+  MultiArrayView(T* origin, const MultiIndex& dimensions, const StrideArray& strides);
+
+  MultiArrayView(const MultiArrayView&) = default;
+
+  /** Conversion of a mutable view to a const view. */
+  template<typename T2>
+  requires (isTypeSame<const T2, T>() && !isTypeSame<T2, T>())
+  MultiArrayView(const MultiArrayView<T2>& other)
+    : MultiArrayView(other.Origin(), other.Dimensions(), other.Strides()) {}
+
+  /** Entry-wise assignment. Entries that alias those of this view (see isAliased) are first copied, so that none are overwritten before they are read. */
+  MultiArrayView& operator=(const MultiArrayView& other);
+
+  template<typename T2>
+  requires (isTypeSame<RemoveConst<T2>, value_type>() && !isTypeSame<T2, T>())
+  MultiArrayView& operator=(const MultiArrayView<T2>& other);
+
+  MultiArrayView& operator=(const std::convertible_to<value_type> auto value);
+
+  template<detail::NumericExpressionType E>
+  MultiArrayView& operator=(const E& expression);
+
+  using Base::operator=;
+
+  /** Size and shape. */
+  size_t size() const noexcept { return nEntries_; }
+
+  bool empty() const noexcept { return nEntries_ == 0; }
+
+  size_t Rank() const noexcept { return Dimensions_.size(); }
+
+  const MultiIndex& Dimensions() const noexcept { return Dimensions_; }
+
+  const StrideArray& Strides() const noexcept { return Strides_; }
+
+  T* Origin() const noexcept { return Origin_; }
+
+  /** Check whether the entries are contiguous in the view's linear order. */
+  bool isContiguous() const noexcept;
+
+  /** Check whether another view overlaps the entries of this view in a different order (e.g. a permuted or broadcast view of the same entries), in which
+      case assigning one to the other entry by entry would overwrite entries before they are read. */
+  template<typename T2>
+  bool isAliased(const MultiArrayView<T2>& other) const;
+
+  /** Multi-dimensional subscript index toggling. */
+  std::ptrdiff_t ComputeOffset(const MultiIndex& multi_index) const;
+
+  MultiIndex ComputeMultiIndex(size_t index) const;
+
+  /** Subscript operator overloads. The linear index follows the view's own ordering (first index fastest), and takes a division per dimension to convert
+      to an offset, so that the entries are better traversed with the iterators, as they are in entry-wise arithmetic. */
+  T& operator()(const std::convertible_to<size_t> auto... multi_index) const;
+
+  T& operator[](size_t index) const;
+
+  /** Sub-views. */
+  MultiArrayView Slice(const size_t dimension, const size_t index) const;
+
+  MultiArrayView Block(const MultiIndex& first, const MultiIndex& extents) const;
+
+  MultiArrayView Stride(const size_t dimension, const size_t step) const;
+
+  /** View with permuted dimensions, whose dimension i is dimension order[i] of this view, e.g. a transpose for the order {1, 0}. */
+  MultiArrayView Permute(const MultiIndex& order) const;
+
+  /** View broadcast to the given dimensions, as in NumPy: the view's dimensions are aligned with the trailing given dimensions, and its dimensions of size
+      one (and any missing leading dimensions) are repeated with a zero stride. As their entries alias, broadcast views should only be read. */
+  MultiArrayView Broadcast(const MultiIndex& dimensions) const;
+
+  /** Iterators. */
+  iterator begin() const { return iterator(this, 0); }
+
+  iterator end() const { return iterator(this, nEntries_); }
+
+private:
+  template<typename T2>
+  void Assign(const MultiArrayView<T2>& other);
+
+  T*          Origin_{nullptr};
+  MultiIndex  Dimensions_;
+  StrideArray Strides_;
+  size_t      nEntries_{0};
+};
+
+namespace detail {
+
+/** Check whether any view or contiguous container operand of an expression aliases the given view (see MultiArrayView::isAliased). */
+template<typename T, class X>
+bool
+isAliased(const MultiArrayView<T>& view, const X& operand);
+
+}//detail
+
+}
+
+#include "MultiArrayView.tpp"
@@ -0,0 +1,351 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Multi-dimensional Array View Iterator
+***************************************************************************************************************************************************************/
+template<typename T>
+MultiArrayViewIterator<T>::MultiArrayViewIterator(const MultiArrayView<T>* view, const size_t index)
+  : View_(view), Index_(index)
+{
+  if(Index_ < View_->size())
+  {
+    MultiIndex_ = View_->ComputeMultiIndex(Index_);
+    Offset_ = View_->ComputeOffset(MultiIndex_);
+  }
+}
+
+/** Step to the next entry like an odometer, carrying over into the next dimension whenever the current one is exhausted. */
+template<typename T>
+MultiArrayViewIterator<T>&
+MultiArrayViewIterator<T>::operator++()
+{
+  if(++Index_ >= View_->size()) return *this;
+
+  const auto& dims    = View_->Dimensions();
+  const auto& strides = View_->Strides();
+
+  size_t i(0);
+  Offset_ += strides[0];
+  while(++MultiIndex_[i] == dims[i])
+  {
+    Offset_ -= static_cast<std::ptrdiff_t>(dims[i]) * strides[i];
+    MultiIndex_[i++] = 0;
+    Offset_ += strides[i];
+  }
+  return *this;
+}
+
+template<typename T>
+MultiArrayViewIterator<T>&
+MultiArrayViewIterator<T>::operator+=(const difference_type n)
+{
+  Index_ = static_cast<size_t>(static_cast<difference_type>(Index_) + n);
+  if(Index_ < View_->size())
+  {
+    MultiIndex_ = View_->ComputeMultiIndex(Index_);
+    Offset_ = View_->ComputeOffset(MultiIndex_);
+  }
+  return *this;
+}
+
+/***************************************************************************************************************************************************************
+* Multi-dimensional Array View Class
+***************************************************************************************************************************************************************/
+
+/** Constructors */
+template<typename T>
+MultiArrayView<T>::MultiArrayView(T* origin, const MultiIndex& dimensions, const StrideArray& strides)
+  : Origin_(origin), Dimensions_(dimensions), Strides_(strides), nEntries_(Product(dimensions.begin(), dimensions.end()))
+{
+  DEBUG_ASSERT(!dimensions.empty(), "A multi-dimensional array view must have at least 1 dimension.")
+  DEBUG_ASSERT(dimensions.size() == strides.size(), "The number of dimensions ", dimensions.size(), " must equal the number of strides ", strides.size(), ".")
+}
+
+/** Entry-wise Assignment */
+template<typename T>
+MultiArrayView<T>&
+MultiArrayView<T>::operator=(const MultiArrayView& other)
+{
+  Assign(other);
+  return *this;
+}
+
+template<typename T>
+template<typename T2>
+requires (isTypeSame<RemoveConst<T2>, RemoveConst<T>>() && !isTypeSame<T2, T>())
+MultiArrayView<T>&
+MultiArrayView<T>::operator=(const MultiArrayView<T2>& other)
+{
+  Assign(other);
+  return *this;
+}
+
+template<typename T>
+MultiArrayView<T>&
+MultiArrayView<T>::operator=(const std::convertible_to<value_type> auto value)
+{
+  std::fill(begin(), end(), static_cast<value_type>(value));
+  return *this;
+}
+
+template<typename T>
+template<detail::NumericExpressionType E>
+MultiArrayView<T>&
+MultiArrayView<T>::operator=(const E& expression)
+{
+  if(!detail::isAliased(*this, expression)) return Base::operator=(expression);
+
+  const DynamicArray<value_type> entries(expression.begin(), expression.end());
+  DEBUG_ASSERT(entries.size() == size(), "The view size ", size(), " must equal the expression size ", entries.size(), ".")
+  std::copy(entries.begin(), entries.end(), begin());
+  return *this;
+}
+
+template<typename T>
+template<typename T2>
+void
+MultiArrayView<T>::Assign(const MultiArrayView<T2>& other)
+{
+  DEBUG_ASSERT(std::equal(Dimensions_.begin(), Dimensions_.end(), other.Dimensions().begin(), other.Dimensions().end()), "The view dimensions must match.")
+
+  if(isAliased(other))
+  {
+    const DynamicArray<value_type> entries(other.begin(), other.end());
+    std::copy(entries.begin(), entries.end(), begin());
+  }
+  else std::copy(other.begin(), other.end(), begin());
+}
+
+/** Size and Shape */
+template<typename T>
+bool
+MultiArrayView<T>::isContiguous() const noexcept
+{
+  std::ptrdiff_t stride(1);
+  FOR(i, Rank())
+  {
+    if(Dimensions_[i] != 1 && Strides_[i] != stride) return false;
+    stride *= static_cast<std::ptrdiff_t>(Dimensions_[i]);
+  }
+  return true;
+}
+
+template<typename T>
+template<typename T2>
+bool
+MultiArrayView<T>::isAliased(const MultiArrayView<T2>& other) const
+{
+  if(empty() || other.empty()) return false;
+
+  // Views of the same entries in the same order do not alias, as each entry is then only read at the index it is assigned.
+  const auto* origin       = static_cast<const value_type*>(Origin_);
+  const auto* other_origin = static_cast<const value_type*>(other.Origin());
+  if(origin == other_origin && size() == other.size())
+  {
+    if(isContiguous() && other.isContiguous()) return false;
+    if(std::ranges::equal(Dimensions_, other.Dimensions()) && std::ranges::equal(Strides_, other.Strides())) return false;
+  }
+
+  // Otherwise, the views alias if the address ranges of their entries intersect.
+  const auto range = [](const auto* first, const auto& dimensions, const auto& strides)
+  {
+    auto last = first;
+    FOR(i, dimensions.size())
+    {
+      const auto extent = static_cast<std::ptrdiff_t>(dimensions[i] - 1) * strides[i];
+      if(extent < 0) first += extent;
+      else last += extent;
+    }
+    return std::make_pair(first, last);
+  };
+  const auto [first, last]             = range(origin, Dimensions_, Strides_);
+  const auto [other_first, other_last] = range(other_origin, other.Dimensions(), other.Strides());
+  return !std::less<>()(last, other_first) && !std::less<>()(other_last, first);
+}
+
+/** Multi-dimensional Subscript Index Toggling */
+template<typename T>
+std::ptrdiff_t
+MultiArrayView<T>::ComputeOffset(const MultiIndex& multi_index) const
+{
+  DEBUG_ASSERT(multi_index.size() == Rank(), "Multi-index size mismatch.")
+
+  std::ptrdiff_t offset(0);
+  FOR(i, Rank())
+  {
+    DEBUG_ASSERT(multi_index[i] < Dimensions_[i], "Multi index component ", multi_index[i], " must be lesser than ", Dimensions_[i], ".")
+    offset += static_cast<std::ptrdiff_t>(multi_index[i]) * Strides_[i];
+  }
+  return offset;
+}
+
+template<typename T>
+MultiIndex
+MultiArrayView<T>::ComputeMultiIndex(size_t index) const
+{
+  DEBUG_ASSERT(index < nEntries_, "The index ", index, " must be lesser than the view size ", nEntries_, ".")
+
+  MultiIndex multi_index(Rank());
+  FOR(i, Rank())
+  {
+    multi_index[i] = index % Dimensions_[i];
+    index /= Dimensions_[i];
+  }
+  return multi_index;
+}
+
+/** Subscript Operator Overloads */
+template<typename T>
+T&
+MultiArrayView<T>::operator()(const std::convertible_to<size_t> auto... multi_index) const
+{
+  DEBUG_ASSERT(sizeof...(multi_index) == Rank(), "Multi-index size mismatch.")
+
+  const size_t indices[] = {static_cast<size_t>(multi_index)...};
+  std::ptrdiff_t offset(0);
+  FOR(i, sizeof...(multi_index))
+  {
+    DEBUG_ASSERT(indices[i] < Dimensions_[i], "Multi index component ", indices[i], " must be lesser than ", Dimensions_[i], ".")
+    offset += static_cast<std::ptrdiff_t>(indices[i]) * Strides_[i];
+  }
+  return Origin_[offset];
+}
+
+template<typename T>
+T&
+MultiArrayView<T>::operator[](size_t index) const
+{
+  DEBUG_ASSERT(index < nEntries_, "The index ", index, " must be lesser than the view size ", nEntries_, ".")
+
+  std::ptrdiff_t offset(0);
+  FOR(i, Rank())
+  {
+    offset += static_cast<std::ptrdiff_t>(index % Dimensions_[i]) * Strides_[i];
+    index /= Dimensions_[i];
+  }
+  return Origin_[offset];
+}
+
+/** Sub-views */
+template<typename T>
+MultiArrayView<T>
+MultiArrayView<T>::Slice(const size_t dimension, const size_t index) const
+{
+  DEBUG_ASSERT(Rank() > 1, "Cannot slice a one-dimensional view.")
+  DEBUG_ASSERT(dimension < Rank(), "The dimension ", dimension, " must be lesser than the view rank ", Rank(), ".")
+  DEBUG_ASSERT(index < Dimensions_[dimension], "The slice index ", index, " must be lesser than ", Dimensions_[dimension], ".")
+
+  MultiIndex dims;
+  StrideArray strides;
+  FOR(i, Rank())
+    if(i != dimension)
+    {
+      dims.push_back(Dimensions_[i]);
+      strides.push_back(Strides_[i]);
+    }
+
+  return MultiArrayView(Origin_ + static_cast<std::ptrdiff_t>(index) * Strides_[dimension], dims, strides);
+}
+
+template<typename T>
+MultiArrayView<T>
+MultiArrayView<T>::Block(const MultiIndex& first, const MultiIndex& extents) const
+{
+  DEBUG_ASSERT(first.size() == Rank() && extents.size() == Rank(), "The block must have as many dimensions as the view.")
+  FOR(i, Rank())
+    DEBUG_ASSERT(first[i] + extents[i] <= Dimensions_[i], "The block exceeds dimension ", i, " of the view, of size ", Dimensions_[i], ".")
+
+  return MultiArrayView(Origin_ + ComputeOffset(first), extents, Strides_);
+}
+
+template<typename T>
+MultiArrayView<T>
+MultiArrayView<T>::Stride(const size_t dimension, const size_t step) const
+{
+  DEBUG_ASSERT(dimension < Rank(), "The dimension ", dimension, " must be lesser than the view rank ", Rank(), ".")
+  DEBUG_ASSERT(step > 0, "The stride step must be positive.")
+
+  MultiIndex dims(Dimensions_);
+  StrideArray strides(Strides_);
+  dims[dimension] = (dims[dimension] + step - 1) / step;
+  strides[dimension] *= static_cast<std::ptrdiff_t>(step);
+
+  return MultiArrayView(Origin_, dims, strides);
+}
+
+template<typename T>
+MultiArrayView<T>
+MultiArrayView<T>::Permute(const MultiIndex& order) const
+{
+  DEBUG_ASSERT(order.size() == Rank(), "The permutation must have as many entries as the view rank ", Rank(), ".")
+
+  MultiIndex dims(Rank());
+  StrideArray strides(Rank());
+  SmallArray<Bool, 4> is_permuted(Rank(), False);
+  FOR(i, Rank())
+  {
+    DEBUG_ASSERT(order[i] < Rank() && !is_permuted[order[i]], "The dimension order must be a permutation of 0, ..., ", Rank() - 1, ".")
+    is_permuted[order[i]] = true;
+    dims[i] = Dimensions_[order[i]];
+    strides[i] = Strides_[order[i]];
+  }
+
+  return MultiArrayView(Origin_, dims, strides);
+}
+
+template<typename T>
+MultiArrayView<T>
+MultiArrayView<T>::Broadcast(const MultiIndex& dimensions) const
+{
+  DEBUG_ASSERT(Rank() <= dimensions.size(), "Cannot broadcast a view of rank ", Rank(), " to a lower rank ", dimensions.size(), ".")
+
+  const size_t n_leading = dimensions.size() - Rank();
+  StrideArray strides(dimensions.size(), 0);
+  FOR(i, Rank())
+  {
+    DEBUG_ASSERT(Dimensions_[i] == dimensions[n_leading + i] || Dimensions_[i] == 1, "Cannot broadcast dimension ", i, " of size ", Dimensions_[i],
+                 " to size ", dimensions[n_leading + i], ".")
+    if(Dimensions_[i] != 1) strides[n_leading + i] = Strides_[i];
+  }
+
+  return MultiArrayView(Origin_, dimensions, strides);
+}
+
+/***************************************************************************************************************************************************************
+* Aliasing Functions
+***************************************************************************************************************************************************************/
+template<typename T, class X>
+bool
+detail::isAliased(const MultiArrayView<T>& view, const X& operand)
+{
+  if constexpr(requires { operand.Lhs(); operand.Rhs(); }) return isAliased(view, operand.Lhs()) || isAliased(view, operand.Rhs());
+  else if constexpr(NumericExpressionType<X>) return isAliased(view, operand.Operand());
+  else if constexpr(requires { view.isAliased(operand); }) return view.isAliased(operand);
+  else if constexpr(requires { operand.ArrayView(); }) return view.isAliased(operand.ArrayView());
+  else if constexpr(requires { operand.data(); operand.size(); })
+  {
+    using V = RemoveConst<std::remove_pointer_t<decltype(operand.data())>>;
+    return view.isAliased(MultiArrayView<const V>(operand.data(), MultiIndex{operand.size()}, StrideArray{1}));
+  }
+  else return false;
+}
+
+}
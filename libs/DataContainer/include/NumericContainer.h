@@ -17,10 +17,40 @@
 #include "../../../include/Global.h"
 #include "../../../include/Concepts.h"
 #include "../../../include/Random.h"
+#include "NumericExpression.h"
+#include "Parallel.h"
+#include "SIMD.h"
 
 namespace aprn {
 namespace detail {
 
+/***************************************************************************************************************************************************************
+* Vectorised Evaluation
+***************************************************************************************************************************************************************/
+
+/** Containers whose entries are stored contiguously as floating-point values, and can hence be passed to the SIMD kernels. */
+template<class C>
+concept ContiguousOperand = simd::SIMDType<typename C::value_type> && requires(const C& c) { { c.data() } -> std::same_as<const typename C::value_type*>; };
+
+/** Operands of entry type T that can be passed to the SIMD kernels, i.e. contiguous containers or scalars that do not promote T. */
+template<class X, typename T>
+concept VectorisableOperand = (ContiguousOperand<X> && isTypeSame<typename X::value_type, T>()) || (std::is_arithmetic_v<X> && isTypeSame<std::common_type_t<T, X>, T>());
+
+/** Compute result[i] = lhs[i] (op) rhs[i], or result[i] = lhs[i] (op) rhs for a scalar rhs, with the SIMD kernels. Returns false if the operands are not
+    vectorisable or too small to benefit, in which case the result is left unchanged. */
+template<NumericOperator op, class C, class L, class R>
+bool EvaluateVectorised(C& result, const L& lhs, const R& rhs);
+
+/** Evaluate an expression into a container with the SIMD kernels, if it is a single vectorisable operation. */
+template<class C, class E>
+bool EvaluateVectorised(C& result, const E& expression);
+
+template<class C, NumericOperator op, class L, class R>
+bool EvaluateVectorised(C& result, const BinaryExpression<op, L, R>& expression);
+
+template<class C, NumericOperator op, class X, typename S>
+bool EvaluateVectorised(C& result, const ScalarExpression<op, X, S>& expression);
+
 /***************************************************************************************************************************************************************
 * Numeric Data Container Class and Arithmetic Operations
 ***************************************************************************************************************************************************************/
@@ -31,15 +61,7 @@ protected:
   constexpr NumericContainer() {}
 
 public:
-  /** Scalar arithmetic operator overloads. */
-  constexpr D operator+(const std::convertible_to<T> auto scalar) const;
-
-  constexpr D operator-(const std::convertible_to<T> auto scalar) const;
-
-  constexpr D operator*(const std::convertible_to<T> auto scalar) const;
-
-  constexpr D operator/(const std::convertible_to<T> auto scalar) const;
-
+  /** Scalar compound assignment operator overloads. */
   constexpr D& operator+=(const std::convertible_to<T> auto scalar);
 
   constexpr D& operator-=(const std::convertible_to<T> auto scalar);
@@ -48,33 +70,22 @@ public:
 
   constexpr D& operator/=(const std::convertible_to<T> auto scalar);
 
-  /** Entry-wise binary arithmetic operator overloads. */
-  template<class D2>
-  constexpr D operator+(const NumericContainer<T, D2>& container) const;
-
-  template<class D2>
-  constexpr D operator-(const NumericContainer<T, D2>& container) const;
+  /** Entry-wise compound assignment operator overloads. */
+  template<NumericOperand X>
+  constexpr D& operator+=(const X& operand);
 
-  template<class D2>
-  constexpr D operator*(const NumericContainer<T, D2>& container) const;
+  template<NumericOperand X>
+  constexpr D& operator-=(const X& operand);
 
-  template<class D2>
-  constexpr D operator/(const NumericContainer<T, D2>& container) const;
+  template<NumericOperand X>
+  constexpr D& operator*=(const X& operand);
 
-  template<class D2>
-  constexpr D& operator+=(const NumericContainer<T, D2>& container);
+  template<NumericOperand X>
+  constexpr D& operator/=(const X& operand);
 
-  template<class D2>
-  constexpr D& operator-=(const NumericContainer<T, D2>& container);
-
-  template<class D2>
-  constexpr D& operator*=(const NumericContainer<T, D2>& container);
-
-  template<class D2>
-  constexpr D& operator/=(const NumericContainer<T, D2>& container);
-
-  /** Entry-wise unary operator overloads. */
-  constexpr D operator-() const;
+  /** Expression assignment, evaluated in-place in a single pass. */
+  template<NumericExpressionType E>
+  constexpr D& operator=(const E& expression);
 
   /** Entry randomisation. */
   void Randomise();
@@ -89,14 +100,48 @@ public:
   Derived() const noexcept { return static_cast<const D&>(*this); }
 
 private:
+  /** Apply a function to each entry and the entry of an operand (or a scalar) at the same index, distributing the entries over threads for large
+      containers. Strided containers and operands (i.e. views) are stepped through with cursors rather than indexed (see MakeCursor). */
+  template<class X, class F>
+  constexpr void ForEachEntry(const X& operand, F&& function);
+
   inline static Random<T> Randomiser = Random<T>();
 };
 
 }//detail
 
-/** Stand-alone Operator overloads. */
-template<Arithmetic T, class D>
-constexpr D operator*(const std::convertible_to<T> auto scalar, const detail::NumericContainer<T, D>& container);
+/** Stand-alone scalar arithmetic operator overloads. These, and the operators below, return lazily evaluated expressions. */
+template<detail::NumericOperand X>
+constexpr auto operator+(X&& operand, const std::convertible_to<detail::OperandValue<X>> auto scalar);
+
+template<detail::NumericOperand X>
+constexpr auto operator-(X&& operand, const std::convertible_to<detail::OperandValue<X>> auto scalar);
+
+template<detail::NumericOperand X>
+constexpr auto operator*(X&& operand, const std::convertible_to<detail::OperandValue<X>> auto scalar);
+
+template<detail::NumericOperand X>
+constexpr auto operator/(X&& operand, const std::convertible_to<detail::OperandValue<X>> auto scalar);
+
+template<detail::NumericOperand X>
+constexpr auto operator*(const std::convertible_to<detail::OperandValue<X>> auto scalar, X&& operand);
+
+/** Stand-alone entry-wise binary arithmetic operator overloads. */
+template<class L, class R> requires detail::NumericOperands<L, R>
+constexpr auto operator+(L&& lhs, R&& rhs);
+
+template<class L, class R> requires detail::NumericOperands<L, R>
+constexpr auto operator-(L&& lhs, R&& rhs);
+
+template<class L, class R> requires detail::NumericOperands<L, R>
+constexpr auto operator*(L&& lhs, R&& rhs);
+
+template<class L, class R> requires detail::NumericOperands<L, R>
+constexpr auto operator/(L&& lhs, R&& rhs);
+
+/** Stand-alone entry-wise unary operator overloads. */
+template<detail::NumericOperand X>
+constexpr auto operator-(X&& operand);
 
 }//aprn
 
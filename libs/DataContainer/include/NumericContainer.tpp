@@ -17,49 +17,81 @@
 namespace aprn {
 namespace detail {
 
-/** Scalar arithmetic operator overloads. */
-template<Arithmetic T, class D>
-constexpr D
-NumericContainer<T, D>::operator+(const std::convertible_to<T> auto scalar) const
+/***************************************************************************************************************************************************************
+* Vectorised Evaluation
+***************************************************************************************************************************************************************/
+template<NumericOperator op, class C, class L, class R>
+bool
+EvaluateVectorised(C& result, const L& lhs, const R& rhs)
 {
-  D out(Derived());
-  FOR_EACH(entry, out) entry += scalar;
-  return out;
-}
+  using T = typename C::value_type;
+  if constexpr(ContiguousOperand<C> && !std::is_arithmetic_v<L> && VectorisableOperand<L, T> && VectorisableOperand<R, T>)
+  {
+    const size_t n = result.size();
+    if(n < simd::MinKernelSize) return false;
 
-template<Arithmetic T, class D>
-constexpr D
-NumericContainer<T, D>::operator-(const std::convertible_to<T> auto scalar) const
-{
-  D out(Derived());
-  FOR_EACH(entry, out) entry -= scalar;
-  return out;
+    if constexpr(op == NumericOperator::Divide && !std::is_arithmetic_v<R>) FOR(i, n) DEBUG_ASSERT(!isEqual(rhs[i], Zero), "Cannot divide by zero.")
+
+    parallel::For(n, [&](const size_t first, const size_t last)
+    {
+      if constexpr(std::is_arithmetic_v<R>) simd::EntryWise<op>(lhs.data() + first, static_cast<T>(rhs), result.data() + first, last - first);
+      else                                  simd::EntryWise<op>(lhs.data() + first, rhs.data() + first, result.data() + first, last - first);
+    });
+    return true;
+  }
+  else return false;
 }
 
-template<Arithmetic T, class D>
-constexpr D
-NumericContainer<T, D>::operator*(const std::convertible_to<T> auto scalar) const
+template<class C, class E>
+bool
+EvaluateVectorised(C&, const E&) { return false; }
+
+template<class C, NumericOperator op, class L, class R>
+bool
+EvaluateVectorised(C& result, const BinaryExpression<op, L, R>& expression) { return EvaluateVectorised<op>(result, expression.Lhs(), expression.Rhs()); }
+
+template<class C, NumericOperator op, class X, typename S>
+bool
+EvaluateVectorised(C& result, const ScalarExpression<op, X, S>& expression)
 {
-  D out(Derived());
-  FOR_EACH(entry, out) entry *= scalar;
-  return out;
+  return EvaluateVectorised<op>(result, expression.Operand(), expression.Scalar());
 }
 
+/***************************************************************************************************************************************************************
+* Numeric Data Container Class and Arithmetic Operations
+***************************************************************************************************************************************************************/
+
+/** Parallel loop over entries, for containers large enough to benefit. */
 template<Arithmetic T, class D>
-constexpr D
-NumericContainer<T, D>::operator/(const std::convertible_to<T> auto scalar) const
+template<class X, class F>
+constexpr void
+NumericContainer<T, D>::ForEachEntry(const X& operand, F&& function)
 {
-  DEBUG_ASSERT(!isEqual(scalar, Zero), "Cannot divide by zero.")
-  D out(Derived());
-  FOR_EACH(entry, out) entry /= scalar;
-  return out;
+  const auto apply = [&](const size_t first, const size_t last)
+  {
+    if constexpr(hasStridedOperand<D>() || hasStridedOperand<X>())
+    {
+      auto entry  = Derived().begin() + first;
+      auto cursor = MakeCursor(operand, first);
+      for(size_t i = first; i < last; ++i, ++entry) function(*entry, cursor());
+    }
+    else if constexpr(std::is_arithmetic_v<X>) FOR(i, first, last) function(Derived()[i], operand);
+    else FOR(i, first, last) function(Derived()[i], operand[i]);
+  };
+
+  const size_t n = Derived().size();
+  if(!std::is_constant_evaluated() && parallel::isParallel(n)) parallel::For(n, apply);
+  else apply(0, n);
 }
 
+/** Scalar compound assignment operator overloads. Large floating-point containers are dispatched to the SIMD kernels. */
 template<Arithmetic T, class D>
 constexpr D&
 NumericContainer<T, D>::operator+=(const std::convertible_to<T> auto scalar)
 {
-  FOR_EACH(entry, Derived()) entry += scalar;
+  if(!std::is_constant_evaluated() && EvaluateVectorised<NumericOperator::Plus>(Derived(), Derived(), scalar)) return Derived();
+
+  ForEachEntry(scalar, [](auto& entry, const auto value) { entry += value; });
   return Derived();
 }
 
@@ -67,7 +99,9 @@ template<Arithmetic T, class D>
 constexpr D&
 NumericContainer<T, D>::operator-=(const std::convertible_to<T> auto scalar)
 {
-  FOR_EACH(entry, Derived()) entry -= scalar;
+  if(!std::is_constant_evaluated() && EvaluateVectorised<NumericOperator::Minus>(Derived(), Derived(), scalar)) return Derived();
+
+  ForEachEntry(scalar, [](auto& entry, const auto value) { entry -= value; });
   return Derived();
 }
 
@@ -75,7 +109,9 @@ template<Arithmetic T, class D>
 constexpr D&
 NumericContainer<T, D>::operator*=(const std::convertible_to<T> auto scalar)
 {
-  FOR_EACH(entry, Derived()) entry *= scalar;
+  if(!std::is_constant_evaluated() && EvaluateVectorised<NumericOperator::Multiply>(Derived(), Derived(), scalar)) return Derived();
+
+  ForEachEntry(scalar, [](auto& entry, const auto value) { entry *= value; });
   return Derived();
 }
 
@@ -84,113 +120,161 @@ constexpr D&
 NumericContainer<T, D>::operator/=(const std::convertible_to<T> auto scalar)
 {
   DEBUG_ASSERT(!isEqual(scalar, Zero), "Cannot divide by zero.")
-  FOR_EACH(entry, Derived()) entry /= scalar;
+  if(!std::is_constant_evaluated() && EvaluateVectorised<NumericOperator::Divide>(Derived(), Derived(), scalar)) return Derived();
+
+  ForEachEntry(scalar, [](auto& entry, const auto value) { entry /= value; });
   return Derived();
 }
 
-/** Entry-wise binary arithmetic operator overloads. */
+/** Entry-wise compound assignment operator overloads. Large contiguous floating-point operands are dispatched to the SIMD kernels. */
 template<Arithmetic T, class D>
-template<class D2>
-constexpr D
-NumericContainer<T, D>::operator+(const NumericContainer<T, D2>& container) const
+template<NumericOperand X>
+constexpr D&
+NumericContainer<T, D>::operator+=(const X& operand)
 {
-  D out(Derived());
-  FOR(i, out.size()) out[i] += container.Derived()[i];
-  return out;
+  const auto& other = ForwardOperand(operand);
+  if(!std::is_constant_evaluated() && EvaluateVectorised<NumericOperator::Plus>(Derived(), Derived(), other)) return Derived();
+
+  ForEachEntry(other, [](auto& entry, const auto value) { entry += value; });
+  return Derived();
 }
 
 template<Arithmetic T, class D>
-template<class D2>
-constexpr D
-NumericContainer<T, D>::operator-(const NumericContainer<T, D2>& container) const
+template<NumericOperand X>
+constexpr D&
+NumericContainer<T, D>::operator-=(const X& operand)
 {
-  D out(Derived());
-  FOR(i, out.size()) out[i] -= container.Derived()[i];
-  return out;
+  const auto& other = ForwardOperand(operand);
+  if(!std::is_constant_evaluated() && EvaluateVectorised<NumericOperator::Minus>(Derived(), Derived(), other)) return Derived();
+
+  ForEachEntry(other, [](auto& entry, const auto value) { entry -= value; });
+  return Derived();
 }
 
 template<Arithmetic T, class D>
-template<class D2>
-constexpr D
-NumericContainer<T, D>::operator*(const NumericContainer<T, D2>& container) const
+template<NumericOperand X>
+constexpr D&
+NumericContainer<T, D>::operator*=(const X& operand)
 {
-  D out(Derived());
-  FOR(i, out.size()) out[i] *= container.Derived()[i];
-  return out;
+  const auto& other = ForwardOperand(operand);
+  if(!std::is_constant_evaluated() && EvaluateVectorised<NumericOperator::Multiply>(Derived(), Derived(), other)) return Derived();
+
+  ForEachEntry(other, [](auto& entry, const auto value) { entry *= value; });
+  return Derived();
 }
 
 template<Arithmetic T, class D>
-template<class D2>
-constexpr D
-NumericContainer<T, D>::operator/(const NumericContainer<T, D2>& container) const
+template<NumericOperand X>
+constexpr D&
+NumericContainer<T, D>::operator/=(const X& operand)
 {
-  D out(Derived());
+  const auto& other = ForwardOperand(operand);
+  if(!std::is_constant_evaluated() && EvaluateVectorised<NumericOperator::Divide>(Derived(), Derived(), other)) return Derived();
 
-  FOR(i, out.size())
+  ForEachEntry(other, [](auto& entry, const auto value)
   {
-    DEBUG_ASSERT(!isEqual(container.Derived()[i], Zero), "Cannot divide by zero.")
-    out[i] /= container.Derived()[i];
-  }
-  return out;
+    DEBUG_ASSERT(!isEqual(value, Zero), "Cannot divide by zero.")
+    entry /= value;
+  });
+  return Derived();
 }
 
+/** Expression assignment. Entries are only ever combined at the same index, so the expression may alias this container only if its operands read their
+    entries in the container's order; views that read them in another order (e.g. permuted views) must be checked by the derived container, which then
+    evaluates the expression into a temporary (see MultiArrayView::isAliased). Single operations on large floating-point containers are dispatched to the
+    SIMD kernels. */
 template<Arithmetic T, class D>
-template<class D2>
+template<NumericExpressionType E>
 constexpr D&
-NumericContainer<T, D>::operator+=(const NumericContainer<T, D2>& container)
+NumericContainer<T, D>::operator=(const E& expression)
 {
-  FOR(i, Derived().size()) Derived()[i] += container.Derived()[i];
+  if constexpr(requires(D& d) { d.resize(expression.size()); }) Derived().resize(expression.size());
+  else DEBUG_ASSERT(Derived().size() == expression.size(), "The container size ", Derived().size(), " must equal the expression size ", expression.size(), ".")
+
+  if(!std::is_constant_evaluated() && EvaluateVectorised(Derived(), expression)) return Derived();
+
+  ForEachEntry(expression, [](auto& entry, const auto value) { entry = value; });
   return Derived();
 }
 
+/** Entry randomisation. As the randomiser cannot be shared between threads, each block of a large container is drawn from an independently seeded copy. */
 template<Arithmetic T, class D>
-template<class D2>
-constexpr D&
-NumericContainer<T, D>::operator-=(const NumericContainer<T, D2>& container)
+void NumericContainer<T, D>::Randomise()
 {
-  FOR(i, Derived().size()) Derived()[i] -= container.Derived()[i];
-  return Derived();
+  if(!parallel::isParallel(Derived().size())) { FOR_EACH(entry, Derived()) entry = Randomiser(); return; }
+
+  parallel::For(Derived().size(), [&](const size_t first, const size_t last)
+  {
+    auto randomiser = Randomiser;
+    FOR(i, first, last) Derived()[i] = randomiser();
+  });
 }
 
 template<Arithmetic T, class D>
-template<class D2>
-constexpr D&
-NumericContainer<T, D>::operator*=(const NumericContainer<T, D2>& container)
+void NumericContainer<T, D>::ResetRandomiser(const T min, const T max) { Randomiser.Reset(min, max); }
+
+}//Detail
+
+/** Stand-alone scalar arithmetic operator overloads. */
+template<detail::NumericOperand X>
+constexpr auto
+operator+(X&& operand, const std::convertible_to<detail::OperandValue<X>> auto scalar)
 {
-  FOR(i, Derived().size()) Derived()[i] *= container.Derived()[i];
-  return Derived();
+  return detail::ScalarExpression<detail::NumericOperator::Plus, X, RemoveConst<decltype(scalar)>>(std::forward<X>(operand), scalar);
 }
 
-template<Arithmetic T, class D>
-template<class D2>
-constexpr D&
-NumericContainer<T, D>::operator/=(const NumericContainer<T, D2>& container)
+template<detail::NumericOperand X>
+constexpr auto
+operator-(X&& operand, const std::convertible_to<detail::OperandValue<X>> auto scalar)
 {
-  FOR(i, Derived().size())
-  {
-    DEBUG_ASSERT(!isEqual(container.Derived()[i], Zero), "Cannot divide by zero.")
-    Derived()[i] /= container.Derived()[i];
-  }
-  return Derived();
+  return detail::ScalarExpression<detail::NumericOperator::Minus, X, RemoveConst<decltype(scalar)>>(std::forward<X>(operand), scalar);
 }
 
-/** Entry-wise unary operator overloads. */
-template<Arithmetic T, class D>
-constexpr D
-NumericContainer<T, D>::operator-() const { return -1 * Derived(); }
+template<detail::NumericOperand X>
+constexpr auto
+operator*(X&& operand, const std::convertible_to<detail::OperandValue<X>> auto scalar)
+{
+  return detail::ScalarExpression<detail::NumericOperator::Multiply, X, RemoveConst<decltype(scalar)>>(std::forward<X>(operand), scalar);
+}
 
-/** Entry randomisation. */
-template<Arithmetic T, class D>
-void NumericContainer<T, D>::Randomise() { FOR_EACH(entry, Derived()) entry = Randomiser(); }
+template<detail::NumericOperand X>
+constexpr auto
+operator/(X&& operand, const std::convertible_to<detail::OperandValue<X>> auto scalar)
+{
+  DEBUG_ASSERT(!isEqual(scalar, Zero), "Cannot divide by zero.")
+  return detail::ScalarExpression<detail::NumericOperator::Divide, X, RemoveConst<decltype(scalar)>>(std::forward<X>(operand), scalar);
+}
 
-template<Arithmetic T, class D>
-void NumericContainer<T, D>::ResetRandomiser(const T min, const T max) { Randomiser.Reset(min, max); }
+template<detail::NumericOperand X>
+constexpr auto
+operator*(const std::convertible_to<detail::OperandValue<X>> auto scalar, X&& operand) { return std::forward<X>(operand) * scalar; }
 
-}//Detail
+/** Stand-alone entry-wise binary arithmetic operator overloads. */
+template<class L, class R> requires detail::NumericOperands<L, R>
+constexpr auto
+operator+(L&& lhs, R&& rhs) { return detail::BinaryExpression<detail::NumericOperator::Plus, L, R>(std::forward<L>(lhs), std::forward<R>(rhs)); }
 
-/** Stand-alone Operator overloads. */
-template<Arithmetic T, class D>
-constexpr D
-operator*(const std::convertible_to<T> auto scalar, const detail::NumericContainer<T, D>& container) { return container.Derived() * scalar; }
+template<class L, class R> requires detail::NumericOperands<L, R>
+constexpr auto
+operator-(L&& lhs, R&& rhs) { return detail::BinaryExpression<detail::NumericOperator::Minus, L, R>(std::forward<L>(lhs), std::forward<R>(rhs)); }
+
+template<class L, class R> requires detail::NumericOperands<L, R>
+constexpr auto
+operator*(L&& lhs, R&& rhs) { return detail::BinaryExpression<detail::NumericOperator::Multiply, L, R>(std::forward<L>(lhs), std::forward<R>(rhs)); }
+
+template<class L, class R> requires detail::NumericOperands<L, R>
+constexpr auto
+operator/(L&& lhs, R&& rhs) { return detail::BinaryExpression<detail::NumericOperator::Divide, L, R>(std::forward<L>(lhs), std::forward<R>(rhs)); }
+
+/** Stand-alone entry-wise unary operator overloads. A negated container is evaluated immediately (in a single pass) so that it can still be passed to
+    functions expecting a container, whereas a negated expression remains lazy. */
+template<detail::NumericOperand X>
+constexpr auto
+operator-(X&& operand)
+{
+  const auto expression = detail::UnaryExpression<detail::NumericOperator::Negate, X>(std::forward<X>(operand));
+  if constexpr(detail::NumericContainerType<RemoveConstRef<X>>) return expression.Evaluate();
+  else                                                          return expression;
+}
 
-}//aprn
\ No newline at end of file
+}//aprn
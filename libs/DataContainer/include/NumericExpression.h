@@ -0,0 +1,410 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "../../../include/Concepts.h"
+
+#include <iterator>
+
+namespace aprn::detail {
+
+/** Forward declarations. */
+template<Arithmetic T, class D> class NumericContainer;
+template<typename T, class R, class E> class NumericExpression;
+
+/***************************************************************************************************************************************************************
+* Numeric Expression Operand Traits
+***************************************************************************************************************************************************************/
+
+/** Deduce the derived class of a numeric container/expression from a pointer to it (unevaluated contexts only). */
+template<Arithmetic T, class D>
+D* DerivedContainerPtr(const NumericContainer<T, D>*);
+
+template<typename T, class R, class E>
+E* DerivedExpressionPtr(const NumericExpression<T, R, E>*);
+
+/** Numeric container/expression concepts. */
+template<class C>
+concept NumericContainerType = requires(const C* c) { DerivedContainerPtr(c); };
+
+template<class E>
+concept NumericExpressionType = requires(const E* e) { DerivedExpressionPtr(e); };
+
+template<class X>
+concept NumericOperand = NumericContainerType<RemoveConstRef<X>> || NumericExpressionType<RemoveConstRef<X>>;
+
+/** The type with which an operand participates in an expression, i.e. the container's derived class or the expression itself, and its result type.
+    Non-owning containers (e.g. views) specify an owning result type through a result_type member. */
+template<class X, bool is_container = NumericContainerType<X>>
+struct OperandTraits
+{
+  using Type   = std::remove_pointer_t<decltype(DerivedContainerPtr(std::declval<const X*>()))>;
+  using Result = Type;
+};
+
+template<class X>
+requires requires { typename X::result_type; }
+struct OperandTraits<X, true>
+{
+  using Type   = std::remove_pointer_t<decltype(DerivedContainerPtr(std::declval<const X*>()))>;
+  using Result = typename X::result_type;
+};
+
+template<class X>
+struct OperandTraits<X, false>
+{
+  using Type   = X;
+  using Result = typename X::result_type;
+};
+
+template<class X> using OperandType   = typename OperandTraits<RemoveConstRef<X>>::Type;
+template<class X> using OperandResult = typename OperandTraits<RemoveConstRef<X>>::Result;
+template<class X> using OperandValue  = typename OperandType<X>::value_type;
+
+/** Container lvalues are stored by reference; expressions and container rvalues are stored by value so that they cannot dangle. */
+template<class X>
+using OperandStorage = std::conditional_t<LValue<X> && NumericContainerType<RemoveConstRef<X>>, const OperandType<X>&, OperandType<X>>;
+
+template<class L, class R>
+concept NumericOperands = NumericOperand<L> && NumericOperand<R> && isTypeSame<OperandValue<L>, OperandValue<R>>();
+
+/** Forward an operand as its derived container/expression type, preserving its value category. */
+template<class X>
+constexpr decltype(auto)
+ForwardOperand(X&& operand)
+{
+  if constexpr(!NumericContainerType<RemoveConstRef<X>>) return std::forward<X>(operand);
+  else if constexpr(LValue<X>)                            return static_cast<const OperandType<X>&>(operand);
+  else                                                    return static_cast<OperandType<X>&&>(operand);
+}
+
+/***************************************************************************************************************************************************************
+* Entry-wise Operators
+***************************************************************************************************************************************************************/
+enum class NumericOperator
+{
+  Plus,
+  Minus,
+  Multiply,
+  Divide,
+  Negate
+};
+
+/** Apply a binary entry-wise operator. The result is cast back to the entry type, consistent with compound assignment. */
+template<NumericOperator op, typename T>
+constexpr T
+ApplyOperator(const T a, const auto b)
+{
+  if constexpr(op == NumericOperator::Plus)     return static_cast<T>(a + b);
+  if constexpr(op == NumericOperator::Minus)    return static_cast<T>(a - b);
+  if constexpr(op == NumericOperator::Multiply) return static_cast<T>(a * b);
+  if constexpr(op == NumericOperator::Divide)
+  {
+    DEBUG_ASSERT(!isEqual(b, Zero), "Cannot divide by zero.")
+    return static_cast<T>(a / b);
+  }
+}
+
+/** Apply a unary entry-wise operator. */
+template<NumericOperator op, typename T>
+constexpr T
+ApplyOperator(const T a)
+{
+  STATIC_ASSERT(op == NumericOperator::Negate, "Unrecognised unary operator.")
+  return static_cast<T>(-a);
+}
+
+/***************************************************************************************************************************************************************
+* Numeric Expression Iterator
+***************************************************************************************************************************************************************/
+template<class E>
+class NumericExpressionIterator
+{
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type        = typename E::value_type;
+  using difference_type   = std::ptrdiff_t;
+  using pointer           = void;
+  using reference         = value_type;
+
+  constexpr NumericExpressionIterator() = default;
+
+  constexpr NumericExpressionIterator(const E* expression, const size_t index)
+    : Expression_(expression), Index_(index) {}
+
+  constexpr value_type operator*() const { return (*Expression_)[Index_]; }
+
+  constexpr value_type operator[](const difference_type n) const { return (*Expression_)[Index_ + n]; }
+
+  constexpr NumericExpressionIterator& operator++() { ++Index_; return *this; }
+
+  constexpr NumericExpressionIterator& operator--() { --Index_; return *this; }
+
+  constexpr NumericExpressionIterator operator++(int) { auto it = *this; ++Index_; return it; }
+
+  constexpr NumericExpressionIterator operator--(int) { auto it = *this; --Index_; return it; }
+
+  constexpr NumericExpressionIterator& operator+=(const difference_type n) { Index_ += n; return *this; }
+
+  constexpr NumericExpressionIterator& operator-=(const difference_type n) { Index_ -= n; return *this; }
+
+  constexpr NumericExpressionIterator operator+(const difference_type n) const { return {Expression_, Index_ + n}; }
+
+  constexpr NumericExpressionIterator operator-(const difference_type n) const { return {Expression_, Index_ - n}; }
+
+  constexpr difference_type operator-(const NumericExpressionIterator& other) const
+  { return static_cast<difference_type>(Index_) - static_cast<difference_type>(other.Index_); }
+
+  constexpr bool operator==(const NumericExpressionIterator& other) const { return Index_ == other.Index_; }
+
+  constexpr auto operator<=>(const NumericExpressionIterator& other) const { return Index_ <=> other.Index_; }
+
+  friend constexpr NumericExpressionIterator operator+(const difference_type n, const NumericExpressionIterator& it) { return it + n; }
+
+private:
+  const E* Expression_{nullptr};
+  size_t   Index_{0};
+};
+
+/***************************************************************************************************************************************************************
+* Numeric Expression Abstract Base Class
+***************************************************************************************************************************************************************/
+
+/** A lazily evaluated, entry-wise arithmetic expression over numeric containers. Entries are computed on access, so that a whole expression is evaluated
+    in a single pass when it is assigned to, or converted into, its result type R. */
+template<typename T, class R, class E>
+class NumericExpression
+{
+protected:
+  constexpr NumericExpression() = default;
+
+public:
+  using value_type  = T;
+  using result_type = R;
+
+  /** Expression evaluation. Floating-point results are assigned in-place, so that the expression can be dispatched to the SIMD kernels. Results with a
+      shape beyond their size (e.g. dynamic matrices) are first reshaped like the expression's leading container operand. */
+  constexpr R
+  Evaluate() const
+  {
+    if constexpr(requires(R& result) { result.Reshape(Derived().Leading()); })
+    {
+      R result;
+      result.Reshape(Derived().Leading());
+      result = Derived();
+      return result;
+    }
+    else
+    {
+      if constexpr(std::floating_point<T> && std::default_initializable<R> && NumericContainerType<R>)
+        if(!std::is_constant_evaluated())
+        {
+          R result;
+          result = Derived();
+          return result;
+        }
+      return R(begin(), end());
+    }
+  }
+
+  constexpr operator R() const { return Evaluate(); }
+
+  /** Iterators. */
+  constexpr auto
+  begin() const { return NumericExpressionIterator<E>(&Derived(), 0); }
+
+  constexpr auto
+  end() const { return NumericExpressionIterator<E>(&Derived(), Derived().size()); }
+
+  /** Derived class access. */
+  constexpr const E&
+  Derived() const noexcept { return static_cast<const E&>(*this); }
+};
+
+/***************************************************************************************************************************************************************
+* Numeric Expression Classes
+***************************************************************************************************************************************************************/
+
+/** Entry-wise binary operation between two operands.
+***************************************************************************************************************************************************************/
+template<NumericOperator op, class L, class R>
+class BinaryExpression final : public NumericExpression<OperandValue<L>, OperandResult<L>, BinaryExpression<op, L, R>>
+{
+public:
+  template<class L2, class R2>
+  constexpr BinaryExpression(L2&& lhs, R2&& rhs)
+    : Lhs_(ForwardOperand(std::forward<L2>(lhs))), Rhs_(ForwardOperand(std::forward<R2>(rhs)))
+  {
+    DEBUG_ASSERT(Lhs_.size() == Rhs_.size(), "The operand sizes ", Lhs_.size(), " and ", Rhs_.size(), " must be equal.")
+  }
+
+  constexpr OperandValue<L>
+  operator[](const size_t i) const { return ApplyOperator<op>(Lhs_[i], Rhs_[i]); }
+
+  constexpr size_t
+  size() const { return Lhs_.size(); }
+
+  /** Leading container operand, whose shape is taken by the evaluated result. */
+  constexpr const auto&
+  Leading() const
+  {
+    if constexpr(NumericExpressionType<OperandType<L>>) return Lhs_.Leading();
+    else return Lhs_;
+  }
+
+  /** Operand access. */
+  constexpr const OperandType<L>&
+  Lhs() const { return Lhs_; }
+
+  constexpr const OperandType<R>&
+  Rhs() const { return Rhs_; }
+
+private:
+  OperandStorage<L> Lhs_;
+  OperandStorage<R> Rhs_;
+};
+
+/** Entry-wise binary operation between an operand and a scalar.
+***************************************************************************************************************************************************************/
+template<NumericOperator op, class X, typename S>
+class ScalarExpression final : public NumericExpression<OperandValue<X>, OperandResult<X>, ScalarExpression<op, X, S>>
+{
+public:
+  template<class X2>
+  constexpr ScalarExpression(X2&& operand, const S scalar)
+    : Operand_(ForwardOperand(std::forward<X2>(operand))), Scalar_(scalar) {}
+
+  constexpr OperandValue<X>
+  operator[](const size_t i) const { return ApplyOperator<op>(Operand_[i], Scalar_); }
+
+  constexpr size_t
+  size() const { return Operand_.size(); }
+
+  /** Leading container operand, whose shape is taken by the evaluated result. */
+  constexpr const auto&
+  Leading() const
+  {
+    if constexpr(NumericExpressionType<OperandType<X>>) return Operand_.Leading();
+    else return Operand_;
+  }
+
+  /** Operand access. */
+  constexpr const OperandType<X>&
+  Operand() const { return Operand_; }
+
+  constexpr S
+  Scalar() const { return Scalar_; }
+
+private:
+  OperandStorage<X> Operand_;
+  S                 Scalar_;
+};
+
+/** Entry-wise unary operation on an operand.
+***************************************************************************************************************************************************************/
+template<NumericOperator op, class X>
+class UnaryExpression final : public NumericExpression<OperandValue<X>, OperandResult<X>, UnaryExpression<op, X>>
+{
+public:
+  template<class X2>
+  explicit constexpr UnaryExpression(X2&& operand)
+    : Operand_(ForwardOperand(std::forward<X2>(operand))) {}
+
+  constexpr OperandValue<X>
+  operator[](const size_t i) const { return ApplyOperator<op>(Operand_[i]); }
+
+  constexpr size_t
+  size() const { return Operand_.size(); }
+
+  /** Leading container operand, whose shape is taken by the evaluated result. */
+  constexpr const auto&
+  Leading() const
+  {
+    if constexpr(NumericExpressionType<OperandType<X>>) return Operand_.Leading();
+    else return Operand_;
+  }
+
+  /** Operand access. */
+  constexpr const OperandType<X>&
+  Operand() const { return Operand_; }
+
+private:
+  OperandStorage<X> Operand_;
+};
+
+/***************************************************************************************************************************************************************
+* Numeric Expression Support Functions
+***************************************************************************************************************************************************************/
+
+/** Containers whose entries are not stored contiguously (i.e. views), of which the offset of the entry at a linear index takes a division per dimension to
+    find, so that they are stepped through with their iterators rather than indexed. */
+template<class X>
+concept StridedOperand = NumericContainerType<X> && !requires(const X& x) { x.data(); };
+
+/** Check whether an operand, or any operand of an expression, is strided. */
+template<class X>
+constexpr bool
+hasStridedOperand()
+{
+  if constexpr(requires(const X& x) { x.Lhs(); x.Rhs(); })
+    return hasStridedOperand<RemoveConstRef<decltype(std::declval<const X&>().Lhs())>>()
+           || hasStridedOperand<RemoveConstRef<decltype(std::declval<const X&>().Rhs())>>();
+  else if constexpr(NumericExpressionType<X>) return hasStridedOperand<RemoveConstRef<decltype(std::declval<const X&>().Operand())>>();
+  else return StridedOperand<X>;
+}
+
+/** Cursor over the entries of an operand from a given index, i.e. a function that returns an entry and advances to the next on each call. Expressions
+    combine the cursors of their operands, and containers step through their entries with their iterators. */
+template<class X>
+constexpr auto
+MakeCursor(const X& operand, const size_t index)
+{
+  if constexpr(std::is_arithmetic_v<X>) return [operand]() { return operand; };
+  else return [entry = operand.begin() + index]() mutable { const auto value = *entry; ++entry; return value; };
+}
+
+template<NumericOperator op, class L, class R>
+constexpr auto
+MakeCursor(const BinaryExpression<op, L, R>& expression, const size_t index)
+{
+  return [lhs = MakeCursor(expression.Lhs(), index), rhs = MakeCursor(expression.Rhs(), index)]() mutable { return ApplyOperator<op>(lhs(), rhs()); };
+}
+
+template<NumericOperator op, class X, typename S>
+constexpr auto
+MakeCursor(const ScalarExpression<op, X, S>& expression, const size_t index)
+{
+  return [operand = MakeCursor(expression.Operand(), index), scalar = expression.Scalar()]() mutable { return ApplyOperator<op>(operand(), scalar); };
+}
+
+template<NumericOperator op, class X>
+constexpr auto
+MakeCursor(const UnaryExpression<op, X>& expression, const size_t index)
+{
+  return [operand = MakeCursor(expression.Operand(), index)]() mutable { return ApplyOperator<op>(operand()); };
+}
+
+/** Evaluate an operand into its result type. Containers are passed through without a copy. */
+template<class X>
+requires NumericOperand<X>
+constexpr decltype(auto)
+Evaluate(const X& operand)
+{
+  if constexpr(NumericExpressionType<X>) return operand.Evaluate();
+  else                                   return ForwardOperand(operand);
+}
+
+}//aprn::detail
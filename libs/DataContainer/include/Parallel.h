@@ -0,0 +1,78 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+
+#include <omp.h>
+#include <vector>
+
+namespace aprn::parallel {
+
+/***************************************************************************************************************************************************************
+* Parallel Execution Settings
+***************************************************************************************************************************************************************/
+
+/** Minimum number of entries for which loops are distributed over threads. */
+constexpr size_t MinParallelSize = 1 << 15;
+
+/** Number of entries per block. Blocks are fixed irrespective of the thread count, so that blocked reductions are always combined in the same order. */
+constexpr size_t BlockSize = 1 << 13;
+
+/** Number of blocks spanning a given number of entries. */
+constexpr size_t
+BlockCount(const size_t n) { return n / BlockSize + (n % BlockSize != 0); }
+
+/** Check whether a loop over a given number of entries should be distributed over threads. Nested parallel regions are always avoided. */
+inline bool
+isParallel(const size_t n) { return n >= MinParallelSize && omp_get_max_threads() > 1 && !omp_in_parallel(); }
+
+/***************************************************************************************************************************************************************
+* Parallel Loops
+***************************************************************************************************************************************************************/
+
+/** Apply a function to each block [first, last) of the index range [0, n), distributing the blocks over threads if the range is large enough. */
+template<class F>
+void
+For(const size_t n, F&& block_function)
+{
+  const auto n_blocks = BlockCount(n);
+  if(n_blocks < 2) { if(n) block_function(size_t(0), n); return; }
+
+  #pragma omp parallel for schedule(static) if(isParallel(n))
+  for(size_t i = 0; i < n_blocks; ++i) block_function(i * BlockSize, Min((i + 1) * BlockSize, n));
+}
+
+/** Reduce the index range [0, n) by applying a function to each block [first, last), and combining the block results pairwise. As the blocks and
+    combination order are fixed, the result is independent of the number of threads. */
+template<typename T, class F, class C>
+T
+Reduce(const size_t n, F&& block_function, C&& combine)
+{
+  const auto n_blocks = BlockCount(n);
+  if(n_blocks < 2) return block_function(size_t(0), n);
+
+  std::vector<T> partials(n_blocks);
+
+  #pragma omp parallel for schedule(static) if(isParallel(n))
+  for(size_t i = 0; i < n_blocks; ++i) partials[i] = block_function(i * BlockSize, Min((i + 1) * BlockSize, n));
+
+  for(size_t stride = 1; stride < n_blocks; stride *= 2)
+    for(size_t i = 0; i + stride < n_blocks; i += 2 * stride) partials[i] = combine(partials[i], partials[i + stride]);
+
+  return partials[0];
+}
+
+}//aprn::parallel
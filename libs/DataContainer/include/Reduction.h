@@ -0,0 +1,333 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "NumericContainer.h"
+#include "Parallel.h"
+#include "SIMD.h"
+
+#include <iterator>
+#include <ranges>
+
+/***************************************************************************************************************************************************************
+* Reductions
+*
+* Reductions over iterator ranges, and over numeric containers, expressions and other ranges. Large random-access ranges are split into the fixed blocks of
+* parallel::Reduce, which are reduced independently (over threads) and combined pairwise, and contiguous floating-point blocks are reduced with the SIMD
+* kernels, whose partial sums are also fixed. The order of every floating-point operation is therefore independent of the number of threads and of the
+* instruction set, so that the results are bit-identical across runs and machines. Floating-point sums are Kahan-compensated throughout.
+***************************************************************************************************************************************************************/
+
+namespace aprn::reduce {
+
+/** An entry value and its index within the reduced range. */
+template<typename T>
+struct IndexedEntry
+{
+  T      Value;
+  size_t Index;
+};
+
+namespace detail {
+
+/** Running sum, with a Kahan compensation term for floating-point types. */
+template<typename T>
+struct KahanSum
+{
+  T Sum{};
+  T Compensation{};
+
+  constexpr void
+  Add(const T value)
+  {
+    if constexpr(std::floating_point<T>)
+    {
+      const T y = value - Compensation;
+      const T t = Sum + y;
+      Compensation = (t - Sum) - y;
+      Sum = t;
+    }
+    else Sum += value;
+  }
+
+  constexpr T
+  Result() const { return Sum - Compensation; }
+
+  /** Combination of two running sums, which retains the rounding error of their addition (Knuth's TwoSum). */
+  friend constexpr KahanSum
+  operator+(const KahanSum& a, const KahanSum& b)
+  {
+    if constexpr(!std::floating_point<T>) return {a.Sum + b.Sum, T{}};
+    else
+    {
+      const T sum   = a.Sum + b.Sum;
+      const T b_sum = sum - a.Sum;
+      const T error = (a.Sum - (sum - b_sum)) + (b.Sum - b_sum);
+      return {sum, a.Compensation + b.Compensation - error};
+    }
+  }
+};
+
+/** Ranges accepted by the range reductions: numeric containers/expressions, and any other input range (e.g. arrays and views). */
+template<class X>
+concept ReducibleRange = aprn::detail::NumericOperand<X> || std::ranges::input_range<const RemoveConstRef<X>&>;
+
+template<class X>
+using RangeValue = std::iter_value_t<decltype(std::declval<const RemoveConstRef<X>&>().begin())>;
+
+/** Mean/variance type, which is floating-point for integral entries. */
+template<typename T>
+using MomentType = std::conditional_t<std::floating_point<T>, T, Real>;
+
+/** Reduce a range by applying a function to sub-ranges and combining their results. Random-access ranges are split into the fixed blocks of
+    parallel::Reduce; other ranges are reduced sequentially as a single sub-range. */
+template<typename R, class It, class B, class C>
+R
+ReduceRange(const It first, const It last, B&& block_function, C&& combine)
+{
+  if constexpr(std::random_access_iterator<It>)
+  {
+    const auto n = static_cast<size_t>(last - first);
+    const auto reduce_block = [&](const size_t i0, const size_t i1) -> R { return block_function(first + i0, first + i1, i0); };
+    return parallel::Reduce<R>(n, reduce_block, combine);
+  }
+  else return block_function(first, last, size_t(0));
+}
+
+/** Pick the lesser (or greater) of two indexed entries, preferring the lower index for equal values. */
+template<bool is_min, typename T>
+constexpr IndexedEntry<T>
+Extremum(const IndexedEntry<T>& a, const IndexedEntry<T>& b)
+{
+  const bool pick_b = is_min ? b.Value < a.Value : a.Value < b.Value;
+  return pick_b || (!(a.Value < b.Value) && !(b.Value < a.Value) && b.Index < a.Index) ? b : a;
+}
+
+template<bool is_min, class It>
+IndexedEntry<std::iter_value_t<It>>
+FindExtremum(const It first, const It last)
+{
+  using T = std::iter_value_t<It>;
+  DEBUG_ASSERT(first != last, "Cannot find the extremum of an empty range.")
+
+  const auto block = [](It it, const It end, size_t index) -> IndexedEntry<T>
+  {
+    IndexedEntry<T> extremum{*it, index};
+    for(++it, ++index; it != end; ++it, ++index) extremum = Extremum<is_min>(extremum, IndexedEntry<T>{*it, index});
+    return extremum;
+  };
+  const auto combine = [](const IndexedEntry<T>& a, const IndexedEntry<T>& b) { return Extremum<is_min>(a, b); };
+  return ReduceRange<IndexedEntry<T>>(first, last, block, combine);
+}
+
+/** Forward a range as its derived container/expression type, so that contiguous containers are recognised as such. */
+template<class X>
+constexpr const auto&
+ForwardRange(const X& range)
+{
+  if constexpr(aprn::detail::NumericOperand<X>) return aprn::detail::ForwardOperand(range);
+  else return range;
+}
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* Sums and Products
+***************************************************************************************************************************************************************/
+
+/** Compensated sum of the entries in a range. */
+template<std::input_iterator It>
+std::iter_value_t<It>
+Sum(const It first, const It last)
+{
+  using T = std::iter_value_t<It>;
+  const auto block = [](It it, const It end, size_t)
+  {
+    detail::KahanSum<T> sum;
+    for(; it != end; ++it) sum.Add(*it);
+    return sum;
+  };
+  return detail::ReduceRange<detail::KahanSum<T>>(first, last, block, std::plus<>()).Result();
+}
+
+template<detail::ReducibleRange X>
+auto
+Sum(const X& range)
+{
+  const auto& x = detail::ForwardRange(range);
+  using C = RemoveConstRef<decltype(x)>;
+  if constexpr(aprn::detail::ContiguousOperand<C>)
+  {
+    using T = typename C::value_type;
+    const auto block = [&](const size_t first, const size_t last) { return detail::KahanSum<T>{simd::CompensatedSum(x.data() + first, last - first)}; };
+    return parallel::Reduce<detail::KahanSum<T>>(x.size(), block, std::plus<>()).Result();
+  }
+  else return reduce::Sum(x.begin(), x.end());
+}
+
+/** Product of the entries in a range, multiplied in blocks that are combined pairwise. */
+template<std::input_iterator It>
+std::iter_value_t<It>
+Product(const It first, const It last)
+{
+  using T = std::iter_value_t<It>;
+  const auto block = [](It it, const It end, size_t)
+  {
+    T product(1);
+    for(; it != end; ++it) product *= *it;
+    return product;
+  };
+  return detail::ReduceRange<T>(first, last, block, std::multiplies<>());
+}
+
+template<detail::ReducibleRange X>
+auto
+Product(const X& range)
+{
+  const auto& x = detail::ForwardRange(range);
+  return reduce::Product(x.begin(), x.end());
+}
+
+/***************************************************************************************************************************************************************
+* Extrema
+***************************************************************************************************************************************************************/
+
+/** Least/greatest entry in a non-empty range, and its index. The first such entry is returned if there are several. */
+template<std::input_iterator It>
+IndexedEntry<std::iter_value_t<It>>
+Min(const It first, const It last) { return detail::FindExtremum<true>(first, last); }
+
+template<std::input_iterator It>
+IndexedEntry<std::iter_value_t<It>>
+Max(const It first, const It last) { return detail::FindExtremum<false>(first, last); }
+
+template<detail::ReducibleRange X>
+auto
+Min(const X& range)
+{
+  const auto& x = detail::ForwardRange(range);
+  return reduce::Min(x.begin(), x.end());
+}
+
+template<detail::ReducibleRange X>
+auto
+Max(const X& range)
+{
+  const auto& x = detail::ForwardRange(range);
+  return reduce::Max(x.begin(), x.end());
+}
+
+/***************************************************************************************************************************************************************
+* Moments
+***************************************************************************************************************************************************************/
+
+/** Arithmetic mean of a non-empty range. */
+template<detail::ReducibleRange X>
+auto
+Mean(const X& range)
+{
+  using M = detail::MomentType<detail::RangeValue<X>>;
+  const auto& x = detail::ForwardRange(range);
+  const auto n = static_cast<size_t>(std::ranges::distance(x.begin(), x.end()));
+  DEBUG_ASSERT(n > 0, "Cannot compute the mean of an empty range.")
+
+  return static_cast<M>(reduce::Sum(x)) / static_cast<M>(n);
+}
+
+/** Population (or sample) variance of a range, computed with the two-pass algorithm, i.e. from the deviations from the mean, and corrected for the
+    rounding error of the mean. */
+template<detail::ReducibleRange X>
+auto
+Variance(const X& range, const bool is_sample = false)
+{
+  using M = detail::MomentType<detail::RangeValue<X>>;
+  using Sums = std::pair<detail::KahanSum<M>, detail::KahanSum<M>>;
+
+  const auto& x = detail::ForwardRange(range);
+  const auto first = x.begin();
+  const auto last = x.end();
+  const auto n = static_cast<size_t>(std::ranges::distance(first, last));
+  DEBUG_ASSERT(n > is_sample, "The range is too small to compute its variance.")
+
+  const M mean = reduce::Mean(x);
+  const auto block = [mean](auto it, const auto end, size_t)
+  {
+    Sums sums;
+    for(; it != end; ++it)
+    {
+      const M deviation = static_cast<M>(*it) - mean;
+      sums.first.Add(deviation);
+      sums.second.Add(deviation * deviation);
+    }
+    return sums;
+  };
+  const auto combine = [](const Sums& a, const Sums& b) { return Sums{a.first + b.first, a.second + b.second}; };
+
+  const auto [deviation_sum, square_sum] = detail::ReduceRange<Sums>(first, last, block, combine);
+  const M deviation = deviation_sum.Result();
+  return (square_sum.Result() - deviation * deviation / static_cast<M>(n)) / static_cast<M>(n - is_sample);
+}
+
+/***************************************************************************************************************************************************************
+* Inner Products
+***************************************************************************************************************************************************************/
+
+/** Dot product of two ranges, with compensated summation of the products. */
+template<std::input_iterator It0, std::input_iterator It1>
+auto
+Dot(const It0 first0, const It0 last0, const It1 first1)
+{
+  using T = decltype(*first0 * *first1);
+  if constexpr(std::random_access_iterator<It0> && std::random_access_iterator<It1>)
+  {
+    const auto block = [&](const It0 it0, const It0 end0, const size_t first)
+    {
+      detail::KahanSum<T> sum;
+      auto it1 = first1 + first;
+      for(auto it = it0; it != end0; ++it, ++it1) sum.Add(*it * *it1);
+      return sum;
+    };
+    return detail::ReduceRange<detail::KahanSum<T>>(first0, last0, block, std::plus<>()).Result();
+  }
+  else
+  {
+    detail::KahanSum<T> sum;
+    for(auto it0 = first0, it1 = first1; it0 != last0; ++it0, ++it1) sum.Add(*it0 * *it1);
+    return sum.Result();
+  }
+}
+
+template<detail::ReducibleRange X0, detail::ReducibleRange X1>
+auto
+Dot(const X0& range0, const X1& range1)
+{
+  const auto& x0 = detail::ForwardRange(range0);
+  const auto& x1 = detail::ForwardRange(range1);
+  DEBUG_ASSERT(std::ranges::distance(x0.begin(), x0.end()) == std::ranges::distance(x1.begin(), x1.end()), "The ranges must be of equal size.")
+
+  using C0 = RemoveConstRef<decltype(x0)>;
+  using C1 = RemoveConstRef<decltype(x1)>;
+  if constexpr(aprn::detail::ContiguousOperand<C0> && aprn::detail::ContiguousOperand<C1> && isTypeSame<typename C0::value_type, typename C1::value_type>())
+  {
+    using T = typename C0::value_type;
+    const auto block = [&](const size_t first, const size_t last)
+    { return detail::KahanSum<T>{simd::CompensatedDot(x0.data() + first, x1.data() + first, last - first)}; };
+    return parallel::Reduce<detail::KahanSum<T>>(x0.size(), block, std::plus<>()).Result();
+  }
+  else return reduce::Dot(x0.begin(), x0.end(), x1.begin());
+}
+
+}//aprn::reduce
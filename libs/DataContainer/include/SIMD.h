@@ -0,0 +1,376 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "NumericExpression.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+  #define SIMD_X86
+  #include <immintrin.h>
+#endif
+
+namespace aprn::simd {
+
+/***************************************************************************************************************************************************************
+* Instruction Set Selection
+***************************************************************************************************************************************************************/
+enum class InstructionSet
+{
+  Scalar,
+  SSE2,
+  AVX2,
+  AVX512
+};
+
+/** Types for which vectorised kernels are available. */
+template<typename T> concept SIMDType = isTypeSame<T, float>() || isTypeSame<T, double>();
+
+/** Minimum number of entries for which the dispatched kernels are preferred over plain loops. */
+constexpr size_t MinKernelSize = 32;
+
+/** Number of independent partial sums used by reductions (one cache line). Being fixed, reductions are bitwise identical for all instruction sets. */
+template<SIMDType T> constexpr size_t ReductionLanes = 64 / sizeof(T);
+
+/** Detect the most capable instruction set supported by the host CPU. */
+inline InstructionSet
+SupportedInstructionSet()
+{
+#ifdef SIMD_X86
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports("avx512f"))                                 return InstructionSet::AVX512;
+  if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return InstructionSet::AVX2;
+  if(__builtin_cpu_supports("sse2"))                                    return InstructionSet::SSE2;
+#endif
+  return InstructionSet::Scalar;
+}
+
+namespace detail {
+
+inline InstructionSet&
+ActiveInstructionSet()
+{
+  static InstructionSet instruction_set = SupportedInstructionSet();
+  return instruction_set;
+}
+
+}
+
+/** Get the instruction set currently used by the dispatched kernels. */
+inline InstructionSet
+ActiveInstructionSet() { return detail::ActiveInstructionSet(); }
+
+/** Restrict the dispatched kernels to the given instruction set (clipped to what the host supports), e.g. for testing or benchmarking. */
+inline void
+SetInstructionSet(const InstructionSet instruction_set)
+{
+  detail::ActiveInstructionSet() = Min(instruction_set, SupportedInstructionSet());
+}
+
+/***************************************************************************************************************************************************************
+* Instruction Set Registers
+*
+* Registers of each instruction set provide the same operations, which round identically, so that the dispatched kernels give identical results whichever
+* instruction set is active. In particular, MultiplyAdd rounds the product and the sum separately on every instruction set, whereas FusedMultiplyAdd rounds
+* once (and is emulated where it is not native, as flagged by isFMANative).
+***************************************************************************************************************************************************************/
+
+/** Scalar fallback
+***************************************************************************************************************************************************************/
+namespace scalar {
+
+#define SIMD_INLINE [[gnu::always_inline, gnu::optimize("fp-contract=off")]] inline
+
+template<SIMDType T>
+struct Register
+{
+  using Type = T;
+  static constexpr size_t Width = 1;
+  static constexpr bool   isFMANative = false;
+
+  SIMD_INLINE static Type Zero() { return T(0); }
+  SIMD_INLINE static Type Broadcast(const T a) { return a; }
+  SIMD_INLINE static Type Load(const T* a) { return *a; }
+  SIMD_INLINE static void Store(T* out, const Type a) { *out = a; }
+  SIMD_INLINE static Type Add(const Type a, const Type b) { return a + b; }
+  SIMD_INLINE static Type Subtract(const Type a, const Type b) { return a - b; }
+  SIMD_INLINE static Type Multiply(const Type a, const Type b) { return a * b; }
+  SIMD_INLINE static Type Divide(const Type a, const Type b) { return a / b; }
+  SIMD_INLINE static Type FusedMultiplyAdd(const Type a, const Type b, const Type c) { return std::fma(a, b, c); }
+  SIMD_INLINE static Type MultiplyAdd(const Type a, const Type b, const Type c) { return a * b + c; }
+};
+
+#define SIMD_KERNEL [[gnu::optimize("fp-contract=off")]] inline
+#include "SIMD.tpp"
+#undef SIMD_KERNEL
+#undef SIMD_INLINE
+
+}
+
+#ifdef SIMD_X86
+
+/** SSE2
+***************************************************************************************************************************************************************/
+namespace sse2 {
+
+#define SIMD_INLINE [[gnu::target("sse2"), gnu::always_inline, gnu::optimize("fp-contract=off")]] inline
+
+template<SIMDType T> struct Register;
+
+template<>
+struct Register<double>
+{
+  using Type = __m128d;
+  static constexpr size_t Width = 2;
+  static constexpr bool   isFMANative = false;
+
+  SIMD_INLINE static Type Zero() { return _mm_setzero_pd(); }
+  SIMD_INLINE static Type Broadcast(const double a) { return _mm_set1_pd(a); }
+  SIMD_INLINE static Type Load(const double* a) { return _mm_loadu_pd(a); }
+  SIMD_INLINE static void Store(double* out, const Type a) { _mm_storeu_pd(out, a); }
+  SIMD_INLINE static Type Add(const Type a, const Type b) { return _mm_add_pd(a, b); }
+  SIMD_INLINE static Type Subtract(const Type a, const Type b) { return _mm_sub_pd(a, b); }
+  SIMD_INLINE static Type Multiply(const Type a, const Type b) { return _mm_mul_pd(a, b); }
+  SIMD_INLINE static Type Divide(const Type a, const Type b) { return _mm_div_pd(a, b); }
+  SIMD_INLINE static Type FusedMultiplyAdd(const Type a, const Type b, const Type c)
+  {
+    alignas(16) double x[Width], y[Width], z[Width];
+    _mm_store_pd(x, a); _mm_store_pd(y, b); _mm_store_pd(z, c);
+    FOR(i, Width) z[i] = std::fma(x[i], y[i], z[i]);
+    return _mm_load_pd(z);
+  }
+  SIMD_INLINE static Type MultiplyAdd(const Type a, const Type b, const Type c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+};
+
+template<>
+struct Register<float>
+{
+  using Type = __m128;
+  static constexpr size_t Width = 4;
+  static constexpr bool   isFMANative = false;
+
+  SIMD_INLINE static Type Zero() { return _mm_setzero_ps(); }
+  SIMD_INLINE static Type Broadcast(const float a) { return _mm_set1_ps(a); }
+  SIMD_INLINE static Type Load(const float* a) { return _mm_loadu_ps(a); }
+  SIMD_INLINE static void Store(float* out, const Type a) { _mm_storeu_ps(out, a); }
+  SIMD_INLINE static Type Add(const Type a, const Type b) { return _mm_add_ps(a, b); }
+  SIMD_INLINE static Type Subtract(const Type a, const Type b) { return _mm_sub_ps(a, b); }
+  SIMD_INLINE static Type Multiply(const Type a, const Type b) { return _mm_mul_ps(a, b); }
+  SIMD_INLINE static Type Divide(const Type a, const Type b) { return _mm_div_ps(a, b); }
+  SIMD_INLINE static Type FusedMultiplyAdd(const Type a, const Type b, const Type c)
+  {
+    alignas(16) float x[Width], y[Width], z[Width];
+    _mm_store_ps(x, a); _mm_store_ps(y, b); _mm_store_ps(z, c);
+    FOR(i, Width) z[i] = std::fma(x[i], y[i], z[i]);
+    return _mm_load_ps(z);
+  }
+  SIMD_INLINE static Type MultiplyAdd(const Type a, const Type b, const Type c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+};
+
+#define SIMD_KERNEL [[gnu::target("sse2"), gnu::optimize("fp-contract=off")]] inline
+#include "SIMD.tpp"
+#undef SIMD_KERNEL
+#undef SIMD_INLINE
+
+}
+
+/** AVX2 (with FMA)
+***************************************************************************************************************************************************************/
+namespace avx2 {
+
+#define SIMD_INLINE [[gnu::target("avx2,fma"), gnu::always_inline, gnu::optimize("fp-contract=off")]] inline
+
+template<SIMDType T> struct Register;
+
+template<>
+struct Register<double>
+{
+  using Type = __m256d;
+  static constexpr size_t Width = 4;
+  static constexpr bool   isFMANative = true;
+
+  SIMD_INLINE static Type Zero() { return _mm256_setzero_pd(); }
+  SIMD_INLINE static Type Broadcast(const double a) { return _mm256_set1_pd(a); }
+  SIMD_INLINE static Type Load(const double* a) { return _mm256_loadu_pd(a); }
+  SIMD_INLINE static void Store(double* out, const Type a) { _mm256_storeu_pd(out, a); }
+  SIMD_INLINE static Type Add(const Type a, const Type b) { return _mm256_add_pd(a, b); }
+  SIMD_INLINE static Type Subtract(const Type a, const Type b) { return _mm256_sub_pd(a, b); }
+  SIMD_INLINE static Type Multiply(const Type a, const Type b) { return _mm256_mul_pd(a, b); }
+  SIMD_INLINE static Type Divide(const Type a, const Type b) { return _mm256_div_pd(a, b); }
+  SIMD_INLINE static Type FusedMultiplyAdd(const Type a, const Type b, const Type c) { return _mm256_fmadd_pd(a, b, c); }
+  SIMD_INLINE static Type MultiplyAdd(const Type a, const Type b, const Type c) { return _mm256_add_pd(_mm256_mul_pd(a, b), c); }
+};
+
+template<>
+struct Register<float>
+{
+  using Type = __m256;
+  static constexpr size_t Width = 8;
+  static constexpr bool   isFMANative = true;
+
+  SIMD_INLINE static Type Zero() { return _mm256_setzero_ps(); }
+  SIMD_INLINE static Type Broadcast(const float a) { return _mm256_set1_ps(a); }
+  SIMD_INLINE static Type Load(const float* a) { return _mm256_loadu_ps(a); }
+  SIMD_INLINE static void Store(float* out, const Type a) { _mm256_storeu_ps(out, a); }
+  SIMD_INLINE static Type Add(const Type a, const Type b) { return _mm256_add_ps(a, b); }
+  SIMD_INLINE static Type Subtract(const Type a, const Type b) { return _mm256_sub_ps(a, b); }
+  SIMD_INLINE static Type Multiply(const Type a, const Type b) { return _mm256_mul_ps(a, b); }
+  SIMD_INLINE static Type Divide(const Type a, const Type b) { return _mm256_div_ps(a, b); }
+  SIMD_INLINE static Type FusedMultiplyAdd(const Type a, const Type b, const Type c) { return _mm256_fmadd_ps(a, b, c); }
+  SIMD_INLINE static Type MultiplyAdd(const Type a, const Type b, const Type c) { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+};
+
+#define SIMD_KERNEL [[gnu::target("avx2,fma"), gnu::optimize("fp-contract=off")]] inline
+#include "SIMD.tpp"
+#undef SIMD_KERNEL
+#undef SIMD_INLINE
+
+}
+
+/** AVX-512
+***************************************************************************************************************************************************************/
+namespace avx512 {
+
+#define SIMD_INLINE [[gnu::target("avx512f"), gnu::always_inline, gnu::optimize("fp-contract=off")]] inline
+
+template<SIMDType T> struct Register;
+
+template<>
+struct Register<double>
+{
+  using Type = __m512d;
+  static constexpr size_t Width = 8;
+  static constexpr bool   isFMANative = true;
+
+  SIMD_INLINE static Type Zero() { return _mm512_setzero_pd(); }
+  SIMD_INLINE static Type Broadcast(const double a) { return _mm512_set1_pd(a); }
+  SIMD_INLINE static Type Load(const double* a) { return _mm512_loadu_pd(a); }
+  SIMD_INLINE static void Store(double* out, const Type a) { _mm512_storeu_pd(out, a); }
+  SIMD_INLINE static Type Add(const Type a, const Type b) { return _mm512_add_pd(a, b); }
+  SIMD_INLINE static Type Subtract(const Type a, const Type b) { return _mm512_sub_pd(a, b); }
+  SIMD_INLINE static Type Multiply(const Type a, const Type b) { return _mm512_mul_pd(a, b); }
+  SIMD_INLINE static Type Divide(const Type a, const Type b) { return _mm512_div_pd(a, b); }
+  SIMD_INLINE static Type FusedMultiplyAdd(const Type a, const Type b, const Type c) { return _mm512_fmadd_pd(a, b, c); }
+  SIMD_INLINE static Type MultiplyAdd(const Type a, const Type b, const Type c) { return _mm512_add_pd(_mm512_mul_pd(a, b), c); }
+};
+
+template<>
+struct Register<float>
+{
+  using Type = __m512;
+  static constexpr size_t Width = 16;
+  static constexpr bool   isFMANative = true;
+
+  SIMD_INLINE static Type Zero() { return _mm512_setzero_ps(); }
+  SIMD_INLINE static Type Broadcast(const float a) { return _mm512_set1_ps(a); }
+  SIMD_INLINE static Type Load(const float* a) { return _mm512_loadu_ps(a); }
+  SIMD_INLINE static void Store(float* out, const Type a) { _mm512_storeu_ps(out, a); }
+  SIMD_INLINE static Type Add(const Type a, const Type b) { return _mm512_add_ps(a, b); }
+  SIMD_INLINE static Type Subtract(const Type a, const Type b) { return _mm512_sub_ps(a, b); }
+  SIMD_INLINE static Type Multiply(const Type a, const Type b) { return _mm512_mul_ps(a, b); }
+  SIMD_INLINE static Type Divide(const Type a, const Type b) { return _mm512_div_ps(a, b); }
+  SIMD_INLINE static Type FusedMultiplyAdd(const Type a, const Type b, const Type c) { return _mm512_fmadd_ps(a, b, c); }
+  SIMD_INLINE static Type MultiplyAdd(const Type a, const Type b, const Type c) { return _mm512_add_ps(_mm512_mul_ps(a, b), c); }
+};
+
+#define SIMD_KERNEL [[gnu::target("avx512f"), gnu::optimize("fp-contract=off")]] inline
+#include "SIMD.tpp"
+#undef SIMD_KERNEL
+#undef SIMD_INLINE
+
+}
+
+#endif
+
+/***************************************************************************************************************************************************************
+* Dispatched Kernels
+***************************************************************************************************************************************************************/
+
+/** Dispatch a kernel to the active instruction set. */
+#ifdef SIMD_X86
+  #define SIMD_DISPATCH(kernel, ...)                                                       \
+    switch(ActiveInstructionSet())                                                         \
+    {                                                                                      \
+      case InstructionSet::AVX512: return avx512::kernel(__VA_ARGS__);                     \
+      case InstructionSet::AVX2:   return avx2::kernel(__VA_ARGS__);                       \
+      case InstructionSet::SSE2:   return sse2::kernel(__VA_ARGS__);                       \
+      default:                     return scalar::kernel(__VA_ARGS__);                     \
+    }
+#else
+  #define SIMD_DISPATCH(kernel, ...) return scalar::kernel(__VA_ARGS__);
+#endif
+
+/** Entry-wise binary operation between two arrays, i.e. out[i] = a[i] (op) b[i]. The output may alias either input. */
+template<aprn::detail::NumericOperator op, SIMDType T>
+void
+EntryWise(const T* a, const T* b, T* out, const size_t n) { SIMD_DISPATCH(EntryWise<op>, a, b, out, n) }
+
+/** Entry-wise binary operation between an array and a scalar, i.e. out[i] = a[i] (op) b. The output may alias the input. */
+template<aprn::detail::NumericOperator op, SIMDType T>
+void
+EntryWise(const T* a, const T b, T* out, const size_t n) { SIMD_DISPATCH(EntryWise<op>, a, b, out, n) }
+
+/** Entry-wise fused multiply-add, i.e. out[i] = a[i] * b[i] + c[i] with a single rounding. */
+template<SIMDType T>
+void
+FusedMultiplyAdd(const T* a, const T* b, const T* c, T* out, const size_t n) { SIMD_DISPATCH(FusedMultiplyAdd, a, b, c, out, n) }
+
+/** Sines and cosines of the entries of an array, accurate to within one unit in the last place (of one) for |x| < 10^4 (float) or 10^9 (double). The outputs
+    must not alias the input. */
+template<SIMDType T>
+void
+SinCos(const T* x, T* sin, T* cos, const size_t n) { SIMD_DISPATCH(SinCos, x, sin, cos, n) }
+
+/** Sum of the entries of an array. */
+template<SIMDType T>
+T
+Sum(const T* a, const size_t n) { SIMD_DISPATCH(Sum, a, n) }
+
+/** Dot product of two arrays. */
+template<SIMDType T>
+T
+Dot(const T* a, const T* b, const size_t n) { SIMD_DISPATCH(Dot, a, b, n) }
+
+/** Kahan-compensated sum of the entries of an array, whose error is independent of the array size to first order. */
+template<SIMDType T>
+T
+CompensatedSum(const T* a, const size_t n) { SIMD_DISPATCH(CompensatedSum, a, n) }
+
+/** Dot product of two arrays, with Kahan-compensated summation of the products. */
+template<SIMDType T>
+T
+CompensatedDot(const T* a, const T* b, const size_t n) { SIMD_DISPATCH(CompensatedDot, a, b, n) }
+
+/** Sum of the squared entries of an array. */
+template<SIMDType T>
+T
+SumOfSquares(const T* a, const size_t n) { return Dot(a, a, n); }
+
+/** Rows and columns of the register tile of the matrix multiplication kernel, to which packed blocks must be padded. */
+template<SIMDType T>
+std::pair<size_t, size_t>
+GEMMTile() { SIMD_DISPATCH(GEMMTile<T>) }
+
+/** Product of a packed m x kc block of A and a packed kc x n block of B, stored in, or added to, the m x n block of the column-major matrix C. */
+template<SIMDType T>
+void
+GEMMBlock(const size_t m, const size_t n, const size_t kc, const T* a, const T* b, T* c, const size_t ldc, const bool accumulate)
+{
+  SIMD_DISPATCH(GEMMBlock, m, n, kc, a, b, c, ldc, accumulate)
+}
+
+#undef SIMD_DISPATCH
+
+}//aprn::simd
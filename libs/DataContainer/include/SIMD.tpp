@@ -0,0 +1,324 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+/** Instruction set agnostic kernels. This file is included once per instruction set in SIMD.h, within a namespace that defines Register<T>, SIMD_INLINE,
+    and SIMD_KERNEL for that instruction set. Remainder entries are processed with a scalar register, so results never depend on the register width. */
+
+/***************************************************************************************************************************************************************
+* Register Operations
+***************************************************************************************************************************************************************/
+template<aprn::detail::NumericOperator op, class Reg>
+SIMD_INLINE typename Reg::Type
+Apply(const typename Reg::Type a, const typename Reg::Type b)
+{
+  using enum aprn::detail::NumericOperator;
+  if constexpr(op == Plus)     return Reg::Add(a, b);
+  if constexpr(op == Minus)    return Reg::Subtract(a, b);
+  if constexpr(op == Multiply) return Reg::Multiply(a, b);
+  if constexpr(op == Divide)   return Reg::Divide(a, b);
+}
+
+/** Single-entry register used for remainder entries. */
+template<SIMDType T>
+using ScalarRegister = aprn::simd::scalar::Register<T>;
+
+/***************************************************************************************************************************************************************
+* Entry-wise Kernels
+***************************************************************************************************************************************************************/
+template<aprn::detail::NumericOperator op, SIMDType T>
+SIMD_KERNEL void
+EntryWise(const T* a, const T* b, T* out, const size_t n)
+{
+  using Reg = Register<T>;
+  size_t i = 0;
+  for(; i + Reg::Width <= n; i += Reg::Width) Reg::Store(out + i, Apply<op, Reg>(Reg::Load(a + i), Reg::Load(b + i)));
+  for(; i < n; ++i) out[i] = Apply<op, ScalarRegister<T>>(a[i], b[i]);
+}
+
+template<aprn::detail::NumericOperator op, SIMDType T>
+SIMD_KERNEL void
+EntryWise(const T* a, const T b, T* out, const size_t n)
+{
+  using Reg = Register<T>;
+  const auto b_reg = Reg::Broadcast(b);
+  size_t i = 0;
+  for(; i + Reg::Width <= n; i += Reg::Width) Reg::Store(out + i, Apply<op, Reg>(Reg::Load(a + i), b_reg));
+  for(; i < n; ++i) out[i] = Apply<op, ScalarRegister<T>>(a[i], b);
+}
+
+template<SIMDType T>
+SIMD_KERNEL void
+FusedMultiplyAdd(const T* a, const T* b, const T* c, T* out, const size_t n)
+{
+  using Reg = Register<T>;
+  size_t i = 0;
+  for(; i + Reg::Width <= n; i += Reg::Width) Reg::Store(out + i, Reg::FusedMultiplyAdd(Reg::Load(a + i), Reg::Load(b + i), Reg::Load(c + i)));
+  for(; i < n; ++i) out[i] = std::fma(a[i], b[i], c[i]);
+}
+
+/***************************************************************************************************************************************************************
+* Elementary Function Kernels
+***************************************************************************************************************************************************************/
+
+/** Round to the nearest integer, for |a| < 2^22 (float) or 2^51 (double), by adding and subtracting 1.5 * 2^(mantissa bits), at which the spacing of
+    floating-point numbers is one. */
+template<SIMDType T, class Reg>
+SIMD_INLINE typename Reg::Type
+RoundToInteger(const typename Reg::Type a)
+{
+  const auto shift = Reg::Broadcast(isTypeSame<T, float>() ? T(12582912.0) : T(6755399441055744.0));
+  return Reg::Subtract(Reg::Add(a, shift), shift);
+}
+
+/** Sine and cosine, from the reduction of the argument by the nearest multiple qπ/2 (split into three parts, after Cody and Waite) to [-π/4, π/4], where
+    they are approximated by the minimax polynomials of Cephes, and whose roles and signs are then swapped according to q mod 4. The quadrant is selected
+    arithmetically (by multiplying by exactly 0 or 1), so that only the basic register operations are needed. */
+template<SIMDType T, class Reg>
+SIMD_INLINE void
+SinCosRegister(const typename Reg::Type x, typename Reg::Type& sin, typename Reg::Type& cos)
+{
+  constexpr bool is_float = isTypeSame<T, float>();
+  const auto one  = Reg::Broadcast(T(1));
+  const auto two  = Reg::Broadcast(T(2));
+  const auto half = Reg::Broadcast(T(0.5));
+
+  // Reduce the argument, and find the quadrant, m = q mod 4, and its parities (as floor(y) = round(y - 1/4) for y in {0, 1/2, 1, 3/2}).
+  const auto q = RoundToInteger<T, Reg>(Reg::Multiply(x, Reg::Broadcast(T(0.636619772367581343076))));
+  auto r = Reg::MultiplyAdd(q, Reg::Broadcast(is_float ? T(-1.5703125) : T(-1.57079625129699707031)), x);
+  r = Reg::MultiplyAdd(q, Reg::Broadcast(is_float ? T(-4.837512969970703125e-4) : T(-7.54978941586159635335e-8)), r);
+  r = Reg::MultiplyAdd(q, Reg::Broadcast(is_float ? T(-7.54978995489188216e-8) : T(-5.39030285815811905290e-15)), r);
+
+  const auto quarter_q = RoundToInteger<T, Reg>(Reg::Subtract(Reg::Multiply(q, Reg::Broadcast(T(0.25))), Reg::Broadcast(T(0.375))));
+  const auto m         = Reg::Subtract(q, Reg::Multiply(Reg::Broadcast(T(4)), quarter_q));
+  const auto half_m    = RoundToInteger<T, Reg>(Reg::Subtract(Reg::Multiply(m, half), Reg::Broadcast(T(0.25))));
+  const auto is_odd    = Reg::Subtract(m, Reg::Multiply(two, half_m));
+  const auto is_even   = Reg::Subtract(one, is_odd);
+  const auto half_m1   = Reg::Subtract(Reg::Add(half_m, is_odd), Reg::Multiply(two, Reg::Multiply(half_m, is_odd))); // floor(((m + 1) mod 4) / 2)
+
+  // Polynomial approximations on [-π/4, π/4].
+  const auto z = Reg::Multiply(r, r);
+  typename Reg::Type sin_r, cos_r;
+  if constexpr(is_float)
+  {
+    auto p = Reg::MultiplyAdd(Reg::Broadcast(T(-1.9515295891e-4)), z, Reg::Broadcast(T(8.3321608736e-3)));
+    p = Reg::MultiplyAdd(p, z, Reg::Broadcast(T(-1.6666654611e-1)));
+    sin_r = Reg::MultiplyAdd(Reg::Multiply(p, z), r, r);
+
+    p = Reg::MultiplyAdd(Reg::Broadcast(T(2.443315711809948e-5)), z, Reg::Broadcast(T(-1.388731625493765e-3)));
+    p = Reg::MultiplyAdd(p, z, Reg::Broadcast(T(4.166664568298827e-2)));
+    cos_r = Reg::MultiplyAdd(Reg::Multiply(p, z), z, Reg::Subtract(one, Reg::Multiply(half, z)));
+  }
+  else
+  {
+    constexpr T sin_coefficients[]{1.58962301576546568060e-10, -2.50507477628578072866e-8, 2.75573136213857245213e-6, -1.98412698295895385996e-4,
+                                   8.33333333332211858878e-3, -1.66666666666666307295e-1};
+    constexpr T cos_coefficients[]{-1.13585365213876817300e-11, 2.08757008419747316778e-9, -2.75573141792967388112e-7, 2.48015872888517045348e-5,
+                                   -1.38888888888730564116e-3, 4.16666666666665929218e-2};
+    auto p = Reg::Broadcast(sin_coefficients[0]);
+    FOR(k, 1, 6) p = Reg::MultiplyAdd(p, z, Reg::Broadcast(sin_coefficients[k]));
+    sin_r = Reg::MultiplyAdd(Reg::Multiply(p, z), r, r);
+
+    p = Reg::Broadcast(cos_coefficients[0]);
+    FOR(k, 1, 6) p = Reg::MultiplyAdd(p, z, Reg::Broadcast(cos_coefficients[k]));
+    cos_r = Reg::MultiplyAdd(Reg::Multiply(p, z), z, Reg::Subtract(one, Reg::Multiply(half, z)));
+  }
+
+  // sin(x) = (s, c, -s, -c) and cos(x) = (c, -s, -c, s) for m = (0, 1, 2, 3).
+  const auto sin_sign = Reg::Subtract(one, Reg::Multiply(two, half_m));
+  const auto cos_sign = Reg::Subtract(one, Reg::Multiply(two, half_m1));
+  sin = Reg::Multiply(sin_sign, Reg::Add(Reg::Multiply(is_even, sin_r), Reg::Multiply(is_odd, cos_r)));
+  cos = Reg::Multiply(cos_sign, Reg::Add(Reg::Multiply(is_even, cos_r), Reg::Multiply(is_odd, sin_r)));
+}
+
+template<SIMDType T>
+SIMD_KERNEL void
+SinCos(const T* x, T* sin, T* cos, const size_t n)
+{
+  using Reg = Register<T>;
+  typename Reg::Type sin_x, cos_x;
+  size_t i = 0;
+  for(; i + Reg::Width <= n; i += Reg::Width)
+  {
+    SinCosRegister<T, Reg>(Reg::Load(x + i), sin_x, cos_x);
+    Reg::Store(sin + i, sin_x);
+    Reg::Store(cos + i, cos_x);
+  }
+  for(; i < n; ++i) SinCosRegister<T, ScalarRegister<T>>(x[i], sin[i], cos[i]);
+}
+
+/***************************************************************************************************************************************************************
+* Reduction Kernels
+***************************************************************************************************************************************************************/
+
+/** Entries are accumulated into ReductionLanes<T> partial sums (entry i into partial sum i % ReductionLanes<T>), which are then combined pairwise. The
+    summation order is therefore independent of the register width. */
+template<bool is_dot, SIMDType T>
+SIMD_KERNEL T
+Reduce(const T* a, const T* b, const size_t n)
+{
+  using Reg = Register<T>;
+  constexpr size_t lanes     = ReductionLanes<T>;
+  constexpr size_t registers = lanes / Reg::Width;
+
+  typename Reg::Type sums[registers];
+  FOR(k, registers) sums[k] = Reg::Zero();
+
+  size_t i = 0;
+  for(; i + lanes <= n; i += lanes)
+    FOR(k, registers)
+    {
+      const auto entry = is_dot ? Reg::Multiply(Reg::Load(a + i + k * Reg::Width), Reg::Load(b + i + k * Reg::Width)) : Reg::Load(a + i + k * Reg::Width);
+      sums[k] = Reg::Add(sums[k], entry);
+    }
+
+  alignas(64) T partial[lanes];
+  FOR(k, registers) Reg::Store(partial + k * Reg::Width, sums[k]);
+  for(size_t j = 0; i < n; ++i, ++j) partial[j] += is_dot ? a[i] * b[i] : a[i];
+
+  for(size_t stride = lanes / 2; stride > 0; stride /= 2) FOR(j, stride) partial[j] += partial[j + stride];
+  return partial[0];
+}
+
+/** Kahan-compensated variant of Reduce, which keeps a running compensation for each partial sum. The partial sums are then combined pairwise with
+    Knuth's TwoSum, so that the rounding errors of the combination are also retained. Products (for dot products) are not compensated. */
+template<bool is_dot, SIMDType T>
+SIMD_KERNEL T
+CompensatedReduce(const T* a, const T* b, const size_t n)
+{
+  using Reg = Register<T>;
+  constexpr size_t lanes     = ReductionLanes<T>;
+  constexpr size_t registers = lanes / Reg::Width;
+
+  typename Reg::Type sums[registers], compensations[registers];
+  FOR(k, registers) sums[k] = compensations[k] = Reg::Zero();
+
+  size_t i = 0;
+  for(; i + lanes <= n; i += lanes)
+    FOR(k, registers)
+    {
+      const auto entry = is_dot ? Reg::Multiply(Reg::Load(a + i + k * Reg::Width), Reg::Load(b + i + k * Reg::Width)) : Reg::Load(a + i + k * Reg::Width);
+      const auto y = Reg::Subtract(entry, compensations[k]);
+      const auto t = Reg::Add(sums[k], y);
+      compensations[k] = Reg::Subtract(Reg::Subtract(t, sums[k]), y);
+      sums[k] = t;
+    }
+
+  alignas(64) T partial[lanes], compensation[lanes];
+  FOR(k, registers)
+  {
+    Reg::Store(partial + k * Reg::Width, sums[k]);
+    Reg::Store(compensation + k * Reg::Width, compensations[k]);
+  }
+  for(size_t j = 0; i < n; ++i, ++j)
+  {
+    const T y = (is_dot ? a[i] * b[i] : a[i]) - compensation[j];
+    const T t = partial[j] + y;
+    compensation[j] = (t - partial[j]) - y;
+    partial[j] = t;
+  }
+
+  for(size_t stride = lanes / 2; stride > 0; stride /= 2)
+    FOR(j, stride)
+    {
+      const T sum   = partial[j] + partial[j + stride];
+      const T b_sum = sum - partial[j];
+      const T error = (partial[j] - (sum - b_sum)) + (partial[j + stride] - b_sum);
+      compensation[j] = compensation[j] + compensation[j + stride] - error;
+      partial[j] = sum;
+    }
+  return partial[0] - compensation[0];
+}
+
+template<SIMDType T>
+SIMD_KERNEL T
+Sum(const T* a, const size_t n) { return Reduce<false>(a, a, n); }
+
+template<SIMDType T>
+SIMD_KERNEL T
+CompensatedSum(const T* a, const size_t n) { return CompensatedReduce<false>(a, a, n); }
+
+template<SIMDType T>
+SIMD_KERNEL T
+CompensatedDot(const T* a, const T* b, const size_t n) { return CompensatedReduce<true>(a, b, n); }
+
+template<SIMDType T>
+SIMD_KERNEL T
+Dot(const T* a, const T* b, const size_t n) { return Reduce<true>(a, b, n); }
+
+/***************************************************************************************************************************************************************
+* Matrix Multiplication Kernels
+***************************************************************************************************************************************************************/
+
+/** Register tile of the matrix multiplication micro-kernel, i.e. the number of rows (a multiple of the register width) and columns of the product that are
+    accumulated in registers. Two registers per column (four for scalar registers) leave enough registers for the loaded operands. */
+template<SIMDType T>
+constexpr size_t GEMMTileRows = Register<T>::Width == 1 ? 4 : 2 * Register<T>::Width;
+
+constexpr size_t GEMMTileColumns = 6;
+
+/** Micro-kernel computing the product of a packed row panel of A (kc columns of GEMMTileRows entries) and a packed column panel of B (kc rows of
+    GEMMTileColumns entries), which is stored in, or added to, the m x n (partial) tile of the column-major matrix C. For speed, products are accumulated
+    with fused multiply-adds where they are native, so that, unlike the other kernels, matrix products may round differently between instruction sets. */
+template<SIMDType T>
+SIMD_INLINE void
+GEMMMicroKernel(const size_t kc, const T* a, const T* b, T* c, const size_t ldc, const size_t m, const size_t n, const bool accumulate)
+{
+  using Reg = Register<T>;
+  constexpr size_t tile_rows = GEMMTileRows<T>;
+  constexpr size_t registers = tile_rows / Reg::Width;
+
+  typename Reg::Type products[GEMMTileColumns][registers];
+  FOR(j, GEMMTileColumns) FOR(i, registers) products[j][i] = Reg::Zero();
+
+  for(size_t p = 0; p < kc; ++p, a += tile_rows, b += GEMMTileColumns)
+  {
+    typename Reg::Type a_column[registers];
+    FOR(i, registers) a_column[i] = Reg::Load(a + i * Reg::Width);
+    FOR(j, GEMMTileColumns)
+    {
+      const auto b_entry = Reg::Broadcast(b[j]);
+      if constexpr(Reg::isFMANative) FOR(i, registers) products[j][i] = Reg::FusedMultiplyAdd(a_column[i], b_entry, products[j][i]);
+      else FOR(i, registers) products[j][i] = Reg::MultiplyAdd(a_column[i], b_entry, products[j][i]);
+    }
+  }
+
+  if(m == tile_rows && n == GEMMTileColumns)
+  {
+    FOR(j, GEMMTileColumns) FOR(i, registers)
+    {
+      T* c_entries = c + j * ldc + i * Reg::Width;
+      Reg::Store(c_entries, accumulate ? Reg::Add(Reg::Load(c_entries), products[j][i]) : products[j][i]);
+    }
+    return;
+  }
+
+  alignas(64) T tile[GEMMTileColumns * tile_rows];
+  FOR(j, GEMMTileColumns) FOR(i, registers) Reg::Store(tile + j * tile_rows + i * Reg::Width, products[j][i]);
+  FOR(j, n) FOR(i, m) c[j * ldc + i] = accumulate ? c[j * ldc + i] + tile[j * tile_rows + i] : tile[j * tile_rows + i];
+}
+
+/** Macro-kernel computing the product of a packed m x kc block of A and a packed kc x n block of B (see gemm::Multiply for the packing order), which is
+    stored in, or added to, the m x n block of the column-major matrix C. */
+template<SIMDType T>
+SIMD_KERNEL void
+GEMMBlock(const size_t m, const size_t n, const size_t kc, const T* a, const T* b, T* c, const size_t ldc, const bool accumulate)
+{
+  for(size_t j = 0; j < n; j += GEMMTileColumns)
+    for(size_t i = 0; i < m; i += GEMMTileRows<T>)
+      GEMMMicroKernel(kc, a + i * kc, b + j * kc, c + j * ldc + i, ldc, Min(GEMMTileRows<T>, m - i), Min(GEMMTileColumns, n - j), accumulate);
+}
+
+template<SIMDType T>
+SIMD_KERNEL std::pair<size_t, size_t>
+GEMMTile() { return {GEMMTileRows<T>, GEMMTileColumns}; }
@@ -0,0 +1,165 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "Array.h"
+
+#include <memory>
+#include <utility>
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Small Array Class
+***************************************************************************************************************************************************************/
+
+/** Dynamic array which stores up to N entries inline, and only allocates on the heap once it grows beyond N entries. Iterators, pointers and references
+    are invalidated by any operation that changes the capacity, and by moves of inline (i.e. not heap-allocated) arrays. */
+template<typename T, size_t N>
+class SmallArray : public Array<T, SmallArray<T, N>>
+{
+   static_assert(N > 0, "The inline capacity of a small array must be positive.");
+
+   using Base = Array<T, SmallArray<T, N>>;
+
+ public:
+   using value_type      = T;
+   using size_type       = size_t;
+   using difference_type = std::ptrdiff_t;
+   using reference       = T&;
+   using const_reference = const T&;
+   using pointer         = T*;
+   using const_pointer   = const T*;
+   using iterator        = T*;
+   using const_iterator  = const T*;
+
+   /** Constructors/Destructor */
+   SmallArray() noexcept;
+
+   explicit SmallArray(const size_t size);
+
+   SmallArray(const size_t size, const std::convertible_to<T> auto& value);
+
+   template<std::convertible_to<T> T2>
+   SmallArray(const std::initializer_list<T2>& list);
+
+   template<std::input_iterator It>
+   SmallArray(It first, It last);
+
+   SmallArray(const SmallArray& other);
+
+   SmallArray(SmallArray&& other) noexcept;
+
+   ~SmallArray();
+
+   /** Copy/Move Assignment */
+   SmallArray& operator=(const SmallArray& other);
+
+   SmallArray& operator=(SmallArray&& other) noexcept;
+
+   /** Size and Capacity */
+   size_t size() const noexcept { return Size_; }
+
+   size_t capacity() const noexcept { return Capacity_; }
+
+   bool empty() const noexcept { return Size_ == 0; }
+
+   /** Check whether the entries are stored inline, i.e. without a heap allocation. */
+   bool isInline() const noexcept { return Data_ == InlineData(); }
+
+   void reserve(const size_t capacity);
+
+   void resize(const size_t size);
+
+   void resize(const size_t size, const T& value);
+
+   void shrink_to_fit();
+
+   /** Data Access */
+   T* data() noexcept { return Data_; }
+
+   const T* data() const noexcept { return Data_; }
+
+   T& front() { return (*this)[0]; }
+
+   const T& front() const { return (*this)[0]; }
+
+   T& back() { return (*this)[Size_ - 1]; }
+
+   const T& back() const { return (*this)[Size_ - 1]; }
+
+   /** Iterators */
+   iterator begin() noexcept { return Data_; }
+
+   const_iterator begin() const noexcept { return Data_; }
+
+   const_iterator cbegin() const noexcept { return Data_; }
+
+   iterator end() noexcept { return Data_ + Size_; }
+
+   const_iterator end() const noexcept { return Data_ + Size_; }
+
+   const_iterator cend() const noexcept { return Data_ + Size_; }
+
+   /** Modifiers */
+   template<class... Args>
+   T& emplace_back(Args&&... args);
+
+   void push_back(const T& value) { emplace_back(value); }
+
+   void push_back(T&& value) { emplace_back(std::move(value)); }
+
+   void pop_back();
+
+   void clear() noexcept;
+
+   void Append(const T& value);
+
+   void Append(T&& value);
+
+   void Append(const SmallArray& other);
+
+   void Append(SmallArray&& other);
+
+   /** Append a range of entries, which must not be taken from this array. */
+   template<class It>
+   void Append(It first, It last, const bool move_all = false);
+
+   void Erase();
+
+   using Base::operator[];
+   using Base::operator=;
+
+ private:
+   T* InlineData() noexcept { return reinterpret_cast<T*>(Buffer_); }
+
+   const T* InlineData() const noexcept { return reinterpret_cast<const T*>(Buffer_); }
+
+   /** Move the entries into storage of the given capacity (inline storage if it fits). */
+   void Reallocate(const size_t capacity);
+
+   /** Take over the entries of another array, leaving it empty. */
+   void MoveFrom(SmallArray&& other) noexcept;
+
+   alignas(T) std::byte Buffer_[N * sizeof(T)];
+   T*     Data_;
+   size_t Size_{0};
+   size_t Capacity_{N};
+};
+
+}
+
+#include "SmallArray.tpp"
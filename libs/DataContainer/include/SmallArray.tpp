@@ -0,0 +1,239 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Small Array Class
+***************************************************************************************************************************************************************/
+
+/** Constructors/Destructor */
+template<typename T, size_t N>
+SmallArray<T, N>::SmallArray() noexcept
+   : Data_(InlineData()) {}
+
+template<typename T, size_t N>
+SmallArray<T, N>::SmallArray(const size_t size)
+   : SmallArray(size, DynamicInitValue<T>()) {}
+
+template<typename T, size_t N>
+SmallArray<T, N>::SmallArray(const size_t size, const std::convertible_to<T> auto& value)
+   : SmallArray() { resize(size, static_cast<T>(value)); }
+
+template<typename T, size_t N>
+template<std::convertible_to<T> T2>
+SmallArray<T, N>::SmallArray(const std::initializer_list<T2>& list)
+   : SmallArray(list.begin(), list.end()) {}
+
+template<typename T, size_t N>
+template<std::input_iterator It>
+SmallArray<T, N>::SmallArray(It first, It last)
+   : SmallArray() { Append(first, last); }
+
+template<typename T, size_t N>
+SmallArray<T, N>::SmallArray(const SmallArray& other)
+   : SmallArray() { Append(other); }
+
+template<typename T, size_t N>
+SmallArray<T, N>::SmallArray(SmallArray&& other) noexcept
+   : SmallArray() { MoveFrom(std::move(other)); }
+
+template<typename T, size_t N>
+SmallArray<T, N>::~SmallArray() { Erase(); }
+
+/** Copy/Move Assignment */
+template<typename T, size_t N>
+SmallArray<T, N>&
+SmallArray<T, N>::operator=(const SmallArray& other)
+{
+   if(this != &other)
+   {
+      clear();
+      Append(other);
+   }
+   return *this;
+}
+
+template<typename T, size_t N>
+SmallArray<T, N>&
+SmallArray<T, N>::operator=(SmallArray&& other) noexcept
+{
+   if(this != &other)
+   {
+      Erase();
+      MoveFrom(std::move(other));
+   }
+   return *this;
+}
+
+/** Size and Capacity */
+template<typename T, size_t N>
+void
+SmallArray<T, N>::reserve(const size_t capacity) { if(capacity > Capacity_) Reallocate(capacity); }
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::resize(const size_t size)
+{
+   if(size < Size_) std::destroy(begin() + size, end());
+   else
+   {
+      reserve(size);
+      std::uninitialized_value_construct(end(), begin() + size);
+   }
+   Size_ = size;
+}
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::resize(const size_t size, const T& value)
+{
+   if(size < Size_) std::destroy(begin() + size, end());
+   else if(size > Size_)
+   {
+      // Copy the value first, as it may refer to an entry that is moved by the reallocation.
+      const T entry = value;
+      reserve(size);
+      std::uninitialized_fill(end(), begin() + size, entry);
+   }
+   Size_ = size;
+}
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::shrink_to_fit() { if(!isInline() && Size_ < Capacity_) Reallocate(Size_); }
+
+/** Modifiers */
+template<typename T, size_t N>
+template<class... Args>
+T&
+SmallArray<T, N>::emplace_back(Args&&... args)
+{
+   if(Size_ == Capacity_)
+   {
+      // Construct the entry first, as the arguments may refer to entries that are moved by the reallocation.
+      T entry(std::forward<Args>(args)...);
+      Reallocate(2 * Capacity_);
+      return *std::construct_at(Data_ + Size_++, std::move(entry));
+   }
+   return *std::construct_at(Data_ + Size_++, std::forward<Args>(args)...);
+}
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::pop_back()
+{
+   DEBUG_ASSERT(!empty(), "Cannot remove an entry from an empty array.")
+   std::destroy_at(Data_ + --Size_);
+}
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::clear() noexcept
+{
+   std::destroy(begin(), end());
+   Size_ = 0;
+}
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::Append(const T& value) { push_back(value); }
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::Append(T&& value) { push_back(std::move(value)); }
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::Append(const SmallArray& other) { Append(other.begin(), other.end(), false); }
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::Append(SmallArray&& other) { Append(other.begin(), other.end(), true); }
+
+template<typename T, size_t N>
+template<class It>
+void
+SmallArray<T, N>::Append(It first, It last, const bool move_all)
+{
+   // Single-pass ranges (e.g. of stream iterators) cannot be counted beforehand, and so are appended one entry at a time.
+   if constexpr(!std::forward_iterator<It>)
+   {
+      for(; first != last; ++first)
+      {
+         if(!move_all) emplace_back(*first);
+         else          emplace_back(std::move(*first));
+      }
+   }
+   else
+   {
+      const auto count = static_cast<size_t>(std::distance(first, last));
+      if(Size_ + count > Capacity_) Reallocate(Max(Size_ + count, 2 * Capacity_));
+
+      if(!move_all) std::uninitialized_copy(first, last, end());
+      else          std::uninitialized_move(first, last, end());
+      Size_ += count;
+   }
+}
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::Erase()
+{
+   clear();
+   if(!isInline()) std::allocator<T>().deallocate(Data_, Capacity_);
+   Data_     = InlineData();
+   Capacity_ = N;
+}
+
+/** Private Helpers */
+template<typename T, size_t N>
+void
+SmallArray<T, N>::Reallocate(const size_t capacity)
+{
+   DEBUG_ASSERT(Size_ <= capacity, "The capacity ", capacity, " cannot be lesser than the array size ", Size_, ".")
+
+   const bool is_inline = capacity <= N;
+   T* data = is_inline ? InlineData() : std::allocator<T>().allocate(capacity);
+   if(data == Data_) return;
+
+   std::uninitialized_move(begin(), end(), data);
+   std::destroy(begin(), end());
+   if(!isInline()) std::allocator<T>().deallocate(Data_, Capacity_);
+
+   Data_     = data;
+   Capacity_ = is_inline ? N : capacity;
+}
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::MoveFrom(SmallArray&& other) noexcept
+{
+   if(other.isInline())
+   {
+      std::uninitialized_move(other.begin(), other.end(), Data_);
+      Size_ = other.Size_;
+      other.clear();
+   }
+   else
+   {
+      Data_     = std::exchange(other.Data_, other.InlineData());
+      Size_     = std::exchange(other.Size_, 0);
+      Capacity_ = std::exchange(other.Capacity_, N);
+   }
+}
+
+}
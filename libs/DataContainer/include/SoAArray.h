@@ -0,0 +1,214 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "Allocator.h"
+#include "Array.h"
+
+#include <span>
+#include <tuple>
+#include <utility>
+
+namespace aprn {
+
+template<class... Fields> class SoAArray;
+
+/***************************************************************************************************************************************************************
+* Structure-of-arrays Iterator
+***************************************************************************************************************************************************************/
+
+/** Random-access iterator over the records of a structure-of-arrays, which dereferences to a tuple of references to the record's fields. As the references
+    are proxies, the iterator only models an input iterator for the legacy iterator categories (like the iterators of zip views). */
+template<bool is_const, class... Fields>
+class SoAIterator
+{
+   using ArrayType = std::conditional_t<is_const, const SoAArray<Fields...>, SoAArray<Fields...>>;
+
+ public:
+   using iterator_concept  = std::random_access_iterator_tag;
+   using iterator_category = std::input_iterator_tag;
+   using value_type        = std::tuple<Fields...>;
+   using difference_type   = std::ptrdiff_t;
+   using reference         = std::conditional_t<is_const, std::tuple<const Fields&...>, std::tuple<Fields&...>>;
+
+   SoAIterator() = default;
+
+   SoAIterator(ArrayType* array, const size_t index)
+      : Array_(array), Index_(index) {}
+
+   /** Conversion of a mutable iterator to a const iterator. */
+   operator SoAIterator<true, Fields...>() const requires (!is_const) { return {Array_, Index_}; }
+
+   reference operator*() const { return Array_->Record(Index_); }
+
+   reference operator[](const difference_type n) const { return *(*this + n); }
+
+   SoAIterator& operator++() { ++Index_; return *this; }
+
+   SoAIterator& operator--() { --Index_; return *this; }
+
+   SoAIterator operator++(int) { auto it = *this; ++Index_; return it; }
+
+   SoAIterator operator--(int) { auto it = *this; --Index_; return it; }
+
+   SoAIterator& operator+=(const difference_type n) { Index_ = static_cast<size_t>(static_cast<difference_type>(Index_) + n); return *this; }
+
+   SoAIterator& operator-=(const difference_type n) { return *this += -n; }
+
+   SoAIterator operator+(const difference_type n) const { auto it = *this; return it += n; }
+
+   SoAIterator operator-(const difference_type n) const { auto it = *this; return it -= n; }
+
+   difference_type operator-(const SoAIterator& other) const
+   { return static_cast<difference_type>(Index_) - static_cast<difference_type>(other.Index_); }
+
+   bool operator==(const SoAIterator& other) const { return Index_ == other.Index_; }
+
+   auto operator<=>(const SoAIterator& other) const { return Index_ <=> other.Index_; }
+
+   friend SoAIterator operator+(const difference_type n, const SoAIterator& it) { return it + n; }
+
+   /** Index of the addressed record. */
+   size_t Index() const { return Index_; }
+
+ private:
+   ArrayType* Array_{nullptr};
+   size_t     Index_{0};
+};
+
+/***************************************************************************************************************************************************************
+* Structure-of-arrays Class
+***************************************************************************************************************************************************************/
+
+/** Dynamic array of records, whose fields are each stored in a separate contiguous (cache line-aligned) array, rather than interleaved record by record.
+    A pass over a subset of the fields hence only loads those fields, and each field can be processed as a contiguous span, e.g. by the SIMD kernels. For
+    convenience, records can still be accessed as tuples of references to their fields, e.g.
+
+      SoAArray<SVectorR3, SVectorR3, Real> particles(n);
+      for(auto [position, velocity, mass] : particles) position += time_step * velocity;
+
+    Fields are addressed by their index, or by their type if it is unique among the fields. */
+template<class... Fields>
+class SoAArray
+{
+   static_assert(sizeof...(Fields) > 0, "A structure-of-arrays must have at least one field.");
+
+   template<size_t I>
+   using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+   /** Index of a field type, which must be unique among the fields. */
+   template<class F>
+   static constexpr size_t FieldIndex()
+   {
+      constexpr std::array<bool, sizeof...(Fields)> is_match{isTypeSame<F, Fields>()...};
+      static_assert((isTypeSame<F, Fields>() + ...) == 1, "The field type must occur exactly once among the fields.");
+      return std::find(is_match.begin(), is_match.end(), true) - is_match.begin();
+   }
+
+ public:
+   using value_type      = std::tuple<Fields...>;
+   using size_type       = size_t;
+   using difference_type = std::ptrdiff_t;
+   using reference       = std::tuple<Fields&...>;
+   using const_reference = std::tuple<const Fields&...>;
+   using iterator        = SoAIterator<false, Fields...>;
+   using const_iterator  = SoAIterator<true, Fields...>;
+
+   static constexpr size_t nFields{sizeof...(Fields)};
+
+   /** Constructors */
+   SoAArray() = default;
+
+   explicit SoAArray(const size_t size);
+
+   SoAArray(const size_t size, const Fields&... values);
+
+   /** Size and Index Range-checking */
+   size_t size() const noexcept { return std::get<0>(Fields_).size(); }
+
+   bool empty() const noexcept { return size() == 0; }
+
+   size_t capacity() const noexcept { return std::get<0>(Fields_).capacity(); }
+
+   void IndexBoundCheck(const size_t index) const
+   {
+      DEBUG_ASSERT(!empty(), "The array has not yet been sized.")
+      DEBUG_ASSERT(isBounded(index, size_t(0), size()), "The array index ", index, " must be in the range [0, ", size() - 1, "].")
+   }
+
+   /** Field Access. Spans are invalidated by any operation that changes the capacity. */
+   template<size_t I>
+   std::span<FieldType<I>> Field() noexcept { return std::get<I>(Fields_); }
+
+   template<size_t I>
+   std::span<const FieldType<I>> Field() const noexcept { return std::get<I>(Fields_); }
+
+   template<class F>
+   std::span<F> Field() noexcept { return Field<FieldIndex<F>()>(); }
+
+   template<class F>
+   std::span<const F> Field() const noexcept { return Field<FieldIndex<F>()>(); }
+
+   /** Record Access */
+   reference operator[](const size_t index) { IndexBoundCheck(index); return Record(index); }
+
+   const_reference operator[](const size_t index) const { IndexBoundCheck(index); return Record(index); }
+
+   reference front() { return (*this)[0]; }
+
+   const_reference front() const { return (*this)[0]; }
+
+   reference back() { return (*this)[size() - 1]; }
+
+   const_reference back() const { return (*this)[size() - 1]; }
+
+   /** Modifiers */
+   void Resize(const size_t size);
+
+   void Reserve(const size_t capacity);
+
+   void Append(const Fields&... values);
+
+   void Append(const value_type& record) { std::apply([this](const Fields&... values){ Append(values...); }, record); }
+
+   void Erase(const size_t index);
+
+   void clear() noexcept;
+
+   /** Iterators */
+   iterator begin() noexcept { return {this, 0}; }
+
+   const_iterator begin() const noexcept { return {this, 0}; }
+
+   iterator end() noexcept { return {this, size()}; }
+
+   const_iterator end() const noexcept { return {this, size()}; }
+
+ private:
+   reference Record(const size_t index) { return std::apply([index](auto&... fields){ return reference(fields[index]...); }, Fields_); }
+
+   const_reference Record(const size_t index) const
+   { return std::apply([index](const auto&... fields){ return const_reference(fields[index]...); }, Fields_); }
+
+   std::tuple<AlignedArray<Fields>...> Fields_;
+
+   friend iterator;
+   friend const_iterator;
+};
+
+}
+
+#include "SoAArray.tpp"
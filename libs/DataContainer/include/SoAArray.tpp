@@ -0,0 +1,68 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Structure-of-arrays Class
+***************************************************************************************************************************************************************/
+
+/** Constructors */
+template<class... Fields>
+SoAArray<Fields...>::SoAArray(const size_t size) { Resize(size); }
+
+template<class... Fields>
+SoAArray<Fields...>::SoAArray(const size_t size, const Fields&... values)
+   : Fields_(AlignedArray<Fields>(size, values)...) {}
+
+/** Modifiers */
+template<class... Fields>
+void
+SoAArray<Fields...>::Resize(const size_t size)
+{
+   std::apply([size](auto&... fields){ (fields.resize(size), ...); }, Fields_);
+}
+
+template<class... Fields>
+void
+SoAArray<Fields...>::Reserve(const size_t capacity)
+{
+   std::apply([capacity](auto&... fields){ (fields.reserve(capacity), ...); }, Fields_);
+}
+
+template<class... Fields>
+void
+SoAArray<Fields...>::Append(const Fields&... values)
+{
+   std::apply([&](auto&... fields){ (fields.push_back(values), ...); }, Fields_);
+}
+
+template<class... Fields>
+void
+SoAArray<Fields...>::Erase(const size_t index)
+{
+   IndexBoundCheck(index);
+   std::apply([index](auto&... fields){ (fields.erase(fields.begin() + index), ...); }, Fields_);
+}
+
+template<class... Fields>
+void
+SoAArray<Fields...>::clear() noexcept
+{
+   std::apply([](auto&... fields){ (fields.clear(), ...); }, Fields_);
+}
+
+}
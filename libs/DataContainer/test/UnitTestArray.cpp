@@ -15,6 +15,13 @@
 #include <gtest/gtest.h>
 #include "../../../include/Random.h"
 #include "../include/Array.h"
+#include "../include/List.h"
+#include "../include/MultiArray.h"
+#include "../include/SmallArray.h"
+#include "../include/SoAArray.h"
+
+#include <iterator>
+#include <sstream>
 
 #ifdef DEBUG_MODE
 
@@ -122,6 +129,315 @@ TEST_F(ArrayTest, AssignmentOperator)
   }
 }
 
+TEST_F(ArrayTest, Allocators)
+{
+  // Aligned arrays start on a cache line, including after reallocation.
+  AlignedArray<Real> aligned_array(ContainerSize, One);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned_array.data()) % CacheLineSize, 0);
+
+  aligned_array.Append(RealDynamicArray.begin(), RealDynamicArray.end());
+  EXPECT_EQ(aligned_array.size(), 2 * ContainerSize);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned_array.data()) % CacheLineSize, 0);
+
+  // Arena arrays are bump-allocated, and released in one go.
+  MonotonicArena arena(1024);
+  {
+    ArenaArray<Real> arena_array0(ContainerSize, Two, &arena);
+    ArenaArray<int>  arena_array1(ContainerSize, 3, &arena);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(arena_array0.data()) % CacheLineSize, 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(arena_array1.data()) % CacheLineSize, 0);
+    EXPECT_EQ(arena_array0.get_allocator().resource(), &arena);
+
+    arena_array0 = Three;
+    FOR(i, ContainerSize)
+    {
+      EXPECT_EQ(arena_array0[i], Three);
+      EXPECT_EQ(arena_array1[i], 3);
+    }
+  }
+  EXPECT_GE(arena.Capacity(), ContainerSize * (sizeof(Real) + sizeof(int)));
+
+  arena.Release();
+  EXPECT_EQ(arena.Capacity(), 0);
+}
+
+TEST_F(ArrayTest, SmallArray)
+{
+  // Entries are stored inline up to the inline capacity.
+  SmallArray<int, 4> small_array{1, 2, 3};
+  EXPECT_TRUE(small_array.isInline());
+  EXPECT_EQ(small_array.capacity(), 4);
+
+  small_array.Append(4);
+  EXPECT_TRUE(small_array.isInline());
+
+  // Appending beyond the inline capacity spills to the heap.
+  small_array.Append(small_array[0]);
+  EXPECT_FALSE(small_array.isInline());
+  EXPECT_EQ(small_array.size(), 5);
+  FOR(i, 4) EXPECT_EQ(small_array[i], i + 1);
+  EXPECT_EQ(small_array.back(), 1);
+
+  // Copies and moves of both inline and heap-allocated arrays.
+  SmallArray<int, 4> copy(small_array);
+  EXPECT_TRUE(copy == small_array);
+
+  SmallArray<int, 4> moved(std::move(copy));
+  EXPECT_TRUE(moved == small_array);
+  EXPECT_TRUE(copy.empty() && copy.isInline());
+
+  small_array.pop_back();
+  small_array.shrink_to_fit();
+  EXPECT_TRUE(small_array.isInline());
+  moved = std::move(small_array);
+  EXPECT_TRUE(moved.isInline());
+  EXPECT_EQ(moved.size(), 4);
+
+  // Array interface and non-trivial entry types.
+  moved = 7;
+  FOR(i, moved.size()) EXPECT_EQ(moved[i], 7);
+
+  SmallArray<std::string, 2> strings(3, "entry");
+  strings.Append(SmallArray<std::string, 2>{"last"});
+  EXPECT_EQ(strings.size(), 4);
+  EXPECT_EQ(strings.back(), "last");
+
+  strings.Erase();
+  EXPECT_TRUE(strings.empty() && strings.isInline());
+
+  // Construction from single-pass ranges.
+  std::istringstream stream("1 2 3 4 5 6");
+  const SmallArray<int, 4> streamed(std::istream_iterator<int>(stream), std::istream_iterator<int>{});
+  EXPECT_EQ(streamed.size(), 6);
+  FOR(i, streamed.size()) EXPECT_EQ(streamed[i], i + 1);
+}
+
+TEST_F(ArrayTest, MultiArrayView)
+{
+  DynamicMultiArray<Real> multi_array(3, 4, 5);
+  FOR(i, 3) FOR(j, 4) FOR(k, 5) multi_array(i, j, k) = 100 * i + 10 * j + k;
+
+  // Multi-index computation inverts the linear index.
+  const auto multi_index = multi_array.ComputeMultiIndex(multi_array.ComputeLinearIndex(2, 1, 3));
+  EXPECT_EQ(multi_index[0], 2);
+  EXPECT_EQ(multi_index[1], 1);
+  EXPECT_EQ(multi_index[2], 3);
+
+  StaticMultiArray<int, 2, 3> static_multi_array;
+  const auto static_multi_index = static_multi_array.ComputeMultiIndex(5);
+  EXPECT_EQ(static_multi_index[0], 1);
+  EXPECT_EQ(static_multi_index[1], 2);
+
+  // Slices, sub-blocks and strided views index into the original entries.
+  auto slice = multi_array.Slice(1, 2);
+  EXPECT_EQ(slice.Rank(), 2);
+  EXPECT_EQ(slice.size(), 15);
+  EXPECT_EQ(slice(1, 4), 124);
+
+  auto block = multi_array.Block({1, 1, 1}, {2, 2, 3});
+  EXPECT_EQ(block.size(), 12);
+  EXPECT_EQ(block(0, 0, 0), 111);
+  EXPECT_EQ(block(1, 1, 2), 223);
+  EXPECT_FALSE(block.isContiguous());
+  EXPECT_TRUE(multi_array.View().isContiguous());
+
+  auto strided = slice.Stride(1, 2);
+  EXPECT_EQ(strided.Dimensions()[1], 3);
+  EXPECT_EQ(strided(2, 2), 224);
+
+  // Iteration follows the view's linear order, with the first index fastest.
+  size_t count(0);
+  for(auto it = block.begin(); it != block.end(); ++it, ++count) EXPECT_EQ(*it, block[count]);
+  EXPECT_EQ(count, block.size());
+  EXPECT_EQ(*(block.begin() + 7), block[7]);
+  EXPECT_EQ(block.end() - block.begin(), 12);
+
+  // Entry-wise arithmetic directly on views, writing through to the original entries.
+  auto lhs = multi_array.Slice(0, 0);
+  const auto rhs = std::as_const(multi_array).Slice(0, 1);
+  lhs += rhs;
+  EXPECT_EQ(multi_array(0, 2, 3), 23 + 123);
+  EXPECT_EQ(multi_array(1, 2, 3), 123);
+
+  const DynamicArray<Real> sum = lhs + Two * rhs;
+  EXPECT_EQ(sum.size(), 20);
+  EXPECT_EQ(sum[0], 100 + Two * 100);
+  EXPECT_EQ(sum[2 + 4 * 3], 146 + Two * 123);
+
+  block = Zero;
+  EXPECT_EQ(multi_array(2, 2, 3), Zero);
+  EXPECT_EQ(multi_array(0, 2, 3), 146);
+
+  // Assignment between overlapping views, which reads the entries before any are overwritten.
+  DynamicMultiArray<Real> square(4, 4);
+  const auto reset = [&square]() { FOR(i, 4) FOR(j, 4) square(i, j) = 10 * i + j; };
+  auto square_view = square.View();
+  EXPECT_TRUE(square_view.isAliased(square_view.Permute({1, 0})));
+  EXPECT_FALSE(square_view.isAliased(square.View()));
+  EXPECT_FALSE(square.Block({0, 0}, {4, 2}).isAliased(square.Block({0, 2}, {4, 2})));
+
+  reset();
+  square.Block({1, 0}, {3, 4}) = square.Block({0, 0}, {3, 4});
+  FOR(i, 1, 4) FOR(j, 4) EXPECT_EQ(square(i, j), 10 * (i - 1) + j);
+
+  reset();
+  square_view = square_view.Permute({1, 0}) + square_view;
+  FOR(i, 4) FOR(j, 4) EXPECT_EQ(square(i, j), 11 * (i + j));
+
+  // Arithmetic on large views, which is evaluated in parallel blocks, each stepping through the views from its first entry.
+  DynamicMultiArray<Real> large(190, 210), large_transpose(210, 190);
+  FOR(i, 190) FOR(j, 210) large(i, j) = static_cast<Real>(1000 * i + j);
+  auto large_transpose_view = large_transpose.View();
+  large_transpose_view = Two * large.View().Permute({1, 0});
+  large_transpose_view -= large.View().Permute({1, 0});
+  large_transpose_view *= Three;
+
+  size_t n_mismatches(0);
+  FOR(i, 190) FOR(j, 210) n_mismatches += large_transpose(j, i) != Three * large(i, j);
+  EXPECT_EQ(n_mismatches, 0);
+}
+
+TEST_F(ArrayTest, MultiArrayLayout)
+{
+  // Row-major arrays store the last index fastest.
+  DynamicMultiArray<int, layout::RowMajor> row_major(3, 4);
+  EXPECT_EQ(row_major.ComputeLinearIndex(1, 2), 6);
+  EXPECT_EQ(row_major.View()(1, 2), row_major(1, 2));
+  EXPECT_EQ(row_major.Strides()[0], 4);
+
+  StaticLayoutMultiArray<int, layout::RowMajor, 2, 3> static_row_major;
+  static_row_major(1, 0) = 7;
+  EXPECT_EQ(*(static_row_major.begin() + 3), 7);
+
+  // Tiled arrays pad their dimensions to whole tiles, and are Z-ordered within each tile.
+  DynamicMultiArray<int, layout::Tiled<4>> tiled(5, 6, 3);
+  EXPECT_EQ(tiled.end() - tiled.begin(), 8 * 8 * 4);
+  EXPECT_EQ(tiled.ComputeLinearIndex(1, 1, 1), 7);
+  EXPECT_EQ(tiled.ComputeLinearIndex(0, 0, 0) + 2, tiled.ComputeLinearIndex(0, 1, 0));
+  EXPECT_EQ(tiled.ComputeLinearIndex(4, 0, 0), 64);
+
+  FOR(i, 5) FOR(j, 6) FOR(k, 3)
+  {
+    tiled(i, j, k) = 100 * i + 10 * j + k;
+    const auto multi_index = tiled.ComputeMultiIndex(tiled.ComputeLinearIndex(i, j, k));
+    EXPECT_TRUE(multi_index[0] == i && multi_index[1] == j && multi_index[2] == k);
+  }
+
+  // Layout-aware iteration visits every entry exactly once, in increasing storage order.
+  for(auto& layout_array : {DynamicMultiArray<int, layout::Tiled<4>>(5, 6, 3), DynamicMultiArray<int, layout::Tiled<4>>(tiled)})
+  {
+    size_t count(0), previous(0);
+    layout_array.ForEach([&](const int entry, const auto& multi_index)
+    {
+      const size_t index = layout_array.ComputeLinearIndex(multi_index[0], multi_index[1], multi_index[2]);
+      EXPECT_TRUE(count == 0 || previous < index);
+      EXPECT_EQ(entry, layout_array(multi_index[0], multi_index[1], multi_index[2]));
+      previous = index;
+      ++count;
+    });
+    EXPECT_EQ(count, 5 * 6 * 3);
+  }
+
+  size_t index(0);
+  row_major.ForEach([&](int& entry, const auto& multi_index)
+  {
+    EXPECT_EQ(row_major.ComputeLinearIndex(multi_index[0], multi_index[1]), index++);
+    entry = 1;
+  });
+  EXPECT_EQ(Sum(row_major.begin(), row_major.end()), 12);
+}
+
+TEST_F(ArrayTest, List)
+{
+  // Mirror random insertions/removals in a vector, with a small chunk size so that chunks are frequently split and merged.
+  List<int, 8> list{0, 1, 2};
+  std::vector<int> vector{0, 1, 2};
+  const int& first = list.front();
+
+  Random<size_t> random_index(0, 1000);
+  FOR(i, 2000)
+  {
+    const size_t index = random_index() % (vector.size() + 1);
+    if(i % 3 == 2 && index < vector.size() && vector[index] != 0)
+    {
+      const auto next = list.erase(list.begin() + index);
+      vector.erase(vector.begin() + index);
+      if(index < vector.size()) { EXPECT_EQ(*next, vector[index]); }
+    }
+    else
+    {
+      EXPECT_EQ(*list.insert(list.begin() + index, i + 3), i + 3);
+      vector.insert(vector.begin() + index, i + 3);
+    }
+  }
+
+  // References remain valid across insertions and removals of other entries.
+  EXPECT_EQ(&first, &*std::find(list.begin(), list.end(), 0));
+
+  ASSERT_EQ(list.size(), vector.size());
+  FOR(i, vector.size()) EXPECT_EQ(list[i], vector[i]);
+  EXPECT_TRUE(std::equal(list.begin(), list.end(), vector.begin(), vector.end()));
+  EXPECT_EQ(list.end() - list.begin(), vector.size());
+  EXPECT_EQ(*(list.end() - 1), vector.back());
+
+  // Copies, moves and clearing.
+  List<int, 8> copy(list);
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), vector.begin(), vector.end()));
+
+  List<int, 8> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty() && copy.begin() == copy.end());
+  EXPECT_EQ(moved.size(), vector.size());
+
+  while(!moved.empty()) moved.pop_front();
+  moved.push_back(4);
+  moved = {5};
+  EXPECT_EQ(moved.back(), 5);
+
+  List<std::string> strings;
+  strings.push_back("b");
+  strings.push_front("a");
+  strings.emplace_back(2, 'c');
+  EXPECT_EQ(strings[0] + strings[1] + strings[2], "abcc");
+}
+
+TEST_F(ArrayTest, SoAArray)
+{
+  SoAArray<SArray3<float>, float, int> particles(4, SArray3<float>{0.0f, 0.0f, 0.0f}, 1.0f, 0);
+  EXPECT_EQ(particles.size(), 4);
+
+  // Each field is stored contiguously and cache line-aligned.
+  const auto positions = particles.Field<0>();
+  const auto masses = particles.Field<float>();
+  EXPECT_EQ(positions.size(), 4);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(masses.data()) % CacheLineSize, 0);
+  EXPECT_EQ(&masses[1] - &masses[0], 1);
+
+  // Record access, through subscripts and iterators.
+  FOR(i, particles.size()) std::get<2>(particles[i]) = static_cast<int>(i);
+  for(auto [position, mass, id] : particles)
+  {
+    position[0] = static_cast<float>(id);
+    mass *= 2.0f;
+  }
+  EXPECT_EQ(positions[3][0], 3.0f);
+  EXPECT_EQ(Sum(masses.begin(), masses.end()), 8.0f);
+
+  particles.Append({1.0f, 2.0f, 3.0f}, 5.0f, 4);
+  particles.Append(std::tuple{SArray3<float>{0.0f, 0.0f, 0.0f}, 6.0f, 5});
+  particles.Erase(0);
+  EXPECT_EQ(particles.size(), 5);
+  EXPECT_EQ(std::get<1>(particles.back()), 6.0f);
+  EXPECT_EQ(std::get<0>(particles[3]), (SArray3<float>{1.0f, 2.0f, 3.0f}));
+  EXPECT_EQ(particles.Field<int>()[0], 1);
+
+  const auto& const_particles = particles;
+  EXPECT_EQ(std::count_if(const_particles.begin(), const_particles.end(), [](const auto& record){ return std::get<1>(record) > 4.0f; }), 2);
+  EXPECT_EQ(const_particles.end() - const_particles.begin(), 5);
+
+  particles.clear();
+  EXPECT_TRUE(particles.empty());
+}
+
 }
 
 #endif
@@ -14,8 +14,11 @@
 
 #include <gtest/gtest.h>
 #include "../include/NumericContainer.h"
+#include "../include/Reduction.h"
 #include "../../DataContainer/include/Array.h"
 
+#include <list>
+
 #ifdef DEBUG_MODE
 
 constexpr size_t ContainerSize = 50;
@@ -33,6 +36,8 @@ protected:
   constexpr NumericContainer() = default;
 
 public:
+  using detail::NumericContainer<T, D>::operator=;
+
   constexpr D& Derived() noexcept { return static_cast<D&>(*this); }
   constexpr const D& Derived() const noexcept { return static_cast<const D&>(*this); }
 };
@@ -41,7 +46,8 @@ template<typename T, size_t N>
 struct StaticNumericContainer : public StaticArray<T, N>,
                                public NumericContainer<T, StaticNumericContainer<T, N>>
 {
-
+  using StaticArray<T, N>::operator=;
+  using NumericContainer<T, StaticNumericContainer<T, N>>::operator=;
 };
 
 template<typename T>
@@ -49,6 +55,9 @@ struct DynamicNumericContainer : public DynamicArray<T>,
                                 public NumericContainer<T, DynamicNumericContainer<T>>
 {
   DynamicNumericContainer(const size_t size) : DynamicArray<T>::DynamicArray(size) {}
+
+  using DynamicArray<T>::operator=;
+  using NumericContainer<T, DynamicNumericContainer<T>>::operator=;
 };
 
 /***************************************************************************************************************************************************************
@@ -78,6 +87,201 @@ public:
   }
 };
 
+/***************************************************************************************************************************************************************
+* SIMD Tests
+***************************************************************************************************************************************************************/
+constexpr StaticArray<simd::InstructionSet, 4> InstructionSets{simd::InstructionSet::Scalar, simd::InstructionSet::SSE2, simd::InstructionSet::AVX2,
+                                                               simd::InstructionSet::AVX512};
+
+TEST_F(NumericContainerTest, SIMDKernels)
+{
+  using enum detail::NumericOperator;
+  const auto& a = RealStaticContainer;
+  const auto& b = RealDynamicContainer;
+  const auto  n = ContainerSize - 3; // Exercise the remainder loops
+  const auto  default_set = simd::ActiveInstructionSet();
+
+  StaticArray<Real, ContainerSize> result;
+  StaticArray<Real, 4> sums, dots;
+  DynamicArray<Real> scalar_sines, scalar_cosines;
+  FOR(k, InstructionSets.size())
+  {
+    simd::SetInstructionSet(InstructionSets[k]);
+    EXPECT_LE(simd::ActiveInstructionSet(), simd::SupportedInstructionSet());
+
+    // Entry-wise kernels must match the scalar operations exactly.
+    simd::EntryWise<Plus>(a.data(), b.data(), result.data(), n);
+    FOR(i, n) EXPECT_EQ(result[i], a[i] + b[i]);
+
+    simd::EntryWise<Divide>(a.data(), Three, result.data(), n);
+    FOR(i, n) EXPECT_EQ(result[i], a[i] / Three);
+
+    simd::FusedMultiplyAdd(a.data(), b.data(), a.data(), result.data(), n);
+    FOR(i, n) EXPECT_EQ(result[i], std::fma(a[i], b[i], a[i]));
+
+    // Reductions must be reproducible across instruction sets.
+    sums[k] = simd::Sum(a.data(), n);
+    dots[k] = simd::Dot(a.data(), b.data(), n);
+    EXPECT_NEAR(sums[k], std::accumulate(a.begin(), a.begin() + n, Zero), 1.0e-10);
+    EXPECT_NEAR(dots[k], std::inner_product(a.begin(), a.begin() + n, b.begin(), Zero), 1.0e-10);
+    EXPECT_EQ(sums[k], sums[0]);
+    EXPECT_EQ(dots[k], dots[0]);
+
+    // Sines and cosines must be accurate to within an ulp, in every quadrant, and identical across instruction sets.
+    StaticArray<Real, ContainerSize> angles, sines, cosines;
+    FOR(i, n) angles[i] = Ten * a[i];
+    simd::SinCos(angles.data(), sines.data(), cosines.data(), n);
+    FOR(i, n)
+    {
+      EXPECT_NEAR(sines[i], std::sin(angles[i]), 2.0 * std::numeric_limits<Real>::epsilon());
+      EXPECT_NEAR(cosines[i], std::cos(angles[i]), 2.0 * std::numeric_limits<Real>::epsilon());
+    }
+
+    // Kernels built on multiply-adds round identically on every instruction set.
+    DynamicArray<Real> many_angles(1000), many_sines(1000), many_cosines(1000);
+    FOR(i, many_angles.size()) many_angles[i] = static_cast<Real>(i) * 0.731 - 365.0;
+    simd::SinCos(many_angles.data(), many_sines.data(), many_cosines.data(), many_angles.size());
+    if(k == 0) { scalar_sines = many_sines; scalar_cosines = many_cosines; }
+    FOR(i, many_angles.size())
+    {
+      EXPECT_EQ(many_sines[i], scalar_sines[i]);
+      EXPECT_EQ(many_cosines[i], scalar_cosines[i]);
+    }
+  }
+  simd::SetInstructionSet(default_set);
+}
+
+TEST_F(NumericContainerTest, VectorisedArithmetic)
+{
+  const auto a = RealDynamicContainer;
+  auto       b = RealDynamicContainer;
+
+  b *= Two;
+  b += a;
+  FOR(i, ContainerSize) EXPECT_EQ(b[i], Two * a[i] + a[i]);
+
+  b /= a;
+  FOR(i, ContainerSize) EXPECT_EQ(b[i], (Two * a[i] + a[i]) / a[i]);
+
+  b = a - b;
+  FOR(i, ContainerSize) EXPECT_EQ(b[i], a[i] - (Two * a[i] + a[i]) / a[i]);
+
+  b = a * 3;
+  FOR(i, ContainerSize) EXPECT_EQ(b[i], a[i] * Three);
+
+  // Integer containers take the generic path.
+  const auto c = IntDynamicContainer;
+  auto       d = IntDynamicContainer;
+  d += c;
+  FOR(i, ContainerSize) EXPECT_EQ(d[i], 2 * c[i]);
+}
+
+/***************************************************************************************************************************************************************
+* Parallel Execution Tests
+***************************************************************************************************************************************************************/
+TEST_F(NumericContainerTest, ParallelArithmetic)
+{
+  const size_t large_size = 4 * parallel::MinParallelSize + 1;
+  DynamicNumericContainer<Real> a(large_size);
+  DynamicNumericContainer<Real> b(large_size);
+  DynamicNumericContainer<int>  c(large_size);
+
+  a = Two;
+  c = 3;
+  EXPECT_TRUE(std::all_of(a.begin(), a.end(), [](const Real entry){ return entry == Two; }));
+  EXPECT_TRUE(std::all_of(c.begin(), c.end(), [](const int entry){ return entry == 3; }));
+
+  b.Randomise();
+  EXPECT_TRUE(std::all_of(b.begin(), b.end(), [](const Real entry){ return isBounded<true, true>(entry, -One, One); }));
+  EXPECT_NE(b[0], b[parallel::BlockSize]);
+
+  a *= b;
+  c *= c;
+  FOR(i, large_size)
+  {
+    EXPECT_EQ(a[i], Two * b[i]);
+    EXPECT_EQ(c[i], 9);
+  }
+
+  // Blocked reductions must not depend on the number of threads.
+  const auto block_sum = [&](const size_t first, const size_t last) { return simd::Sum(a.data() + first, last - first); };
+  const auto max_threads = omp_get_max_threads();
+  const auto sum = parallel::Reduce<Real>(large_size, block_sum, std::plus<Real>());
+  FOR(n_threads, 1, 5)
+  {
+    omp_set_num_threads(static_cast<int>(n_threads));
+    EXPECT_EQ(parallel::Reduce<Real>(large_size, block_sum, std::plus<Real>()), sum);
+  }
+  omp_set_num_threads(max_threads);
+}
+
+TEST_F(NumericContainerTest, Reductions)
+{
+  // Sum of many entries below the rounding error of the first entry, which a naive summation loses entirely.
+  const size_t large_size = 4 * parallel::MinParallelSize + 3;
+  DynamicNumericContainer<Real> a(large_size);
+  a = 1.0e-16;
+  a[0] = One;
+  const Real exact = One + static_cast<Real>(large_size - 1) * 1.0e-16;
+  EXPECT_EQ(std::accumulate(a.begin(), a.end(), Zero), One);
+  EXPECT_NEAR(reduce::Sum(a), exact, 2.0 * std::numeric_limits<Real>::epsilon());
+  EXPECT_NEAR(reduce::Sum(a.begin(), a.end()), exact, 2.0 * std::numeric_limits<Real>::epsilon());
+
+  // Results must be bit-identical irrespective of the number of threads, and the instruction set.
+  DynamicNumericContainer<Real> b(large_size);
+  b.Randomise();
+  const auto sum = reduce::Sum(b);
+  const auto dot = reduce::Dot(a, b);
+  const auto variance = reduce::Variance(b);
+  const auto max_threads = omp_get_max_threads();
+  FOR(n_threads, 1, 5)
+  {
+    omp_set_num_threads(static_cast<int>(n_threads));
+    EXPECT_EQ(reduce::Sum(b), sum);
+    EXPECT_EQ(reduce::Dot(a, b), dot);
+    EXPECT_EQ(reduce::Variance(b), variance);
+  }
+  omp_set_num_threads(max_threads);
+
+  const auto instruction_set = simd::ActiveInstructionSet();
+  simd::SetInstructionSet(simd::InstructionSet::Scalar);
+  EXPECT_EQ(reduce::Sum(b), sum);
+  EXPECT_EQ(reduce::Dot(a, b), dot);
+  simd::SetInstructionSet(instruction_set);
+
+  // Agreement with straightforward evaluations, and between the contiguous and generic paths.
+  EXPECT_NEAR(sum, std::accumulate(b.begin(), b.end(), Zero), 1.0e-9);
+  EXPECT_NEAR(reduce::Dot(b, b), reduce::Sum(b * b), 1.0e-9);
+  EXPECT_NEAR(reduce::Dot(b.begin(), b.end(), b.begin()), reduce::Dot(b, b), 1.0e-9);
+  EXPECT_NEAR(reduce::Mean(b), sum / static_cast<Real>(large_size), 1.0e-15);
+
+  Real deviations(Zero);
+  const auto mean = reduce::Mean(b);
+  FOR_EACH(entry, b) deviations += (entry - mean) * (entry - mean);
+  EXPECT_NEAR(variance, deviations / static_cast<Real>(large_size), 1.0e-12);
+  EXPECT_NEAR(reduce::Variance(b, true), deviations / static_cast<Real>(large_size - 1), 1.0e-12);
+
+  // Extrema return the first index of the extremal value.
+  b[7] = Two;
+  b[large_size - 5] = Two;
+  b[parallel::BlockSize + 1] = -Two;
+  const auto max = reduce::Max(b);
+  const auto min = reduce::Min(b);
+  EXPECT_EQ(max.Value, Two);
+  EXPECT_EQ(max.Index, 7);
+  EXPECT_EQ(min.Value, -Two);
+  EXPECT_EQ(min.Index, parallel::BlockSize + 1);
+
+  // Integral entries, and non-contiguous ranges.
+  EXPECT_EQ(reduce::Sum(IntDynamicContainer), std::accumulate(IntDynamicContainer.begin(), IntDynamicContainer.end(), 0));
+  EXPECT_EQ(reduce::Product(DynamicArray<int>{1, 2, 3, 4}), 24);
+  EXPECT_EQ(reduce::Mean(DynamicArray<int>{1, 2}), 1.5);
+
+  const std::list<Real> list{One, Two, Three};
+  EXPECT_EQ(reduce::Sum(list), Six);
+  EXPECT_EQ(reduce::Max(list).Index, 2);
+}
+
 }
 }
 
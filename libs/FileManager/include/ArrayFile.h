@@ -0,0 +1,232 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "DataContainer/include/Array.h"
+#include "DataContainer/include/Layout.h"
+#include "DataContainer/include/MultiArrayView.h"
+#include "FileSystem.h"
+#include "MappedFile.h"
+
+#include <cstdint>
+
+/***************************************************************************************************************************************************************
+* Binary Array Files
+*
+* Self-describing binary files holding a strided (column- or row-major) multi-array, e.g. a DynamicMultiArray or DynamicTensor, which are written at disk
+* speed and without loss of precision. The file is laid out as
+*
+*   Header       - magic "APRNARRY", byte-order mark, format version, data type, entry size, storage order, flags, rank and number of chunks (48 bytes).
+*   Dimensions   - rank x uint64, followed by the chunk dimensions, rank x uint64.
+*   Chunk table  - number of chunks x {offset, size in bytes, checksum}, each uint64.
+*   Checksum     - uint64 checksum of all of the above.
+*   Chunks       - the entries of each chunk, starting at 64-byte aligned offsets.
+*
+* The array is partitioned into a grid of chunks of equal dimensions (except for those at the upper edges, which are truncated), which are ordered, and whose
+* entries are stored, in the storage order of the array. Sub-blocks can hence be read by touching only the chunks they overlap, and each chunk can be viewed
+* in place in a memory-mapped file, without being copied. A single chunk (the default) holds the whole array, which can then be viewed directly.
+*
+* Checksums (64-bit multiply-rotate hashes, after XXH64) of the chunks are optional, and are verified whenever chunks are read (but not when they are
+* viewed). Entries are stored in native byte order, and files written on machines of a different byte order are rejected.
+***************************************************************************************************************************************************************/
+
+namespace aprn::flmgr {
+
+/** Entry types, as recorded in array files. */
+enum class DataType : std::uint32_t
+{
+   Int8 = 1,
+   Int16,
+   Int32,
+   Int64,
+   UInt8,
+   UInt16,
+   UInt32,
+   UInt64,
+   Float32,
+   Float64
+};
+
+template<typename T>
+constexpr DataType DataTypeOf();
+
+/** Storage orders of multi-arrays, i.e. their (strided) layouts. */
+enum class StorageOrder : std::uint32_t
+{
+   ColumnMajor,
+   RowMajor
+};
+
+/** Multi-array with a contiguous column- or row-major layout, and arithmetic entries. */
+template<class M>
+concept StridedMultiArrayType = requires(const M& array, const size_t dimension)
+{
+   array.data();
+   { array.Rank() } -> std::convertible_to<size_t>;
+   { array.Dimension(dimension) } -> std::convertible_to<size_t>;
+   requires isTypeSame<typename M::layout_type, layout::ColumnMajor>() || isTypeSame<typename M::layout_type, layout::RowMajor>();
+   requires std::is_arithmetic_v<std::remove_cvref_t<decltype(*array.data())>>;
+};
+
+struct ArrayFileOptions
+{
+   /** Dimensions of the chunks, which are clipped to the array dimensions. If empty, the whole array is stored as a single chunk. */
+   MultiIndex ChunkDimensions;
+
+   /** Whether to store the checksums of the chunks. Checksumming costs an extra pass over the entries, on both writing and reading. */
+   bool isChecksummed{false};
+};
+
+/** Write a multi-array to an array file, replacing any existing file. Chunks are written one at a time, so that the extra memory required is at most the
+    size of one chunk. */
+template<StridedMultiArrayType M>
+void
+WriteArrayFile(const Path& file_path, const M& array, const ArrayFileOptions& options = {});
+
+namespace detail {
+
+/** Partition of a multi-array into chunks, whose storage order is also the order of the chunks. */
+class ChunkGrid
+{
+ public:
+   ChunkGrid() = default;
+
+   ChunkGrid(const MultiIndex& dimensions, const MultiIndex& chunk_dimensions, const StorageOrder order);
+
+   size_t size() const noexcept { return nChunks_; }
+
+   /** First multi-index and dimensions of a chunk. */
+   void Chunk(const size_t index, MultiIndex& first, MultiIndex& extents) const;
+
+   const MultiIndex& Dimensions() const noexcept { return Dimensions_; }
+
+   const MultiIndex& ChunkDimensions() const noexcept { return ChunkDimensions_; }
+
+   StorageOrder Order() const noexcept { return Order_; }
+
+ private:
+   MultiIndex   Dimensions_;
+   MultiIndex   ChunkDimensions_;
+   MultiIndex   Counts_;
+   StorageOrder Order_{StorageOrder::ColumnMajor};
+   size_t       nChunks_{0};
+};
+
+struct ChunkRecord
+{
+   std::uint64_t Offset{0};
+   std::uint64_t Size{0};
+   std::uint64_t Checksum{0};
+};
+
+StrideArray
+Strides(const MultiIndex& dimensions, const StorageOrder order);
+
+std::uint64_t
+Checksum(const std::byte* data, const size_t n_bytes);
+
+/** Header of an array file (see above), padded to the offset of the first chunk, with the given chunk records. */
+DynamicArray<std::byte>
+EncodeHeader(const ChunkGrid& grid, const DataType type, const size_t entry_size, const bool is_checksummed, const DynamicArray<ChunkRecord>& chunks);
+
+/** Size of the header of an array file, padded to the offset of the first chunk. */
+size_t
+HeaderSize(const size_t rank, const size_t n_chunks);
+
+/** Offsets of chunks, and of the first chunk, are multiples of the chunk alignment. */
+constexpr size_t ChunkAlignment{64};
+
+/** Copy a strided block of entries, with the given dimensions, to another strided block. */
+template<typename T>
+void
+CopyStrided(const T* source, const StrideArray& source_strides, T* destination, const StrideArray& destination_strides, const MultiIndex& extents);
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* Array File Class
+***************************************************************************************************************************************************************/
+
+/** Read-only memory mapping of an array file, whose header is validated on opening. Chunks are only paged in from disk once they are viewed or read. */
+class ArrayFile
+{
+ public:
+   ArrayFile() = default;
+
+   explicit ArrayFile(const Path& file_path);
+
+   /** Array properties. */
+   DataType Type() const noexcept { return Type_; }
+
+   StorageOrder Order() const noexcept { return Grid_.Order(); }
+
+   size_t Rank() const noexcept { return Grid_.Dimensions().size(); }
+
+   size_t Dimension(const size_t dimension) const { return Grid_.Dimensions()[dimension]; }
+
+   const MultiIndex& Dimensions() const noexcept { return Grid_.Dimensions(); }
+
+   size_t size() const { return Product(Dimensions().begin(), Dimensions().end()); }
+
+   /** Chunk properties. */
+   const MultiIndex& ChunkDimensions() const noexcept { return Grid_.ChunkDimensions(); }
+
+   size_t ChunkCount() const noexcept { return Grid_.size(); }
+
+   /** First multi-index and dimensions of a chunk. */
+   void Chunk(const size_t index, MultiIndex& first, MultiIndex& extents) const { Grid_.Chunk(index, first, extents); }
+
+   bool isChecksummed() const noexcept { return isChecksummed_; }
+
+   /** Check the checksums of all chunks, or of one chunk. Files without checksums always pass. */
+   bool Verify() const;
+
+   bool VerifyChunk(const size_t index) const;
+
+   /** Zero-copy views of the whole array, which must be stored as a single chunk, and of a chunk, whose multi-indices are relative to the chunk. The views
+       are valid as long as the file is open. Rank-0 arrays are viewed as one-dimensional arrays of a single entry. */
+   template<typename T>
+   MultiArrayView<const T>
+   View() const;
+
+   template<typename T>
+   MultiArrayView<const T>
+   ChunkView(const size_t index) const;
+
+   /** Read the whole array, or a sub-block, into a multi-array, which is resized if possible, and may have a different storage order. Only the chunks which
+       overlap the block are read, and their checksums are verified. */
+   template<StridedMultiArrayType M>
+   void
+   Read(M& array) const;
+
+   template<StridedMultiArrayType M>
+   void
+   ReadBlock(const MultiIndex& first, const MultiIndex& extents, M& array) const;
+
+   /** Advise the kernel of the access pattern of the chunks. */
+   void Advise(const AccessPattern pattern) const { File_.Advise(pattern); }
+
+ private:
+   MappedFile                        File_;
+   detail::ChunkGrid                 Grid_;
+   DataType                          Type_{DataType::Float64};
+   bool                              isChecksummed_{false};
+   DynamicArray<detail::ChunkRecord> Chunks_;
+};
+
+}
+
+#include "ArrayFile.tpp"
@@ -0,0 +1,220 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include <bit>
+#include <fstream>
+
+namespace aprn::flmgr {
+
+template<typename T>
+constexpr DataType
+DataTypeOf()
+{
+   static_assert(std::is_arithmetic_v<T> && !isTypeSame<T, bool>(), "Array files can only hold arithmetic (non-boolean) entries.");
+
+   if constexpr(std::is_floating_point_v<T>)
+   {
+      static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Array files can only hold single or double precision floating-point entries.");
+      return sizeof(T) == 4 ? DataType::Float32 : DataType::Float64;
+   }
+   else return static_cast<DataType>((std::is_signed_v<T> ? 1 : 5) + std::countr_zero(sizeof(T)));
+}
+
+/***************************************************************************************************************************************************************
+* Array File Writing
+***************************************************************************************************************************************************************/
+template<StridedMultiArrayType M>
+void
+WriteArrayFile(const Path& file_path, const M& array, const ArrayFileOptions& options)
+{
+   using T = std::remove_cvref_t<decltype(*array.data())>;
+   constexpr auto order = isTypeSame<typename M::layout_type, layout::RowMajor>() ? StorageOrder::RowMajor : StorageOrder::ColumnMajor;
+
+   MultiIndex dimensions(array.Rank());
+   FOR(i, dimensions.size()) dimensions[i] = array.Dimension(i);
+   const detail::ChunkGrid grid(dimensions, options.ChunkDimensions.empty() ? dimensions : options.ChunkDimensions, order);
+
+   // Lay out the chunks back to back after the header, at aligned offsets.
+   DynamicArray<detail::ChunkRecord> chunks(grid.size());
+   MultiIndex first, extents;
+   size_t offset = detail::HeaderSize(dimensions.size(), grid.size());
+   FOR(i, grid.size())
+   {
+      grid.Chunk(i, first, extents);
+      const size_t n_bytes = Product(extents.begin(), extents.end()) * sizeof(T);
+      chunks[i] = {offset, n_bytes, 0};
+      offset += (n_bytes + detail::ChunkAlignment - 1) / detail::ChunkAlignment * detail::ChunkAlignment;
+   }
+
+   std::ofstream stream(file_path, std::ios::binary | std::ios::trunc);
+   ASSERT(stream.is_open(), "Could not create the file ", file_path.filename(), ".")
+
+   // Write the chunks, gathering each one into a contiguous buffer unless it is the whole array, and then the header, once the checksums are known.
+   const StrideArray strides = detail::Strides(dimensions, order);
+   DynamicArray<T> buffer;
+   FOR(i, grid.size())
+   {
+      const T* entries = array.data();
+      if(grid.size() > 1)
+      {
+         grid.Chunk(i, first, extents);
+         std::ptrdiff_t origin(0);
+         FOR(j, first.size()) origin += static_cast<std::ptrdiff_t>(first[j]) * strides[j];
+
+         buffer.resize(chunks[i].Size / sizeof(T));
+         detail::CopyStrided(entries + origin, strides, buffer.data(), detail::Strides(extents, order), extents);
+         entries = buffer.data();
+      }
+
+      if(options.isChecksummed) chunks[i].Checksum = detail::Checksum(reinterpret_cast<const std::byte*>(entries), chunks[i].Size);
+      stream.seekp(static_cast<std::streamoff>(chunks[i].Offset));
+      stream.write(reinterpret_cast<const char*>(entries), static_cast<std::streamsize>(chunks[i].Size));
+   }
+
+   const auto header = detail::EncodeHeader(grid, DataTypeOf<T>(), sizeof(T), options.isChecksummed, chunks);
+   stream.seekp(0);
+   stream.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+   stream.close();
+   ASSERT(!stream.fail(), "Could not write the file ", file_path.filename(), ".")
+}
+
+namespace detail {
+
+template<typename T>
+void
+CopyStrided(const T* source, const StrideArray& source_strides, T* destination, const StrideArray& destination_strides, const MultiIndex& extents)
+{
+   const size_t rank = extents.size();
+   const size_t n_entries = Product(extents.begin(), extents.end());
+   if(rank == 0 || n_entries == 0)
+   {
+      if(n_entries != 0) *destination = *source;
+      return;
+   }
+
+   // Copy runs along the dimension which is contiguous in the source, which are contiguous in the destination too if the storage orders match.
+   size_t inner(0);
+   FOR(i, 1, rank) if(source_strides[i] < source_strides[inner]) inner = i;
+   const size_t         run_size          = extents[inner];
+   const std::ptrdiff_t source_step       = source_strides[inner];
+   const std::ptrdiff_t destination_step  = destination_strides[inner];
+   const bool           is_run_contiguous = source_step == 1 && destination_step == 1;
+
+   MultiIndex multi_index(rank, 0);
+   FOR(run, n_entries / run_size)
+   {
+      std::ptrdiff_t source_offset(0), destination_offset(0);
+      FOR(i, rank)
+      {
+         source_offset      += static_cast<std::ptrdiff_t>(multi_index[i]) * source_strides[i];
+         destination_offset += static_cast<std::ptrdiff_t>(multi_index[i]) * destination_strides[i];
+      }
+
+      const T* from = source + source_offset;
+      T*       to   = destination + destination_offset;
+      if(is_run_contiguous) std::copy_n(from, run_size, to);
+      else FOR(j, run_size) to[static_cast<std::ptrdiff_t>(j) * destination_step] = from[static_cast<std::ptrdiff_t>(j) * source_step];
+
+      for(size_t i = 0; i < rank; ++i)
+      {
+         if(i == inner) continue;
+         if(++multi_index[i] < extents[i]) break;
+         multi_index[i] = 0;
+      }
+   }
+}
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* Array File Class
+***************************************************************************************************************************************************************/
+template<typename T>
+MultiArrayView<const T>
+ArrayFile::View() const
+{
+   ASSERT(DataTypeOf<T>() == Type_, "The entries of the array file are not of the requested type.")
+   ASSERT(ChunkCount() <= 1, "Only arrays stored as a single chunk can be viewed whole, whereas this one has ", ChunkCount(), " chunks.")
+
+   if(ChunkCount() == 0) return MultiArrayView<const T>(nullptr, Dimensions(), detail::Strides(Dimensions(), Order()));
+   return ChunkView<T>(0);
+}
+
+template<typename T>
+MultiArrayView<const T>
+ArrayFile::ChunkView(const size_t index) const
+{
+   ASSERT(DataTypeOf<T>() == Type_, "The entries of the array file are not of the requested type.")
+   DEBUG_ASSERT(index < ChunkCount(), "The chunk index ", index, " must be lesser than the number of chunks ", ChunkCount(), ".")
+
+   MultiIndex first, extents;
+   Chunk(index, first, extents);
+   const auto entries = reinterpret_cast<const T*>(File_.Data() + Chunks_[index].Offset);
+
+   // Views have at least one dimension, so the single entry of a rank-0 array is viewed as a one-dimensional array.
+   if(extents.empty()) return MultiArrayView<const T>(entries, MultiIndex{1}, StrideArray{1});
+   return MultiArrayView<const T>(entries, extents, detail::Strides(extents, Order()));
+}
+
+template<StridedMultiArrayType M>
+void
+ArrayFile::Read(M& array) const { ReadBlock(MultiIndex(Rank(), 0), Dimensions(), array); }
+
+template<StridedMultiArrayType M>
+void
+ArrayFile::ReadBlock(const MultiIndex& first, const MultiIndex& extents, M& array) const
+{
+   using T = std::remove_cvref_t<decltype(*array.data())>;
+   constexpr auto order = isTypeSame<typename M::layout_type, layout::RowMajor>() ? StorageOrder::RowMajor : StorageOrder::ColumnMajor;
+
+   ASSERT(first.size() == Rank() && extents.size() == Rank(), "The block rank must match the array rank ", Rank(), ".")
+   FOR(i, Rank()) ASSERT(first[i] + extents[i] <= Dimension(i), "The block exceeds dimension ", i, " of the array, of size ", Dimension(i), ".")
+
+   if constexpr(requires { array.Resize(extents); }) array.Resize(extents);
+   else
+   {
+      ASSERT(array.Rank() == Rank(), "The array rank must match the array file rank ", Rank(), ".")
+      FOR(i, Rank()) ASSERT(array.Dimension(i) == extents[i], "Dimension ", i, " of the array must match that of the block, ", extents[i], ".")
+   }
+
+   // Copy the overlap of the block with each chunk.
+   const StrideArray strides = detail::Strides(extents, order);
+   MultiIndex chunk_first, chunk_extents, overlap(Rank());
+   FOR(chunk, ChunkCount())
+   {
+      Chunk(chunk, chunk_first, chunk_extents);
+
+      bool is_overlapping(true);
+      std::ptrdiff_t source_offset(0), destination_offset(0);
+      const auto view = ChunkView<T>(chunk);
+      FOR(i, Rank())
+      {
+         const size_t lower = Max(first[i], chunk_first[i]);
+         const size_t upper = Min(first[i] + extents[i], chunk_first[i] + chunk_extents[i]);
+         if(upper <= lower) { is_overlapping = false; break; }
+
+         overlap[i] = upper - lower;
+         source_offset      += static_cast<std::ptrdiff_t>(lower - chunk_first[i]) * view.Strides()[i];
+         destination_offset += static_cast<std::ptrdiff_t>(lower - first[i]) * strides[i];
+      }
+      if(!is_overlapping) continue;
+
+      ASSERT(VerifyChunk(chunk), "The checksum of chunk ", chunk, " of the array file does not match its entries.")
+      detail::CopyStrided(view.Origin() + source_offset, view.Strides(), array.data() + destination_offset, strides, overlap);
+   }
+}
+
+}
@@ -0,0 +1,138 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "DataContainer/include/Array.h"
+#include "DataContainer/include/MultiArray.h"
+#include "DataContainer/include/NumericContainer.h"
+#include "MappedFile.h"
+
+namespace aprn::flmgr {
+
+/***************************************************************************************************************************************************************
+* Mapped Array Class
+***************************************************************************************************************************************************************/
+
+/** Array whose entries are the raw (native-endian) contents of a memory-mapped file, so that files of any size can be processed through the usual array and
+    numeric container interfaces without reading them into memory first. Entries are paged in on first access; the access pattern can be advised to
+    tune read-ahead. In read mode, entries are read-only, and must be accessed through const arrays; in copy-on-write mode, modified entries are private to
+    the array, so DontNeed advice, which would discard them, is ignored; in read-write mode, they are written back to the file (at the latest when the array
+    is flushed or destroyed). */
+template<typename T>
+class MappedArray : public Array<T, MappedArray<T>>,
+                    public aprn::detail::NumericContainer<T, MappedArray<T>>
+{
+   static_assert(std::is_arithmetic_v<T>, "Mapped arrays can only hold arithmetic types.");
+
+   using BaseArray     = Array<T, MappedArray<T>>;
+   using BaseContainer = aprn::detail::NumericContainer<T, MappedArray<T>>;
+
+ public:
+   using value_type     = T;
+   using size_type      = size_t;
+   using iterator       = T*;
+   using const_iterator = const T*;
+   using result_type    = DynamicArray<T>;
+
+   /** Constructors */
+   MappedArray() = default;
+
+   /** Map an existing file, whose size must be a multiple of the entry size. */
+   MappedArray(const Path& file_path, const MapMode mode);
+
+   /** Create (or overwrite) a file holding the given number of (zero-initialised) entries, and map it for reading and writing. */
+   MappedArray(const Path& file_path, const size_t size);
+
+   /** Resize a read-write array (and its file). Pointers and iterators to entries are invalidated. */
+   void Resize(const size_t size);
+
+   /** Write the modified entries back to the file, for read-write arrays. */
+   void Flush() { File_.Flush(); }
+
+   /** Advise the kernel of the access pattern of all entries, or of the given range of entries. */
+   void Advise(const AccessPattern pattern) const { File_.Advise(pattern); }
+
+   void Advise(const AccessPattern pattern, const size_t first, const size_t n_entries) const
+   {
+      File_.Advise(pattern, first * sizeof(T), n_entries * sizeof(T));
+   }
+
+   MapMode Mode() const noexcept { return File_.Mode(); }
+
+   /** Size and Data Access */
+   size_t size() const noexcept { return File_.Size() / sizeof(T); }
+
+   bool empty() const noexcept { return size() == 0; }
+
+   T* data() noexcept { return reinterpret_cast<T*>(File_.Data()); }
+
+   const T* data() const noexcept { return reinterpret_cast<const T*>(File_.Data()); }
+
+   /** Iterators */
+   T* begin() noexcept { return data(); }
+
+   const T* begin() const noexcept { return data(); }
+
+   T* end() noexcept { return data() + size(); }
+
+   const T* end() const noexcept { return data() + size(); }
+
+   /** Operators */
+   using BaseArray::operator[];
+   using BaseArray::operator=;
+   using BaseContainer::operator=;
+
+ private:
+   MappedFile File_;
+};
+
+/***************************************************************************************************************************************************************
+* Mapped Multi-dimensional Array Class
+***************************************************************************************************************************************************************/
+
+/** Multi-dimensional array over a memory-mapped file, whose entries are stored in the file in the order of the given layout. */
+template<typename T, class L = layout::ColumnMajor>
+class MappedMultiArray : public MultiArray<T, MappedMultiArray<T, L>>
+{
+ public:
+   using layout_type = L;
+
+   /** Constructors */
+   MappedMultiArray() = default;
+
+   /** Map an existing file, whose size must match the given dimensions. */
+   MappedMultiArray(const Path& file_path, const MapMode mode, const std::convertible_to<size_t> auto... _dimensions);
+
+   /** Create (or overwrite) a file holding a (zero-initialised) multi-array of the given dimensions, and map it for reading and writing. */
+   MappedMultiArray(const Path& file_path, const std::convertible_to<size_t> auto... _dimensions);
+
+   void Flush() { Entries.Flush(); }
+
+   void Advise(const AccessPattern pattern) const { Entries.Advise(pattern); }
+
+   MapMode Mode() const noexcept { return Entries.Mode(); }
+
+ private:
+   DynamicArray<size_t> Dimensions;
+   size_t nEntries{0};
+   MappedArray<T> Entries;
+
+   friend MultiArray<T, MappedMultiArray<T, L>>;
+};
+
+}
+
+#include "MappedArray.tpp"
@@ -0,0 +1,52 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+namespace aprn::flmgr {
+
+/***************************************************************************************************************************************************************
+* Mapped Array Class
+***************************************************************************************************************************************************************/
+template<typename T>
+MappedArray<T>::MappedArray(const Path& file_path, const MapMode mode)
+   : File_(file_path, mode)
+{
+   ASSERT(File_.Size() % sizeof(T) == 0, "The size of the file ", file_path.filename(), " is not a multiple of the entry size ", sizeof(T), ".")
+}
+
+template<typename T>
+MappedArray<T>::MappedArray(const Path& file_path, const size_t size)
+   : File_(file_path, size * sizeof(T)) {}
+
+template<typename T>
+void
+MappedArray<T>::Resize(const size_t size) { File_.Resize(size * sizeof(T)); }
+
+/***************************************************************************************************************************************************************
+* Mapped Multi-dimensional Array Class
+***************************************************************************************************************************************************************/
+template<typename T, class L>
+MappedMultiArray<T, L>::MappedMultiArray(const Path& file_path, const MapMode mode, const std::convertible_to<size_t> auto... _dimensions)
+   : Dimensions{static_cast<size_t>(_dimensions)...}, nEntries(Product(_dimensions...)), Entries(file_path, mode)
+{
+   ASSERT(Entries.size() == L::Capacity(Dimensions), "The file ", file_path.filename(), " holds ", Entries.size(), " entries, whereas the dimensions require ",
+          L::Capacity(Dimensions), ".")
+}
+
+template<typename T, class L>
+MappedMultiArray<T, L>::MappedMultiArray(const Path& file_path, const std::convertible_to<size_t> auto... _dimensions)
+   : Dimensions{static_cast<size_t>(_dimensions)...}, nEntries(Product(_dimensions...)), Entries(file_path, L::Capacity(Dimensions)) {}
+
+}
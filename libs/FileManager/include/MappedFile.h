@@ -0,0 +1,109 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "FileSystem.h"
+
+#include <cstddef>
+
+namespace aprn::flmgr {
+
+/** Mapping modes. Read mappings are read-only, so their pages are never copied and files of any size can be mapped. Changes to a copy-on-write mapping
+    are private to the process, and are never written back to the file, whereas changes to a read-write mapping are shared with the file. */
+enum class MapMode
+{
+   Read,
+   CopyOnWrite,
+   ReadWrite
+};
+
+/** Expected page access patterns, passed on to the kernel (madvise) to tune read-ahead and page eviction. */
+enum class AccessPattern
+{
+   Normal,     // Moderate read-ahead
+   Sequential, // Aggressive read-ahead; pages may be freed soon after they are accessed
+   Random,     // No read-ahead
+   WillNeed,   // Read the pages ahead of their access
+   DontNeed    // The pages will not be accessed in the near future
+};
+
+/***************************************************************************************************************************************************************
+* Mapped File Class
+***************************************************************************************************************************************************************/
+
+/** Memory mapping of a whole file, which is paged in from disk on demand. Files larger than the available memory can hence be mapped, as pages are evicted
+    by the kernel as required. */
+class MappedFile
+{
+ public:
+   MappedFile() = default;
+
+   /** Map an existing file. */
+   MappedFile(const Path& file_path, const MapMode mode);
+
+   /** Create (or overwrite) a file of the given size in bytes, and map it for reading and writing. */
+   MappedFile(const Path& file_path, const size_t n_bytes);
+
+   MappedFile(const MappedFile&) = delete;
+
+   MappedFile(MappedFile&& other) noexcept;
+
+   ~MappedFile() { if(isOpen()) Close(); }
+
+   MappedFile& operator=(const MappedFile&) = delete;
+
+   MappedFile& operator=(MappedFile&& other) noexcept;
+
+   void Close();
+
+   /** Resize a read-write mapping (and its file), which may move the mapping. */
+   void Resize(const size_t n_bytes);
+
+   /** Write the changes of a read-write mapping back to the file, and wait until they are written. */
+   void Flush();
+
+   /** Advise the kernel of the access pattern of the given byte range (the whole mapping by default). DontNeed is ignored for copy-on-write mappings, whose
+       modified pages would otherwise be discarded. */
+   void Advise(const AccessPattern pattern, const size_t offset = 0, const size_t n_bytes = -1) const;
+
+   /** Writable data, which read mappings do not provide. */
+   inline std::byte* Data() noexcept
+   {
+      DEBUG_ASSERT(Mode_ != MapMode::Read, "The file ", Path_.filename(), " is mapped read-only.")
+      return Data_;
+   }
+
+   inline const std::byte* Data() const noexcept { return Data_; }
+
+   inline size_t Size() const noexcept { return Size_; }
+
+   inline MapMode Mode() const noexcept { return Mode_; }
+
+   inline bool isOpen() const noexcept { return Descriptor_ != -1; }
+
+ private:
+   void Map();
+
+   void Unmap();
+
+   Path       Path_;
+   int        Descriptor_{-1};
+   MapMode    Mode_{MapMode::Read};
+   std::byte* Data_{nullptr};
+   size_t     Size_{0};
+};
+
+}
@@ -0,0 +1,256 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include "../include/ArrayFile.h"
+
+#include <bit>
+#include <cstring>
+#include <utility>
+
+namespace aprn::flmgr {
+
+namespace {
+
+constexpr char          Magic[8]{'A', 'P', 'R', 'N', 'A', 'R', 'R', 'Y'};
+constexpr std::uint32_t ByteOrderMark{0x01020304};
+constexpr std::uint32_t FormatVersion{1};
+constexpr std::uint32_t ChecksumFlag{1};
+constexpr size_t        FixedHeaderSize{48};
+
+template<typename U>
+void
+Put(std::byte* data, size_t& cursor, const U value)
+{
+   std::memcpy(data + cursor, &value, sizeof(U));
+   cursor += sizeof(U);
+}
+
+template<typename U>
+U
+Get(const std::byte* data, size_t& cursor)
+{
+   U value;
+   std::memcpy(&value, data + cursor, sizeof(U));
+   cursor += sizeof(U);
+   return value;
+}
+
+std::uint64_t
+LoadWord(const std::byte* data)
+{
+   std::uint64_t word;
+   std::memcpy(&word, data, sizeof(word));
+   return word;
+}
+
+size_t
+EntrySize(const DataType type)
+{
+   switch(type)
+   {
+      case DataType::Int8:  case DataType::UInt8:                          return 1;
+      case DataType::Int16: case DataType::UInt16:                         return 2;
+      case DataType::Int32: case DataType::UInt32: case DataType::Float32: return 4;
+      case DataType::Int64: case DataType::UInt64: case DataType::Float64: return 8;
+      default:                                                             return 0;
+   }
+}
+
+}
+
+/***************************************************************************************************************************************************************
+* Array File Format
+***************************************************************************************************************************************************************/
+namespace detail {
+
+ChunkGrid::ChunkGrid(const MultiIndex& dimensions, const MultiIndex& chunk_dimensions, const StorageOrder order)
+   : Dimensions_(dimensions), ChunkDimensions_(chunk_dimensions), Counts_(dimensions.size()), Order_(order)
+{
+   ASSERT(chunk_dimensions.size() == dimensions.size(), "The chunk rank ", chunk_dimensions.size(), " must match the array rank ", dimensions.size(), ".")
+
+   FOR(i, dimensions.size())
+   {
+      ASSERT(chunk_dimensions[i] != 0, "The chunk dimensions must be non-zero.")
+      ChunkDimensions_[i] = Min(chunk_dimensions[i], Max(dimensions[i], size_t(1)));
+      Counts_[i] = (dimensions[i] + ChunkDimensions_[i] - 1) / ChunkDimensions_[i];
+   }
+   nChunks_ = Product(Counts_.begin(), Counts_.end());
+}
+
+void
+ChunkGrid::Chunk(const size_t index, MultiIndex& first, MultiIndex& extents) const
+{
+   DEBUG_ASSERT(index < nChunks_, "The chunk index ", index, " must be lesser than the number of chunks ", nChunks_, ".")
+
+   first.resize(Dimensions_.size());
+   extents.resize(Dimensions_.size());
+   if(Order_ == StorageOrder::RowMajor) layout::RowMajor::MultiIndex(Counts_, index, first);
+   else layout::ColumnMajor::MultiIndex(Counts_, index, first);
+
+   FOR(i, Dimensions_.size())
+   {
+      first[i] *= ChunkDimensions_[i];
+      extents[i] = Min(ChunkDimensions_[i], Dimensions_[i] - first[i]);
+   }
+}
+
+StrideArray
+Strides(const MultiIndex& dimensions, const StorageOrder order)
+{
+   return order == StorageOrder::RowMajor ? layout::RowMajor::Strides(dimensions) : layout::ColumnMajor::Strides(dimensions);
+}
+
+std::uint64_t
+Checksum(const std::byte* data, const size_t n_bytes)
+{
+   constexpr std::uint64_t prime0{0x9E3779B185EBCA87};
+   constexpr std::uint64_t prime1{0xC2B2AE3D27D4EB4F};
+   constexpr std::uint64_t prime2{0x165667B19E3779F9};
+   constexpr std::uint64_t prime3{0x85EBCA77C2B2AE63};
+   constexpr std::uint64_t prime4{0x27D4EB2F165667C5};
+   const auto round = [](const std::uint64_t hash, const std::uint64_t word) { return std::rotl(hash + word * prime1, 31) * prime0; };
+
+   // Hash 32-byte blocks in four independent lanes, which pipeline well, then fold in the remaining words and bytes.
+   size_t i(0);
+   std::uint64_t hash(prime4);
+   if(n_bytes >= 32)
+   {
+      std::uint64_t lanes[4]{prime0 + prime1, prime1, 0, -prime0};
+      for(; i + 32 <= n_bytes; i += 32) FOR(lane, 4) lanes[lane] = round(lanes[lane], LoadWord(data + i + 8 * lane));
+      hash = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18);
+   }
+
+   hash += n_bytes;
+   for(; i + 8 <= n_bytes; i += 8) hash = std::rotl(hash ^ round(0, LoadWord(data + i)), 27) * prime0 + prime3;
+   for(; i < n_bytes; ++i) hash = std::rotl(hash ^ (std::to_integer<std::uint64_t>(data[i]) * prime4), 11) * prime0;
+
+   hash ^= hash >> 33;
+   hash *= prime1;
+   hash ^= hash >> 29;
+   hash *= prime2;
+   hash ^= hash >> 32;
+   return hash;
+}
+
+size_t
+HeaderSize(const size_t rank, const size_t n_chunks)
+{
+   const size_t n_bytes = FixedHeaderSize + 2 * rank * sizeof(std::uint64_t) + n_chunks * sizeof(ChunkRecord) + sizeof(std::uint64_t);
+   return (n_bytes + ChunkAlignment - 1) / ChunkAlignment * ChunkAlignment;
+}
+
+DynamicArray<std::byte>
+EncodeHeader(const ChunkGrid& grid, const DataType type, const size_t entry_size, const bool is_checksummed, const DynamicArray<ChunkRecord>& chunks)
+{
+   const size_t rank = grid.Dimensions().size();
+   DynamicArray<std::byte> header(HeaderSize(rank, chunks.size()), std::byte(0));
+   std::byte* data = header.data();
+
+   size_t cursor(0);
+   std::memcpy(data, Magic, sizeof(Magic));
+   cursor += sizeof(Magic);
+   Put(data, cursor, ByteOrderMark);
+   Put(data, cursor, FormatVersion);
+   Put(data, cursor, static_cast<std::uint32_t>(type));
+   Put(data, cursor, static_cast<std::uint32_t>(entry_size));
+   Put(data, cursor, static_cast<std::uint32_t>(grid.Order()));
+   Put(data, cursor, is_checksummed ? ChecksumFlag : std::uint32_t(0));
+   Put(data, cursor, static_cast<std::uint64_t>(rank));
+   Put(data, cursor, static_cast<std::uint64_t>(chunks.size()));
+
+   for(const auto dimension : grid.Dimensions()) Put(data, cursor, static_cast<std::uint64_t>(dimension));
+   for(const auto dimension : grid.ChunkDimensions()) Put(data, cursor, static_cast<std::uint64_t>(dimension));
+   for(const auto& chunk : chunks)
+   {
+      Put(data, cursor, chunk.Offset);
+      Put(data, cursor, chunk.Size);
+      Put(data, cursor, chunk.Checksum);
+   }
+   Put(data, cursor, Checksum(data, cursor));
+
+   return header;
+}
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* Array File Class
+***************************************************************************************************************************************************************/
+ArrayFile::ArrayFile(const Path& file_path)
+   : File_(file_path, MapMode::Read)
+{
+   const std::byte* data = std::as_const(File_).Data();
+   const size_t file_size = File_.Size();
+   ASSERT(file_size >= FixedHeaderSize && std::memcmp(data, Magic, sizeof(Magic)) == 0, "The file ", file_path.filename(), " is not an array file.")
+
+   size_t cursor(sizeof(Magic));
+   ASSERT(Get<std::uint32_t>(data, cursor) == ByteOrderMark, "The array file ", file_path.filename(), " was written with a different byte order.")
+   ASSERT(Get<std::uint32_t>(data, cursor) <= FormatVersion, "The array file ", file_path.filename(), " was written by a newer format version.")
+
+   Type_ = static_cast<DataType>(Get<std::uint32_t>(data, cursor));
+   const auto entry_size = Get<std::uint32_t>(data, cursor);
+   ASSERT(EntrySize(Type_) != 0 && EntrySize(Type_) == entry_size, "The array file ", file_path.filename(), " has an unknown data type.")
+
+   const auto order = static_cast<StorageOrder>(Get<std::uint32_t>(data, cursor));
+   ASSERT(order == StorageOrder::ColumnMajor || order == StorageOrder::RowMajor, "The array file ", file_path.filename(), " has an unknown storage order.")
+
+   isChecksummed_ = Get<std::uint32_t>(data, cursor) & ChecksumFlag;
+   const auto rank     = Get<std::uint64_t>(data, cursor);
+   const auto n_chunks = Get<std::uint64_t>(data, cursor);
+   ASSERT(rank < file_size && n_chunks < file_size && detail::HeaderSize(rank, n_chunks) <= file_size, "The array file ", file_path.filename(),
+          " is truncated.")
+
+   MultiIndex dimensions(rank), chunk_dimensions(rank);
+   for(auto& dimension : dimensions) dimension = Get<std::uint64_t>(data, cursor);
+   for(auto& dimension : chunk_dimensions) dimension = Get<std::uint64_t>(data, cursor);
+   Chunks_.resize(n_chunks);
+   for(auto& chunk : Chunks_)
+   {
+      chunk.Offset   = Get<std::uint64_t>(data, cursor);
+      chunk.Size     = Get<std::uint64_t>(data, cursor);
+      chunk.Checksum = Get<std::uint64_t>(data, cursor);
+   }
+   const auto header_checksum = detail::Checksum(data, cursor);
+   ASSERT(Get<std::uint64_t>(data, cursor) == header_checksum, "The header of the array file ", file_path.filename(), " is corrupt.")
+
+   Grid_ = detail::ChunkGrid(dimensions, chunk_dimensions, order);
+   ASSERT(Grid_.size() == n_chunks, "The chunk table of the array file ", file_path.filename(), " does not match its dimensions.")
+
+   MultiIndex first, extents;
+   FOR(i, n_chunks)
+   {
+      Grid_.Chunk(i, first, extents);
+      const auto& chunk = Chunks_[i];
+      ASSERT(chunk.Offset % detail::ChunkAlignment == 0 && chunk.Size == Product(extents.begin(), extents.end()) * entry_size &&
+             chunk.Offset <= file_size && chunk.Size <= file_size - chunk.Offset, "The array file ", file_path.filename(), " is truncated.")
+   }
+}
+
+bool
+ArrayFile::Verify() const
+{
+   FOR(i, ChunkCount()) if(!VerifyChunk(i)) return false;
+   return true;
+}
+
+bool
+ArrayFile::VerifyChunk(const size_t index) const
+{
+   DEBUG_ASSERT(index < ChunkCount(), "The chunk index ", index, " must be lesser than the number of chunks ", ChunkCount(), ".")
+
+   const auto& chunk = Chunks_[index];
+   return !isChecksummed_ || detail::Checksum(File_.Data() + chunk.Offset, chunk.Size) == chunk.Checksum;
+}
+
+}
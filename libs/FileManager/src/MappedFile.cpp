@@ -0,0 +1,154 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include "../include/MappedFile.h"
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace aprn::flmgr {
+
+/***************************************************************************************************************************************************************
+* Mapped File Public Interface
+***************************************************************************************************************************************************************/
+MappedFile::MappedFile(const Path& file_path, const MapMode mode)
+   : Path_(file_path), Mode_(mode)
+{
+   ASSERT(FileExists(file_path), "The file ", file_path.filename(), " does not exist.")
+
+   Descriptor_ = open(file_path.c_str(), mode == MapMode::ReadWrite ? O_RDWR : O_RDONLY);
+   ASSERT(Descriptor_ != -1, "Could not open the file ", file_path.filename(), ": ", std::strerror(errno))
+
+   struct stat status;
+   ASSERT(fstat(Descriptor_, &status) == 0, "Could not determine the size of the file ", file_path.filename(), ": ", std::strerror(errno))
+   Size_ = static_cast<size_t>(status.st_size);
+
+   Map();
+}
+
+MappedFile::MappedFile(const Path& file_path, const size_t n_bytes)
+   : Path_(file_path), Mode_(MapMode::ReadWrite), Size_(n_bytes)
+{
+   Descriptor_ = open(file_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+   ASSERT(Descriptor_ != -1, "Could not create the file ", file_path.filename(), ": ", std::strerror(errno))
+   ASSERT(ftruncate(Descriptor_, static_cast<off_t>(n_bytes)) == 0, "Could not size the file ", file_path.filename(), ": ", std::strerror(errno))
+
+   Map();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+   : Path_(std::move(other.Path_)), Descriptor_(std::exchange(other.Descriptor_, -1)), Mode_(other.Mode_), Data_(std::exchange(other.Data_, nullptr)),
+     Size_(std::exchange(other.Size_, 0)) {}
+
+MappedFile&
+MappedFile::operator=(MappedFile&& other) noexcept
+{
+   if(this != &other)
+   {
+      if(isOpen()) Close();
+      Path_       = std::move(other.Path_);
+      Descriptor_ = std::exchange(other.Descriptor_, -1);
+      Mode_       = other.Mode_;
+      Data_       = std::exchange(other.Data_, nullptr);
+      Size_       = std::exchange(other.Size_, 0);
+   }
+   return *this;
+}
+
+void
+MappedFile::Close()
+{
+   ASSERT(isOpen(), "The file ", Path_.filename(), " had not been mapped yet.")
+
+   Unmap();
+   close(Descriptor_);
+   Descriptor_ = -1;
+   Size_ = 0;
+   Path_ = "";
+}
+
+void
+MappedFile::Resize(const size_t n_bytes)
+{
+   ASSERT(Mode_ == MapMode::ReadWrite, "Only read-write mappings can be resized.")
+
+   Unmap();
+   ASSERT(ftruncate(Descriptor_, static_cast<off_t>(n_bytes)) == 0, "Could not resize the file ", Path_.filename(), ": ", std::strerror(errno))
+   Size_ = n_bytes;
+   Map();
+}
+
+void
+MappedFile::Flush()
+{
+   if(Mode_ == MapMode::ReadWrite && Data_)
+      ASSERT(msync(Data_, Size_, MS_SYNC) == 0, "Could not write the mapping back to the file ", Path_.filename(), ": ", std::strerror(errno))
+}
+
+void
+MappedFile::Advise(const AccessPattern pattern, const size_t offset, const size_t n_bytes) const
+{
+   // Dropping the pages of a private mapping would discard its modifications, which only exist in those pages.
+   if(!Data_ || offset >= Size_ || (pattern == AccessPattern::DontNeed && Mode_ == MapMode::CopyOnWrite)) return;
+
+   // The advised range must start on a page boundary.
+   const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+   const size_t first = offset / page_size * page_size;
+   const size_t last  = Min(Size_, n_bytes > Size_ - offset ? Size_ : offset + n_bytes);
+
+   int advice;
+   switch(pattern)
+   {
+      case AccessPattern::Sequential: advice = MADV_SEQUENTIAL; break;
+      case AccessPattern::Random:     advice = MADV_RANDOM;     break;
+      case AccessPattern::WillNeed:   advice = MADV_WILLNEED;   break;
+      case AccessPattern::DontNeed:   advice = MADV_DONTNEED;   break;
+      default:                        advice = MADV_NORMAL;     break;
+   }
+
+   // Advice is only a hint, so failures are not fatal.
+   if(madvise(Data_ + first, last - first, advice) != 0) WARN("Could not advise the access pattern of the file ", Path_.filename(), ".")
+}
+
+/***************************************************************************************************************************************************************
+* Mapped File Private Interface
+***************************************************************************************************************************************************************/
+void
+MappedFile::Map()
+{
+   // Empty files cannot be mapped, so they are left unmapped until resized.
+   if(Size_ == 0) return;
+
+   // Read-only mappings are shared, so that their pages are never committed to the process.
+   const int protection = Mode_ == MapMode::Read ? PROT_READ : PROT_READ | PROT_WRITE;
+   void* data = mmap(nullptr, Size_, protection, Mode_ == MapMode::CopyOnWrite ? MAP_PRIVATE : MAP_SHARED, Descriptor_, 0);
+   ASSERT(data != MAP_FAILED, "Could not map the file ", Path_.filename(), ": ", std::strerror(errno))
+   Data_ = static_cast<std::byte*>(data);
+}
+
+void
+MappedFile::Unmap()
+{
+   if(!Data_) return;
+   munmap(Data_, Size_);
+   Data_ = nullptr;
+}
+
+}
@@ -13,7 +13,11 @@
 ***************************************************************************************************************************************************************/
 
 #include <gtest/gtest.h>
+#include "../include/ArrayFile.h"
 #include "../include/FileSystem.h"
+#include "../include/MappedArray.h"
+#include "DataContainer/include/Reduction.h"
+#include "Tensor/include/Tensor.h"
 
 #include <filesystem>
 #include <string_view>
@@ -93,6 +97,187 @@ TEST_F(FileHandlerTest, MoveDirectory)
 
 }
 
+/***************************************************************************************************************************************************************
+* Test Memory-mapped Arrays
+***************************************************************************************************************************************************************/
+TEST_F(FileHandlerTest, MappedArray)
+{
+   const Path file_path = fs::temp_directory_path() / "apeiron_mapped_array.bin";
+
+   // Create a file, and write to it through the numeric container interface.
+   {
+      MappedArray<Real> array(file_path, 1000);
+      EXPECT_EQ(array.size(), 1000);
+      EXPECT_EQ(fs::file_size(file_path), 1000 * sizeof(Real));
+      EXPECT_EQ(array[999], 0.0);
+
+      array.Advise(AccessPattern::Sequential);
+      FOR(i, array.size()) array[i] = static_cast<Real>(i);
+      array *= 2.0;
+      array.Flush();
+   }
+
+   // Read mappings are read-only, and changes to a copy-on-write mapping are not written back.
+   {
+      const MappedArray<Real> array(file_path, MapMode::Read);
+      EXPECT_EQ(array.size(), 1000);
+      EXPECT_EQ(array[10], 20.0);
+      EXPECT_EQ(reduce::Sum(array), 999000.0);
+
+      DynamicArray<Real> sum = array + array;
+      EXPECT_EQ(sum[999], 3996.0);
+
+      array.Advise(AccessPattern::Random, 500, 100);
+      EXPECT_DEATH(const_cast<MappedArray<Real>&>(array).data(), "");
+   }
+   {
+      MappedArray<Real> array(file_path, MapMode::CopyOnWrite);
+      array = 1.0;
+      EXPECT_EQ(array[10], 1.0);
+
+      array.Advise(AccessPattern::DontNeed);
+      EXPECT_EQ(array[10], 1.0);
+   }
+   {
+      MappedArray<Real> array(file_path, MapMode::ReadWrite);
+      EXPECT_EQ(array[10], 20.0);
+
+      array.Resize(10);
+      EXPECT_EQ(fs::file_size(file_path), 10 * sizeof(Real));
+      array = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
+   }
+
+   // Multi-array over the same file, with the entries of a 2 x 5 column-major array.
+   {
+      const MappedMultiArray<Real> multi_array(file_path, MapMode::Read, 2, 5);
+      EXPECT_EQ(multi_array(1, 3), 7.0);
+      EXPECT_EQ(multi_array.Slice(0, 1)(2), 5.0);
+      EXPECT_DEATH(MappedMultiArray<Real>(file_path, MapMode::Read, 3, 3), "");
+   }
+   {
+      MappedMultiArray<float, layout::Tiled<4>> multi_array(file_path, 5, 6);
+      EXPECT_EQ(fs::file_size(file_path), 64 * sizeof(float));
+
+      multi_array.ForEach([](float& entry, const auto& multi_index) { entry = static_cast<float>(multi_index[0] + 10 * multi_index[1]); });
+      EXPECT_EQ(multi_array(4, 5), 54.0f);
+   }
+
+   EXPECT_DEATH(MappedArray<Real>(DataDir + "/image.png", MapMode::Read), "");
+   DeleteFile(file_path);
+}
+
+TEST_F(FileHandlerTest, ArrayFile)
+{
+   const Path file_path = fs::temp_directory_path() / "apeiron_array_file.bin";
+
+   DynamicMultiArray<Real> array(13, 7, 5);
+   array.ForEach([](Real& entry, const auto& multi_index) { entry = multi_index[0] + 0.01 * multi_index[1] + 1.0e-5 * multi_index[2] + 1.0 / 3.0; });
+
+   // Single chunk, which can be viewed in place.
+   {
+      WriteArrayFile(file_path, array);
+      const ArrayFile file(file_path);
+      EXPECT_EQ(file.Type(), DataType::Float64);
+      EXPECT_EQ(file.Order(), StorageOrder::ColumnMajor);
+      ASSERT_EQ(file.Rank(), 3);
+      EXPECT_EQ(file.Dimension(1), 7);
+      EXPECT_EQ(file.ChunkCount(), 1);
+      EXPECT_FALSE(file.isChecksummed());
+      EXPECT_TRUE(file.Verify());
+
+      const auto view = file.View<Real>();
+      EXPECT_EQ(view.size(), 13 * 7 * 5);
+      EXPECT_TRUE(std::equal(view.begin(), view.end(), array.begin()));
+      EXPECT_DEATH(file.View<float>(), "");
+   }
+
+   // Chunks, checksums, and reads of sub-blocks and into other storage orders.
+   {
+      WriteArrayFile(file_path, array, {.ChunkDimensions = {4, 3, 2}, .isChecksummed = true});
+      const ArrayFile file(file_path);
+      EXPECT_EQ(file.ChunkCount(), 4 * 3 * 3);
+      EXPECT_EQ(file.ChunkDimensions()[2], 2);
+      EXPECT_TRUE(file.isChecksummed());
+      EXPECT_TRUE(file.Verify());
+      EXPECT_DEATH(file.View<Real>(), "");
+
+      MultiIndex first, extents;
+      file.Chunk(5, first, extents);
+      EXPECT_EQ(first[0], 4);
+      EXPECT_EQ(first[1], 3);
+      const auto chunk = file.ChunkView<Real>(file.ChunkCount() - 1);
+      EXPECT_EQ(chunk.size(), 1 * 1 * 1);
+      EXPECT_EQ(chunk(0, 0, 0), array(12, 6, 4));
+
+      DynamicMultiArray<Real> whole;
+      file.Read(whole);
+      EXPECT_TRUE(std::equal(whole.begin(), whole.end(), array.begin()));
+
+      DynamicMultiArray<Real, layout::RowMajor> block;
+      file.ReadBlock({2, 1, 1}, {9, 5, 3}, block);
+      EXPECT_EQ(block.Dimension(0), 9);
+      FOR(i, 9) FOR(j, 5) FOR(k, 3) EXPECT_EQ(block(i, j, k), array(i + 2, j + 1, k + 1));
+   }
+
+   // Row-major tensors, read into column-major tensors.
+   {
+      DynamicMultiArray<float, layout::RowMajor> row_major(6, 4);
+      row_major.ForEach([](float& entry, const auto& multi_index) { entry = static_cast<float>(multi_index[0] * 10 + multi_index[1]); });
+      WriteArrayFile(file_path, row_major, {.ChunkDimensions = {4, 4}});
+
+      DynamicTensor<float> tensor;
+      const ArrayFile file(file_path);
+      EXPECT_EQ(file.Type(), DataType::Float32);
+      EXPECT_EQ(file.Order(), StorageOrder::RowMajor);
+      file.Read(tensor);
+      ASSERT_EQ(tensor.Rank(), 2);
+      FOR(i, 6) FOR(j, 4) EXPECT_EQ(tensor(i, j), row_major(i, j));
+
+      WriteArrayFile(file_path, tensor);
+      DynamicMultiArray<float> copy;
+      ArrayFile(file_path).Read(copy);
+      EXPECT_EQ(copy(5, 3), 53.0f);
+   }
+
+   // Rank-0 (scalar) arrays.
+   {
+      DynamicTensor<Real> scalar(MultiIndex{});
+      scalar[0] = Pi;
+      WriteArrayFile(file_path, scalar, {.ChunkDimensions = {}, .isChecksummed = true});
+      const ArrayFile file(file_path);
+      EXPECT_EQ(file.Rank(), 0);
+      EXPECT_EQ(file.size(), 1);
+      EXPECT_TRUE(file.Verify());
+      EXPECT_EQ(file.View<Real>()[0], Pi);
+
+      DynamicTensor<Real> copy(2, 2);
+      file.Read(copy);
+      EXPECT_EQ(copy.Rank(), 0);
+      EXPECT_EQ(copy[0], Pi);
+   }
+
+   // Corrupt entries fail their chunk's checksum, and are not read.
+   {
+      WriteArrayFile(file_path, array, {.ChunkDimensions = {13, 7, 1}, .isChecksummed = true});
+      {
+         MappedFile mapping(file_path, MapMode::ReadWrite);
+         mapping.Data()[mapping.Size() - 1] ^= std::byte(1);
+      }
+      const ArrayFile file(file_path);
+      EXPECT_FALSE(file.Verify());
+      EXPECT_TRUE(file.VerifyChunk(3));
+      EXPECT_FALSE(file.VerifyChunk(4));
+
+      DynamicMultiArray<Real> block;
+      file.ReadBlock({0, 0, 0}, {13, 7, 4}, block);
+      EXPECT_EQ(block(12, 6, 3), array(12, 6, 3));
+      EXPECT_DEATH(file.Read(block), "");
+   }
+
+   EXPECT_DEATH(ArrayFile(DataDir + "/empty_file.txt"), "");
+   DeleteFile(file_path);
+}
+
 }
 
 #endif
\ No newline at end of file
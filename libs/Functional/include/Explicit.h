@@ -21,33 +21,43 @@ namespace aprn::func {
 
 /***************************************************************************************************************************************************************
 * Functions from R -> R
+*
+* The functions are generic over the floating-point type of their arguments, so that they may be evaluated at single precision, as well as at Real.
 ***************************************************************************************************************************************************************/
-constexpr Real
-Linear(const Real x, const Real c0, const Real c1) { return c0 + c1 * x; }
+template<std::floating_point T>
+constexpr T
+Linear(const T x, const std::type_identity_t<T> c0, const std::type_identity_t<T> c1) { return c0 + c1 * x; }
 
-constexpr Real
-Quadratic(const Real x, const Real c0, const Real c1, const Real c2) { return c0 + c1 * x + c2 * x * x; }
+template<std::floating_point T>
+constexpr T
+Quadratic(const T x, const std::type_identity_t<T> c0, const std::type_identity_t<T> c1, const std::type_identity_t<T> c2) { return c0 + c1 * x + c2 * x * x; }
 
-constexpr Real
-Cubic(const Real x, const Real c0, const Real c1, const Real c2, const Real c3) { return c0 + c1 * x + c2 * x * x + c3 * x * x * x; }
+template<std::floating_point T>
+constexpr T
+Cubic(const T x, const std::type_identity_t<T> c0, const std::type_identity_t<T> c1, const std::type_identity_t<T> c2, const std::type_identity_t<T> c3)
+{ return c0 + c1 * x + c2 * x * x + c3 * x * x * x; }
 
 /***************************************************************************************************************************************************************
 * Functions from R -> R^n
 ***************************************************************************************************************************************************************/
-constexpr SVectorR2
-Ellipse(const SVectorR2& radii, const Real theta) { return {radii[0] * std::cos(theta), radii[1] * std::sin(theta)}; }
+template<std::floating_point T>
+constexpr SVector2<T>
+Ellipse(const SVector2<T>& radii, const T theta) { return {radii[0] * std::cos(theta), radii[1] * std::sin(theta)}; }
 
-constexpr SVectorR2
-Circle(const Real radius, const Real theta) { return Ellipse({radius, radius}, theta); }
+template<std::floating_point T>
+constexpr SVector2<T>
+Circle(const T radius, const T theta) { return Ellipse(SVector2<T>{radius, radius}, theta); }
 
-constexpr SVectorR3
-Ellipsoid(const SVectorR3& _radii, const Real _theta, const Real _phi)
+template<std::floating_point T>
+constexpr SVector3<T>
+Ellipsoid(const SVector3<T>& _radii, const T _theta, const T _phi)
 {
    return { _radii[0] * std::cos(_theta) * std::sin(_phi), _radii[1] * std::sin(_theta) * std::sin(_phi), _radii[2] * std::cos(_phi) };
 }
 
-constexpr SVectorR3
-Sphere(const Real radius, const Real _theta, const Real _phi) { return Ellipsoid({radius, radius, radius}, _theta, _phi); }
+template<std::floating_point T>
+constexpr SVector3<T>
+Sphere(const T radius, const T _theta, const T _phi) { return Ellipsoid(SVector3<T>{radius, radius, radius}, _theta, _phi); }
 
 //template<int p, int dimension = 1, typename T>
 //constexpr T Polynomial(const StaticArray<T, dimension>& point, )
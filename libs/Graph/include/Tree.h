@@ -16,6 +16,7 @@
 
 #include "../../../include/Global.h"
 #include "../../DataContainer/include/Array.h"
+#include "../../DataContainer/include/SmallArray.h"
 
 #include <memory>
 
@@ -43,7 +44,7 @@ struct StaticNode final : public Node<T> { StaticArray<std::shared_ptr<Node<T>>,
 
 /** Dynamic node class (unknown number of children) */
 template<class T>
-struct DynamicNode final : public Node<T> { DynamicArray<std::shared_ptr<Node<T>>> Children; };
+struct DynamicNode final : public Node<T> { SmallArray<std::shared_ptr<Node<T>>, 4> Children; };
 
 /***************************************************************************************************************************************************************
 * Generic Tree Class Definition
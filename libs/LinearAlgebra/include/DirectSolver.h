@@ -0,0 +1,300 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "../../DataContainer/include/Array.h"
+#include "../../DataContainer/include/Parallel.h"
+#include "GEMM.h"
+#include "Matrix.h"
+#include "Vector.h"
+
+/***************************************************************************************************************************************************************
+* Direct Linear Solvers
+*
+* Factorisations of dense matrices, which are computed once and can then be reused to solve for any number of right-hand sides. The factorisations are
+* blocked: each panel of columns is factorised on its own, and the (much larger) update of the trailing matrix is computed with the cache-blocked,
+* multithreaded matrix multiplication kernels (see GEMM.h). Small static matrices are instead inverted and solved in closed form.
+***************************************************************************************************************************************************************/
+
+namespace aprn {
+namespace detail {
+
+/** Number of columns of each panel of the blocked factorisations. */
+constexpr size_t FactorisationPanel = 64;
+
+/** Apply a function to each of n_rhs right-hand sides, distributing them over threads if the number of factor entries read in total is large enough. */
+template<class F>
+void
+ForEachRightHandSide(const size_t n_rhs, const size_t n_entries, F&& solve_column)
+{
+  #pragma omp parallel for schedule(static) if(parallel::isParallel(n_rhs * n_entries))
+  for(size_t j = 0; j < n_rhs; ++j) solve_column(j);
+}
+
+/** Substitution with the upper-triangular n x n part of a column-major matrix with leading dimension lda, or with its unit lower-triangular part. */
+template<typename T>
+void
+SubstituteUpper(const T* a, const size_t lda, const size_t n, T* b);
+
+template<typename T>
+void
+SubstituteUnitLower(const T* a, const size_t lda, const size_t n, T* b);
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* LU Factorisation
+***************************************************************************************************************************************************************/
+
+/** LU factorisation with partial (row) pivoting, PA = LU, of a square matrix, where L is unit lower-triangular and U is upper-triangular. */
+template<std::floating_point T>
+class LUFactorisation
+{
+public:
+  LUFactorisation() = default;
+
+  template<class D>
+  explicit LUFactorisation(const Matrix<T, D>& matrix) { Factorise(matrix); }
+
+  explicit LUFactorisation(DynamicMatrix<T>&& matrix) { Factorise(std::move(matrix)); }
+
+  /** Factorise a matrix, replacing any previous factorisation. */
+  template<class D>
+  void
+  Factorise(const Matrix<T, D>& matrix);
+
+  void
+  Factorise(DynamicMatrix<T>&& matrix);
+
+  /** Solve Ax = b, or AX = B for each column of B. */
+  template<class D>
+  DynamicVector<T>
+  Solve(const Vector<T, D>& rhs) const;
+
+  template<class D>
+  DynamicMatrix<T>
+  Solve(const Matrix<T, D>& rhs) const;
+
+  /** Solve for the n_rhs columns of a column-major right-hand side with leading dimension ldb, overwriting them with the solutions. */
+  void
+  SolveInPlace(T* rhs, const size_t n_rhs, const size_t ldb) const;
+
+  T
+  Determinant() const;
+
+  DynamicMatrix<T>
+  Inverse() const;
+
+  /** Accessors */
+  size_t
+  size() const { return Factors_.nRows(); }
+
+  /** Check whether a pivot is exactly zero, in which case the matrix cannot be solved for. */
+  bool
+  isSingular() const { return isSingular_; }
+
+  /** L (below the diagonal) and U (on and above the diagonal). */
+  const DynamicMatrix<T>&
+  Factors() const { return Factors_; }
+
+  /** Row interchanged with row i at the i-th elimination step. */
+  const DynamicArray<size_t>&
+  Pivots() const { return Pivots_; }
+
+private:
+  void
+  Factorise();
+
+  void
+  FactorisePanel(const size_t k0, const size_t kb);
+
+  DynamicMatrix<T>     Factors_;
+  DynamicArray<size_t> Pivots_;
+  bool                 isPivotSwapOdd_{false};
+  bool                 isSingular_{false};
+};
+
+/***************************************************************************************************************************************************************
+* Cholesky Factorisation
+***************************************************************************************************************************************************************/
+
+/** Cholesky factorisation, A = LL^T, of a symmetric positive-definite matrix, where L is lower-triangular. Only the lower triangle of A is read. */
+template<std::floating_point T>
+class CholeskyFactorisation
+{
+public:
+  CholeskyFactorisation() = default;
+
+  template<class D>
+  explicit CholeskyFactorisation(const Matrix<T, D>& matrix) { Factorise(matrix); }
+
+  explicit CholeskyFactorisation(DynamicMatrix<T>&& matrix) { Factorise(std::move(matrix)); }
+
+  /** Factorise a matrix, replacing any previous factorisation. */
+  template<class D>
+  void
+  Factorise(const Matrix<T, D>& matrix);
+
+  void
+  Factorise(DynamicMatrix<T>&& matrix);
+
+  /** Solve Ax = b, or AX = B for each column of B. */
+  template<class D>
+  DynamicVector<T>
+  Solve(const Vector<T, D>& rhs) const;
+
+  template<class D>
+  DynamicMatrix<T>
+  Solve(const Matrix<T, D>& rhs) const;
+
+  /** Solve for the n_rhs columns of a column-major right-hand side with leading dimension ldb, overwriting them with the solutions. */
+  void
+  SolveInPlace(T* rhs, const size_t n_rhs, const size_t ldb) const;
+
+  T
+  Determinant() const;
+
+  /** Accessors */
+  size_t
+  size() const { return Factor_.nRows(); }
+
+  /** Check whether the matrix was found to be positive-definite, i.e. whether the factorisation succeeded. */
+  bool
+  isPositiveDefinite() const { return isPositiveDefinite_; }
+
+  /** L, whose entries above the diagonal are zero. */
+  const DynamicMatrix<T>&
+  Factor() const { return Factor_; }
+
+private:
+  void
+  Factorise();
+
+  bool
+  FactoriseDiagonalBlock(const size_t k0, const size_t kb);
+
+  DynamicMatrix<T> Factor_;
+  bool             isPositiveDefinite_{false};
+};
+
+/***************************************************************************************************************************************************************
+* QR Factorisation
+***************************************************************************************************************************************************************/
+
+/** Householder QR factorisation, A = QR, of an m x n matrix with m >= n, where Q is orthogonal and R is upper-triangular. Overdetermined systems are
+    solved in the least-squares sense. */
+template<std::floating_point T>
+class QRFactorisation
+{
+public:
+  QRFactorisation() = default;
+
+  template<class D>
+  explicit QRFactorisation(const Matrix<T, D>& matrix) { Factorise(matrix); }
+
+  explicit QRFactorisation(DynamicMatrix<T>&& matrix) { Factorise(std::move(matrix)); }
+
+  /** Factorise a matrix, replacing any previous factorisation. */
+  template<class D>
+  void
+  Factorise(const Matrix<T, D>& matrix);
+
+  void
+  Factorise(DynamicMatrix<T>&& matrix);
+
+  /** Find the x that minimises |Ax - b|, or each column of the X that minimises |AX - B|. */
+  template<class D>
+  DynamicVector<T>
+  Solve(const Vector<T, D>& rhs) const;
+
+  template<class D>
+  DynamicMatrix<T>
+  Solve(const Matrix<T, D>& rhs) const;
+
+  /** Overwrite the n_rhs columns (of size m) of a column-major matrix with leading dimension ldb with their products with Q^T. */
+  void
+  ApplyTransposeQ(T* rhs, const size_t n_rhs, const size_t ldb) const;
+
+  /** Accessors */
+  size_t
+  nRows() const { return Factors_.nRows(); }
+
+  size_t
+  nColumns() const { return Factors_.nColumns(); }
+
+  /** Check whether a diagonal entry of R is exactly zero, in which case the least-squares solution is not unique. */
+  bool
+  isRankDeficient() const;
+
+  /** The first n columns of Q, i.e. an orthonormal basis of the column space of A. */
+  DynamicMatrix<T>
+  Q() const;
+
+  /** The n x n upper-triangular factor. */
+  DynamicMatrix<T>
+  R() const;
+
+  /** Householder vectors (below the diagonal, with implicit unit leading entries) and R (on and above the diagonal). */
+  const DynamicMatrix<T>&
+  Factors() const { return Factors_; }
+
+private:
+  void
+  Factorise();
+
+  void
+  FactorisePanel(const size_t k0, const size_t kb);
+
+  void
+  UpdateTrailingMatrix(const size_t k0, const size_t kb);
+
+  DynamicMatrix<T> Factors_;
+  DynamicArray<T>  Scales_;
+};
+
+/***************************************************************************************************************************************************************
+* Direct Solution Functions
+***************************************************************************************************************************************************************/
+
+/** Determinant, inverse and solution of Ax = b, in closed form for static matrices of up to 4 x 4 (for which A must be non-singular), and otherwise by LU
+    factorisation. Factorisations should be used directly to solve for several right-hand sides. */
+template<typename T, size_t N> requires (1 <= N && N <= 4)
+constexpr T
+Determinant(const StaticMatrix<T, N, N>& matrix);
+
+template<std::floating_point T, size_t N> requires (1 <= N && N <= 4)
+constexpr StaticMatrix<T, N, N>
+Inverse(const StaticMatrix<T, N, N>& matrix);
+
+template<std::floating_point T, size_t N> requires (1 <= N && N <= 4)
+constexpr StaticVector<T, N>
+Solve(const StaticMatrix<T, N, N>& matrix, const StaticVector<T, N>& rhs);
+
+template<std::floating_point T, class D>
+T
+Determinant(const Matrix<T, D>& matrix);
+
+template<std::floating_point T, class D>
+DynamicMatrix<T>
+Inverse(const Matrix<T, D>& matrix);
+
+template<std::floating_point T, class D0, class D1>
+DynamicVector<T>
+Solve(const Matrix<T, D0>& matrix, const Vector<T, D1>& rhs);
+
+}
+
+#include "DirectSolver.tpp"
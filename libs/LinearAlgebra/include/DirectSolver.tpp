@@ -0,0 +1,690 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+namespace aprn {
+namespace detail {
+
+template<typename T>
+void
+SubstituteUpper(const T* a, const size_t lda, const size_t n, T* b)
+{
+  for(size_t j = n; j-- > 0;)
+  {
+    const T* column = a + j * lda;
+    b[j] /= column[j];
+    const T b_j = b[j];
+    FOR(i, j) b[i] -= column[i] * b_j;
+  }
+}
+
+template<typename T>
+void
+SubstituteUnitLower(const T* a, const size_t lda, const size_t n, T* b)
+{
+  FOR(j, n)
+  {
+    const T* column = a + j * lda;
+    const T b_j = b[j];
+    if(b_j != T(0)) FOR(i, j + 1, n) b[i] -= column[i] * b_j;
+  }
+}
+
+/** Copy the entries of a matrix/vector into a dynamic matrix/vector of the same shape. */
+template<typename T, class D>
+DynamicMatrix<T>
+DynamicCopy(const Matrix<T, D>& matrix)
+{
+  DynamicMatrix<T> copy(matrix.nRows(), matrix.nColumns());
+  std::copy(matrix.Derived().data(), matrix.Derived().data() + matrix.size(), copy.data());
+  return copy;
+}
+
+template<typename T, class D>
+DynamicVector<T>
+DynamicCopy(const Vector<T, D>& vector) { return DynamicVector<T>(vector.Derived().begin(), vector.Derived().end()); }
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* LU Factorisation
+***************************************************************************************************************************************************************/
+template<std::floating_point T>
+template<class D>
+void
+LUFactorisation<T>::Factorise(const Matrix<T, D>& matrix)
+{
+  Factors_ = detail::DynamicCopy(matrix);
+  Factorise();
+}
+
+template<std::floating_point T>
+void
+LUFactorisation<T>::Factorise(DynamicMatrix<T>&& matrix)
+{
+  Factors_ = std::move(matrix);
+  Factorise();
+}
+
+template<std::floating_point T>
+void
+LUFactorisation<T>::Factorise()
+{
+  DEBUG_ASSERT(Factors_.isSquare(), "LU factorisation requires a square matrix, not a ", Factors_.nRows(), " x ", Factors_.nColumns(), " matrix.")
+
+  const size_t n = size();
+  T* a = Factors_.data();
+  Pivots_.resize(n);
+  isPivotSwapOdd_ = false;
+  isSingular_ = false;
+
+  for(size_t k0 = 0; k0 < n; k0 += detail::FactorisationPanel)
+  {
+    const size_t kb = Min(detail::FactorisationPanel, n - k0);
+    const size_t k1 = k0 + kb;
+    FactorisePanel(k0, kb);
+    if(k1 == n) break;
+
+    // Rows of U to the right of the panel, i.e. the solution of L11 * U12 = A12.
+    detail::ForEachRightHandSide(n - k1, kb * kb / 2, [&](const size_t j) { detail::SubstituteUnitLower(a + k0 + k0 * n, n, kb, a + k0 + (k1 + j) * n); });
+
+    // Trailing matrix update, A22 -= L21 * U12.
+    gemm::Multiply(n - k1, n - k1, kb, gemm::Operand<T>{a + k1 + k0 * n, 1, n}, gemm::Operand<T>{a + k0 + k1 * n, 1, n}, a + k1 + k1 * n, n, true, T(-1));
+  }
+}
+
+/** Unblocked elimination of the columns [k0, k0 + kb), whose pivot rows are interchanged across the whole matrix. */
+template<std::floating_point T>
+void
+LUFactorisation<T>::FactorisePanel(const size_t k0, const size_t kb)
+{
+  const size_t n = size();
+  T* a = Factors_.data();
+
+  FOR(j, k0, k0 + kb)
+  {
+    T* column = a + j * n;
+
+    size_t pivot = j;
+    FOR(i, j + 1, n) if(Abs(column[i]) > Abs(column[pivot])) pivot = i;
+    Pivots_[j] = pivot;
+    if(pivot != j)
+    {
+      FOR(c, n) std::swap(a[j + c * n], a[pivot + c * n]);
+      isPivotSwapOdd_ = !isPivotSwapOdd_;
+    }
+
+    if(column[j] == T(0)) { isSingular_ = true; continue; }
+
+    const T inverse_pivot = T(1) / column[j];
+    FOR(i, j + 1, n) column[i] *= inverse_pivot;
+    FOR(c, j + 1, k0 + kb)
+    {
+      T* other = a + c * n;
+      const T u = other[j];
+      FOR(i, j + 1, n) other[i] -= column[i] * u;
+    }
+  }
+}
+
+template<std::floating_point T>
+template<class D>
+DynamicVector<T>
+LUFactorisation<T>::Solve(const Vector<T, D>& rhs) const
+{
+  auto solution = detail::DynamicCopy(rhs);
+  DEBUG_ASSERT(solution.size() == size(), "The right-hand side size ", solution.size(), " must equal the matrix size ", size(), ".")
+  SolveInPlace(solution.data(), 1, size());
+  return solution;
+}
+
+template<std::floating_point T>
+template<class D>
+DynamicMatrix<T>
+LUFactorisation<T>::Solve(const Matrix<T, D>& rhs) const
+{
+  auto solution = detail::DynamicCopy(rhs);
+  DEBUG_ASSERT(solution.nRows() == size(), "The right-hand side rows ", solution.nRows(), " must equal the matrix size ", size(), ".")
+  SolveInPlace(solution.data(), solution.nColumns(), size());
+  return solution;
+}
+
+template<std::floating_point T>
+void
+LUFactorisation<T>::SolveInPlace(T* rhs, const size_t n_rhs, const size_t ldb) const
+{
+  DEBUG_ASSERT(!isSingular_, "Cannot solve with the LU factorisation of a singular matrix.")
+
+  const size_t n = size();
+  const T* a = Factors_.data();
+  detail::ForEachRightHandSide(n_rhs, n * n, [&](const size_t j)
+  {
+    T* b = rhs + j * ldb;
+    FOR(i, n) if(Pivots_[i] != i) std::swap(b[i], b[Pivots_[i]]);
+    detail::SubstituteUnitLower(a, n, n, b);
+    detail::SubstituteUpper(a, n, n, b);
+  });
+}
+
+template<std::floating_point T>
+T
+LUFactorisation<T>::Determinant() const
+{
+  T determinant = isPivotSwapOdd_ ? T(-1) : T(1);
+  FOR(i, size()) determinant *= Factors_(i, i);
+  return determinant;
+}
+
+template<std::floating_point T>
+DynamicMatrix<T>
+LUFactorisation<T>::Inverse() const
+{
+  auto inverse = DynamicMatrix<T>::Identity(size());
+  SolveInPlace(inverse.data(), size(), size());
+  return inverse;
+}
+
+/***************************************************************************************************************************************************************
+* Cholesky Factorisation
+***************************************************************************************************************************************************************/
+template<std::floating_point T>
+template<class D>
+void
+CholeskyFactorisation<T>::Factorise(const Matrix<T, D>& matrix)
+{
+  Factor_ = detail::DynamicCopy(matrix);
+  Factorise();
+}
+
+template<std::floating_point T>
+void
+CholeskyFactorisation<T>::Factorise(DynamicMatrix<T>&& matrix)
+{
+  Factor_ = std::move(matrix);
+  Factorise();
+}
+
+template<std::floating_point T>
+void
+CholeskyFactorisation<T>::Factorise()
+{
+  DEBUG_ASSERT(Factor_.isSquare(), "Cholesky factorisation requires a square matrix, not a ", Factor_.nRows(), " x ", Factor_.nColumns(), " matrix.")
+
+  constexpr size_t panel = detail::FactorisationPanel;
+  const size_t n = size();
+  T* a = Factor_.data();
+  isPositiveDefinite_ = true;
+
+  for(size_t k0 = 0; k0 < n; k0 += panel)
+  {
+    const size_t kb = Min(panel, n - k0);
+    const size_t k1 = k0 + kb;
+    if(!FactoriseDiagonalBlock(k0, kb)) { isPositiveDefinite_ = false; return; }
+    if(k1 == n) break;
+
+    const size_t n_blocks = (n - k1 - 1) / panel + 1;
+
+    // Panel below the diagonal block, i.e. the solution of L21 * L11^T = A21, by blocks of rows.
+    #pragma omp parallel for schedule(static) if(parallel::isParallel((n - k1) * kb))
+    for(size_t block = 0; block < n_blocks; ++block)
+    {
+      const size_t first = k1 + block * panel;
+      const size_t last = Min(first + panel, n);
+      FOR(j, k0, k1)
+      {
+        T* column = a + j * n;
+        FOR(p, k0, j)
+        {
+          const T* other = a + p * n;
+          const T l = other[j];
+          FOR(i, first, last) column[i] -= other[i] * l;
+        }
+        const T inverse_diagonal = T(1) / column[j];
+        FOR(i, first, last) column[i] *= inverse_diagonal;
+      }
+    }
+
+    // Trailing matrix update, A22 -= L21 * L21^T, of the lower triangle only, by blocks of columns.
+    #pragma omp parallel for schedule(dynamic) if(parallel::isParallel((n - k1) * (n - k1) * kb / 16))
+    for(size_t block = 0; block < n_blocks; ++block)
+    {
+      const size_t j = k1 + block * panel;
+      const gemm::Operand<T> l21{a + j + k0 * n, 1, n};
+      gemm::Multiply(n - j, Min(panel, n - j), kb, l21, l21.Transpose(), a + j + j * n, n, true, T(-1));
+    }
+  }
+
+  FOR(j, n) FOR(i, j) a[i + j * n] = T(0);
+}
+
+/** Unblocked (left-looking) factorisation of the diagonal block [k0, k0 + kb), returning false if it is not positive-definite. */
+template<std::floating_point T>
+bool
+CholeskyFactorisation<T>::FactoriseDiagonalBlock(const size_t k0, const size_t kb)
+{
+  const size_t n = size();
+  T* a = Factor_.data();
+
+  FOR(j, k0, k0 + kb)
+  {
+    T* column = a + j * n;
+    FOR(p, k0, j)
+    {
+      const T* other = a + p * n;
+      const T l = other[j];
+      FOR(i, j, k0 + kb) column[i] -= other[i] * l;
+    }
+
+    if(!(column[j] > T(0))) return false;
+    column[j] = std::sqrt(column[j]);
+    const T inverse_diagonal = T(1) / column[j];
+    FOR(i, j + 1, k0 + kb) column[i] *= inverse_diagonal;
+  }
+  return true;
+}
+
+template<std::floating_point T>
+template<class D>
+DynamicVector<T>
+CholeskyFactorisation<T>::Solve(const Vector<T, D>& rhs) const
+{
+  auto solution = detail::DynamicCopy(rhs);
+  DEBUG_ASSERT(solution.size() == size(), "The right-hand side size ", solution.size(), " must equal the matrix size ", size(), ".")
+  SolveInPlace(solution.data(), 1, size());
+  return solution;
+}
+
+template<std::floating_point T>
+template<class D>
+DynamicMatrix<T>
+CholeskyFactorisation<T>::Solve(const Matrix<T, D>& rhs) const
+{
+  auto solution = detail::DynamicCopy(rhs);
+  DEBUG_ASSERT(solution.nRows() == size(), "The right-hand side rows ", solution.nRows(), " must equal the matrix size ", size(), ".")
+  SolveInPlace(solution.data(), solution.nColumns(), size());
+  return solution;
+}
+
+template<std::floating_point T>
+void
+CholeskyFactorisation<T>::SolveInPlace(T* rhs, const size_t n_rhs, const size_t ldb) const
+{
+  DEBUG_ASSERT(isPositiveDefinite_, "Cannot solve with a failed Cholesky factorisation, as the matrix is not positive-definite.")
+
+  const size_t n = size();
+  const T* a = Factor_.data();
+  detail::ForEachRightHandSide(n_rhs, n * n, [&](const size_t k)
+  {
+    T* b = rhs + k * ldb;
+
+    // Solve Ly = b, and then L^T x = y, both sweeping down the (contiguous) columns of L.
+    FOR(j, n)
+    {
+      const T* column = a + j * n;
+      b[j] /= column[j];
+      const T b_j = b[j];
+      FOR(i, j + 1, n) b[i] -= column[i] * b_j;
+    }
+    for(size_t j = n; j-- > 0;)
+    {
+      const T* column = a + j * n;
+      T sum = b[j];
+      FOR(i, j + 1, n) sum -= column[i] * b[i];
+      b[j] = sum / column[j];
+    }
+  });
+}
+
+template<std::floating_point T>
+T
+CholeskyFactorisation<T>::Determinant() const
+{
+  T determinant(1);
+  FOR(i, size()) determinant *= Factor_(i, i);
+  return determinant * determinant;
+}
+
+/***************************************************************************************************************************************************************
+* QR Factorisation
+***************************************************************************************************************************************************************/
+template<std::floating_point T>
+template<class D>
+void
+QRFactorisation<T>::Factorise(const Matrix<T, D>& matrix)
+{
+  Factors_ = detail::DynamicCopy(matrix);
+  Factorise();
+}
+
+template<std::floating_point T>
+void
+QRFactorisation<T>::Factorise(DynamicMatrix<T>&& matrix)
+{
+  Factors_ = std::move(matrix);
+  Factorise();
+}
+
+template<std::floating_point T>
+void
+QRFactorisation<T>::Factorise()
+{
+  DEBUG_ASSERT(nRows() >= nColumns(), "QR factorisation requires at least as many rows as columns, not a ", nRows(), " x ", nColumns(), " matrix.")
+
+  const size_t n = nColumns();
+  Scales_.resize(n);
+  for(size_t k0 = 0; k0 < n; k0 += detail::FactorisationPanel)
+  {
+    const size_t kb = Min(detail::FactorisationPanel, n - k0);
+    FactorisePanel(k0, kb);
+    if(k0 + kb < n) UpdateTrailingMatrix(k0, kb);
+  }
+}
+
+/** Unblocked factorisation of the columns [k0, k0 + kb). Each Householder reflection H = I - tau * v * v^T zeros a column below the diagonal, where v is
+    scaled to have a unit leading entry, and is applied to the remaining columns of the panel. */
+template<std::floating_point T>
+void
+QRFactorisation<T>::FactorisePanel(const size_t k0, const size_t kb)
+{
+  const size_t m = nRows();
+  T* a = Factors_.data();
+
+  FOR(j, k0, k0 + kb)
+  {
+    T* v = a + j * m;
+    T tail_norm2(0);
+    FOR(i, j + 1, m) tail_norm2 += v[i] * v[i];
+
+    const T alpha = v[j];
+    if(tail_norm2 == T(0)) Scales_[j] = T(0);
+    else
+    {
+      const T beta = alpha < T(0) ? std::sqrt(alpha * alpha + tail_norm2) : -std::sqrt(alpha * alpha + tail_norm2);
+      const T inverse_leading = T(1) / (alpha - beta);
+      FOR(i, j + 1, m) v[i] *= inverse_leading;
+      v[j] = beta;
+      Scales_[j] = (beta - alpha) / beta;
+    }
+
+    const T tau = Scales_[j];
+    if(tau != T(0))
+      FOR(c, j + 1, k0 + kb)
+      {
+        T* column = a + c * m;
+        T w = column[j];
+        FOR(i, j + 1, m) w += v[i] * column[i];
+        w *= tau;
+        column[j] -= w;
+        FOR(i, j + 1, m) column[i] -= w * v[i];
+      }
+  }
+}
+
+/** Apply the reflections of the panel [k0, k0 + kb) to the trailing matrix at once, in the compact WY form H_1 ... H_kb = I - V * S * V^T, where V holds
+    the Householder vectors and S is upper-triangular. The trailing matrix A2 is thus updated with two matrix products, A2 -= V * (S^T * (V^T * A2)). */
+template<std::floating_point T>
+void
+QRFactorisation<T>::UpdateTrailingMatrix(const size_t k0, const size_t kb)
+{
+  const size_t m = nRows();
+  const size_t k1 = k0 + kb;
+  const size_t n_rows = m - k0;
+  const size_t n_columns = nColumns() - k1;
+  T* a = Factors_.data();
+
+  DynamicMatrix<T> v(n_rows, kb, T(0));
+  FOR(j, kb)
+  {
+    v(j, j) = T(1);
+    FOR(i, j + 1, n_rows) v(i, j) = a[k0 + i + (k0 + j) * m];
+  }
+
+  // S(0:j, j) = -tau_j * S(0:j, 0:j) * V(:, 0:j)^T * v_j, and S(j, j) = tau_j.
+  DynamicMatrix<T> s(kb, kb, T(0));
+  FOR(j, kb)
+  {
+    const T tau = Scales_[k0 + j];
+    FOR(i, j)
+    {
+      T dot(0);
+      FOR(r, j, n_rows) dot += v(r, i) * v(r, j);
+      s(i, j) = -tau * dot;
+    }
+    FOR(i, j)
+    {
+      T sum(0);
+      FOR(p, i, j) sum += s(i, p) * s(p, j);
+      s(i, j) = sum;
+    }
+    s(j, j) = tau;
+  }
+
+  const gemm::Operand<T> a2{a + k0 + k1 * m, 1, m};
+  DynamicMatrix<T> w(kb, n_columns);
+  gemm::Multiply(kb, n_columns, n_rows, v.Operand(true), a2, w.data(), kb);
+
+  #pragma omp parallel for schedule(static) if(parallel::isParallel(n_columns * kb * kb / 2))
+  for(size_t c = 0; c < n_columns; ++c)
+    for(size_t i = kb; i-- > 0;)
+    {
+      T sum(0);
+      FOR(p, i + 1) sum += s(p, i) * w(p, c);
+      w(i, c) = sum;
+    }
+
+  gemm::Multiply(n_rows, n_columns, kb, v.Operand(), w.Operand(), a + k0 + k1 * m, m, true, T(-1));
+}
+
+template<std::floating_point T>
+void
+QRFactorisation<T>::ApplyTransposeQ(T* rhs, const size_t n_rhs, const size_t ldb) const
+{
+  const size_t m = nRows();
+  const size_t n = nColumns();
+  const T* a = Factors_.data();
+  detail::ForEachRightHandSide(n_rhs, m * n, [&](const size_t k)
+  {
+    T* b = rhs + k * ldb;
+    FOR(j, n)
+    {
+      const T tau = Scales_[j];
+      if(tau == T(0)) continue;
+
+      const T* v = a + j * m;
+      T w = b[j];
+      FOR(i, j + 1, m) w += v[i] * b[i];
+      w *= tau;
+      b[j] -= w;
+      FOR(i, j + 1, m) b[i] -= w * v[i];
+    }
+  });
+}
+
+template<std::floating_point T>
+template<class D>
+DynamicVector<T>
+QRFactorisation<T>::Solve(const Vector<T, D>& rhs) const
+{
+  DEBUG_ASSERT(!isRankDeficient(), "Cannot solve with the QR factorisation of a rank-deficient matrix.")
+
+  auto solution = detail::DynamicCopy(rhs);
+  DEBUG_ASSERT(solution.size() == nRows(), "The right-hand side size ", solution.size(), " must equal the number of matrix rows ", nRows(), ".")
+  ApplyTransposeQ(solution.data(), 1, nRows());
+  detail::SubstituteUpper(Factors_.data(), nRows(), nColumns(), solution.data());
+  solution.resize(nColumns());
+  return solution;
+}
+
+template<std::floating_point T>
+template<class D>
+DynamicMatrix<T>
+QRFactorisation<T>::Solve(const Matrix<T, D>& rhs) const
+{
+  DEBUG_ASSERT(!isRankDeficient(), "Cannot solve with the QR factorisation of a rank-deficient matrix.")
+
+  auto product = detail::DynamicCopy(rhs);
+  DEBUG_ASSERT(product.nRows() == nRows(), "The right-hand side rows ", product.nRows(), " must equal the number of matrix rows ", nRows(), ".")
+  ApplyTransposeQ(product.data(), product.nColumns(), nRows());
+
+  DynamicMatrix<T> solution(nColumns(), product.nColumns());
+  detail::ForEachRightHandSide(product.nColumns(), nColumns() * nColumns() / 2, [&](const size_t k)
+  {
+    T* column = product.data() + k * nRows();
+    detail::SubstituteUpper(Factors_.data(), nRows(), nColumns(), column);
+    std::copy(column, column + nColumns(), solution.data() + k * nColumns());
+  });
+  return solution;
+}
+
+template<std::floating_point T>
+bool
+QRFactorisation<T>::isRankDeficient() const
+{
+  FOR(i, nColumns()) if(Factors_(i, i) == T(0)) return true;
+  return false;
+}
+
+template<std::floating_point T>
+DynamicMatrix<T>
+QRFactorisation<T>::Q() const
+{
+  const size_t m = nRows();
+  const size_t n = nColumns();
+  const T* a = Factors_.data();
+  DynamicMatrix<T> q(m, n, T(0));
+
+  // Column k of Q is H_0 ... H_k * e_k, as the later reflections leave e_k unchanged.
+  detail::ForEachRightHandSide(n, m * n / 2, [&](const size_t k)
+  {
+    T* column = q.data() + k * m;
+    column[k] = T(1);
+    for(size_t j = k + 1; j-- > 0;)
+    {
+      const T tau = Scales_[j];
+      if(tau == T(0)) continue;
+
+      const T* v = a + j * m;
+      T w = column[j];
+      FOR(i, j + 1, m) w += v[i] * column[i];
+      w *= tau;
+      column[j] -= w;
+      FOR(i, j + 1, m) column[i] -= w * v[i];
+    }
+  });
+  return q;
+}
+
+template<std::floating_point T>
+DynamicMatrix<T>
+QRFactorisation<T>::R() const
+{
+  const size_t n = nColumns();
+  DynamicMatrix<T> r(n, n, T(0));
+  FOR(j, n) FOR(i, j + 1) r(i, j) = Factors_(i, j);
+  return r;
+}
+
+/***************************************************************************************************************************************************************
+* Direct Solution Functions
+***************************************************************************************************************************************************************/
+template<typename T, size_t N> requires (1 <= N && N <= 4)
+constexpr T
+Determinant(const StaticMatrix<T, N, N>& a)
+{
+  if constexpr(N == 1) return a(0, 0);
+  else if constexpr(N == 2) return a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0);
+  else if constexpr(N == 3)
+    return a(0, 0) * (a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1)) - a(0, 1) * (a(1, 0) * a(2, 2) - a(1, 2) * a(2, 0))
+           + a(0, 2) * (a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0));
+  else
+  {
+    // Laplace expansion in the 2 x 2 minors of the first two and last two rows.
+    const T s0 = a(0, 0) * a(1, 1) - a(1, 0) * a(0, 1);
+    const T s1 = a(0, 0) * a(1, 2) - a(1, 0) * a(0, 2);
+    const T s2 = a(0, 0) * a(1, 3) - a(1, 0) * a(0, 3);
+    const T s3 = a(0, 1) * a(1, 2) - a(1, 1) * a(0, 2);
+    const T s4 = a(0, 1) * a(1, 3) - a(1, 1) * a(0, 3);
+    const T s5 = a(0, 2) * a(1, 3) - a(1, 2) * a(0, 3);
+    const T c0 = a(2, 0) * a(3, 1) - a(3, 0) * a(2, 1);
+    const T c1 = a(2, 0) * a(3, 2) - a(3, 0) * a(2, 2);
+    const T c2 = a(2, 0) * a(3, 3) - a(3, 0) * a(2, 3);
+    const T c3 = a(2, 1) * a(3, 2) - a(3, 1) * a(2, 2);
+    const T c4 = a(2, 1) * a(3, 3) - a(3, 1) * a(2, 3);
+    const T c5 = a(2, 2) * a(3, 3) - a(3, 2) * a(2, 3);
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+  }
+}
+
+template<std::floating_point T, size_t N> requires (1 <= N && N <= 4)
+constexpr StaticMatrix<T, N, N>
+Inverse(const StaticMatrix<T, N, N>& a)
+{
+  const T determinant = Determinant(a);
+  DEBUG_ASSERT(determinant != T(0), "Cannot invert a singular matrix.")
+
+  const T d = T(1) / determinant;
+  StaticMatrix<T, N, N> inverse;
+  if constexpr(N == 1) inverse(0, 0) = d;
+  else if constexpr(N == 2) inverse = {{d * a(1, 1), -d * a(0, 1)}, {-d * a(1, 0), d * a(0, 0)}};
+  else if constexpr(N == 3)
+  {
+    // Adjugate, whose entries are the cofactors of the transpose (which cyclic indexing gives with the right signs).
+    FOR(i, 3) FOR(j, 3)
+      inverse(i, j) = d * (a((j + 1) % 3, (i + 1) % 3) * a((j + 2) % 3, (i + 2) % 3) - a((j + 1) % 3, (i + 2) % 3) * a((j + 2) % 3, (i + 1) % 3));
+  }
+  else
+  {
+    const T s0 = a(0, 0) * a(1, 1) - a(1, 0) * a(0, 1);
+    const T s1 = a(0, 0) * a(1, 2) - a(1, 0) * a(0, 2);
+    const T s2 = a(0, 0) * a(1, 3) - a(1, 0) * a(0, 3);
+    const T s3 = a(0, 1) * a(1, 2) - a(1, 1) * a(0, 2);
+    const T s4 = a(0, 1) * a(1, 3) - a(1, 1) * a(0, 3);
+    const T s5 = a(0, 2) * a(1, 3) - a(1, 2) * a(0, 3);
+    const T c0 = a(2, 0) * a(3, 1) - a(3, 0) * a(2, 1);
+    const T c1 = a(2, 0) * a(3, 2) - a(3, 0) * a(2, 2);
+    const T c2 = a(2, 0) * a(3, 3) - a(3, 0) * a(2, 3);
+    const T c3 = a(2, 1) * a(3, 2) - a(3, 1) * a(2, 2);
+    const T c4 = a(2, 1) * a(3, 3) - a(3, 1) * a(2, 3);
+    const T c5 = a(2, 2) * a(3, 3) - a(3, 2) * a(2, 3);
+
+    inverse = {{d * ( a(1, 1) * c5 - a(1, 2) * c4 + a(1, 3) * c3), d * (-a(0, 1) * c5 + a(0, 2) * c4 - a(0, 3) * c3),
+                d * ( a(3, 1) * s5 - a(3, 2) * s4 + a(3, 3) * s3), d * (-a(2, 1) * s5 + a(2, 2) * s4 - a(2, 3) * s3)},
+               {d * (-a(1, 0) * c5 + a(1, 2) * c2 - a(1, 3) * c1), d * ( a(0, 0) * c5 - a(0, 2) * c2 + a(0, 3) * c1),
+                d * (-a(3, 0) * s5 + a(3, 2) * s2 - a(3, 3) * s1), d * ( a(2, 0) * s5 - a(2, 2) * s2 + a(2, 3) * s1)},
+               {d * ( a(1, 0) * c4 - a(1, 1) * c2 + a(1, 3) * c0), d * (-a(0, 0) * c4 + a(0, 1) * c2 - a(0, 3) * c0),
+                d * ( a(3, 0) * s4 - a(3, 1) * s2 + a(3, 3) * s0), d * (-a(2, 0) * s4 + a(2, 1) * s2 - a(2, 3) * s0)},
+               {d * (-a(1, 0) * c3 + a(1, 1) * c1 - a(1, 2) * c0), d * ( a(0, 0) * c3 - a(0, 1) * c1 + a(0, 2) * c0),
+                d * (-a(3, 0) * s3 + a(3, 1) * s1 - a(3, 2) * s0), d * ( a(2, 0) * s3 - a(2, 1) * s1 + a(2, 2) * s0)}};
+  }
+  return inverse;
+}
+
+template<std::floating_point T, size_t N> requires (1 <= N && N <= 4)
+constexpr StaticVector<T, N>
+Solve(const StaticMatrix<T, N, N>& matrix, const StaticVector<T, N>& rhs) { return Inverse(matrix) * rhs; }
+
+template<std::floating_point T, class D>
+T
+Determinant(const Matrix<T, D>& matrix) { return LUFactorisation<T>(matrix).Determinant(); }
+
+template<std::floating_point T, class D>
+DynamicMatrix<T>
+Inverse(const Matrix<T, D>& matrix) { return LUFactorisation<T>(matrix).Inverse(); }
+
+template<std::floating_point T, class D0, class D1>
+DynamicVector<T>
+Solve(const Matrix<T, D0>& matrix, const Vector<T, D1>& rhs) { return LUFactorisation<T>(matrix).Solve(rhs); }
+
+}
@@ -0,0 +1,138 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "../../DataContainer/include/Array.h"
+#include "../../DataContainer/include/Parallel.h"
+#include "DirectSolver.h"
+#include "Matrix.h"
+#include "Vector.h"
+
+#include <ranges>
+#include <span>
+
+/***************************************************************************************************************************************************************
+* Symmetric Eigensolvers
+*
+* Eigenvalues (in ascending order) and orthonormal eigenvectors of real symmetric matrices, of which only the lower triangle is read.
+*
+* 3 x 3 matrices are solved with a hybrid method: the eigenvalues are computed in closed form (from the trigonometric solution of the characteristic
+* cubic), the eigenvector of the most isolated eigenvalue from cross products of the rows of A - λI, and the other two eigenvectors by an exact Jacobi
+* rotation of A restricted to the orthogonal plane. This is branch-light, needs no iteration, and stays accurate for (nearly) repeated eigenvalues, for
+* which closed-form eigenvectors alone break down. Batches of 3 x 3 matrices are solved in a single (parallel) pass.
+*
+* Dense matrices are reduced to tridiagonal form by Householder reflections, whose symmetric rank-2 updates are multithreaded, and the tridiagonal matrix
+* is then diagonalised by the implicit QL algorithm with Wilkinson shifts, whose rotations are applied to contiguous columns of the eigenvectors.
+***************************************************************************************************************************************************************/
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* 3 x 3 Symmetric Eigensolver
+***************************************************************************************************************************************************************/
+template<std::floating_point T>
+struct SymmetricEigenSystem3
+{
+  SVector3<T>   Eigenvalues;
+
+  /** Unit eigenvectors, as the columns of a rotation (or reflection) matrix. */
+  SMatrix<T, 3> Eigenvectors;
+};
+
+template<std::floating_point T>
+SymmetricEigenSystem3<T>
+SymmetricEigen(const SMatrix<T, 3>& matrix);
+
+template<std::floating_point T>
+SVector3<T>
+SymmetricEigenvalues(const SMatrix<T, 3>& matrix);
+
+namespace detail {
+
+template<class M> struct Matrix3Traits;
+
+template<std::floating_point T>
+struct Matrix3Traits<StaticMatrix<T, 3, 3>> { using value_type = T; };
+
+/** Contiguous range of 3 x 3 static matrices, e.g. a DynamicArray<SMatrixR3>. */
+template<class R>
+concept Matrix3Range = std::ranges::contiguous_range<R> && requires { typename Matrix3Traits<std::ranges::range_value_t<R>>::value_type; };
+
+template<Matrix3Range R> using Matrix3Value = typename Matrix3Traits<std::ranges::range_value_t<R>>::value_type;
+
+}//detail
+
+/** Solve a batch of symmetric 3 x 3 matrices, with or without their eigenvectors. */
+template<detail::Matrix3Range R>
+void
+SymmetricEigen(const R& matrices, std::span<SVector3<detail::Matrix3Value<R>>> eigenvalues, std::span<SMatrix<detail::Matrix3Value<R>, 3>> eigenvectors);
+
+template<detail::Matrix3Range R>
+void
+SymmetricEigenvalues(const R& matrices, std::span<SVector3<detail::Matrix3Value<R>>> eigenvalues);
+
+/***************************************************************************************************************************************************************
+* Dense Symmetric Eigendecomposition
+***************************************************************************************************************************************************************/
+
+/** Eigendecomposition, A = VΛV^T, of a symmetric matrix, where Λ is the diagonal matrix of eigenvalues and V is orthogonal. */
+template<std::floating_point T>
+class SymmetricEigenDecomposition
+{
+public:
+  SymmetricEigenDecomposition() = default;
+
+  template<class D>
+  explicit SymmetricEigenDecomposition(const Matrix<T, D>& matrix, const bool is_vector_computed = true) { Decompose(matrix, is_vector_computed); }
+
+  /** Decompose a matrix, replacing any previous decomposition. Computing only the eigenvalues is several times faster. */
+  template<class D>
+  void
+  Decompose(const Matrix<T, D>& matrix, const bool is_vector_computed = true);
+
+  /** Accessors */
+  size_t
+  size() const { return Eigenvalues_.size(); }
+
+  /** Check whether the QL iterations converged for every eigenvalue, which they fail to only in pathological cases. */
+  bool
+  isConverged() const { return isConverged_; }
+
+  const DynamicVector<T>&
+  Eigenvalues() const { return Eigenvalues_; }
+
+  /** Unit eigenvectors, as the columns of an orthogonal matrix, which is empty if only the eigenvalues were computed. */
+  const DynamicMatrix<T>&
+  Eigenvectors() const { return Eigenvectors_; }
+
+private:
+  void
+  Tridiagonalise(DynamicMatrix<T>& matrix, DynamicVector<T>& off_diagonal, const bool is_vector_computed);
+
+  void
+  DiagonaliseTridiagonal(DynamicVector<T>& off_diagonal, const bool is_vector_computed);
+
+  void
+  SortEigenpairs(const bool is_vector_computed);
+
+  DynamicVector<T> Eigenvalues_;
+  DynamicMatrix<T> Eigenvectors_;
+  bool             isConverged_{true};
+};
+
+}
+
+#include "EigenSolver.tpp"
@@ -0,0 +1,407 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include <numeric>
+
+namespace aprn {
+namespace detail {
+
+template<typename T>
+inline void
+Cross3(const T* a, const T* b, T* c)
+{
+  c[0] = a[1] * b[2] - a[2] * b[1];
+  c[1] = a[2] * b[0] - a[0] * b[2];
+  c[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+template<typename T>
+inline T
+Dot3(const T* a, const T* b) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]; }
+
+/** Eigenvalues of a symmetric 3 x 3 matrix, given by its lower triangle, in descending order, from the trigonometric solution of the characteristic
+    cubic of B = (A - qI) / p, where q = tr(A) / 3 and p^2 = tr((A - qI)^2) / 6. Returns p, which is zero for multiples of the identity. */
+template<typename T>
+inline T
+SymmetricEigenvalues3(const T a00, const T a10, const T a20, const T a11, const T a21, const T a22, T* values)
+{
+  const T q = (a00 + a11 + a22) / T(3);
+  const T b00 = a00 - q, b11 = a11 - q, b22 = a22 - q;
+  const T p = std::sqrt((b00 * b00 + b11 * b11 + b22 * b22 + T(2) * (a10 * a10 + a20 * a20 + a21 * a21)) / T(6));
+  if(p == T(0)) { values[0] = values[1] = values[2] = q; return p; }
+
+  const T determinant = b00 * (b11 * b22 - a21 * a21) - a10 * (a10 * b22 - a21 * a20) + a20 * (a10 * a21 - b11 * a20);
+  const T angle = std::acos(std::clamp(determinant / (T(2) * p * p * p), T(-1), T(1))) / T(3);
+  values[0] = q + T(2) * p * std::cos(angle);
+  values[2] = q + T(2) * p * std::cos(angle + T(2) * static_cast<T>(Pi) / T(3));
+  values[1] = T(3) * q - values[0] - values[2];
+  return p;
+}
+
+/** Sort three eigenpairs into ascending order with a sorting network, and rescale the eigenvalues. */
+template<typename T>
+inline void
+SortEigenpairs3(const T* pair_values, const T* pair_vectors, const T scale, T* values, T* vectors)
+{
+  size_t order[3] = {0, 1, 2};
+  const auto compare_swap = [&](const size_t i, const size_t j) { if(pair_values[order[j]] < pair_values[order[i]]) std::swap(order[i], order[j]); };
+  compare_swap(0, 1);
+  compare_swap(1, 2);
+  compare_swap(0, 1);
+  FOR(i, 3)
+  {
+    values[i] = scale * pair_values[order[i]];
+    FOR(j, 3) vectors[3 * i + j] = pair_vectors[3 * order[i] + j];
+  }
+}
+
+/** Eigenvalues (ascending) and, if vectors is non-null, unit eigenvectors (column-major) of a symmetric 3 x 3 matrix, given by its lower triangle. */
+template<typename T>
+void
+SymmetricEigen3(T a00, T a10, T a20, T a11, T a21, T a22, T* values, T* vectors)
+{
+  // Scale the entries to at most one in magnitude, to avoid overflow or underflow in the cubic and cross products.
+  const T scale = Max(Max(Max(Abs(a00), Abs(a10)), Max(Abs(a20), Abs(a11))), Max(Abs(a21), Abs(a22)));
+  const T inverse_scale = scale > T(0) ? T(1) / scale : T(1);
+  a00 *= inverse_scale; a10 *= inverse_scale; a20 *= inverse_scale; a11 *= inverse_scale; a21 *= inverse_scale; a22 *= inverse_scale;
+
+  T descending[3];
+  const T p = SymmetricEigenvalues3(a00, a10, a20, a11, a21, a22, descending);
+  if(!vectors)
+  {
+    FOR(i, 3) values[i] = scale * descending[2 - i];
+    return;
+  }
+
+  T pair_values[3];
+  T pair_vectors[9]{};
+  if(p <= std::numeric_limits<T>::epsilon())
+  {
+    // Multiples of the identity (to within rounding), whose eigenvectors are arbitrary, are taken to be diagonal.
+    pair_values[0] = a00; pair_values[1] = a11; pair_values[2] = a22;
+    pair_vectors[0] = pair_vectors[4] = pair_vectors[8] = T(1);
+    SortEigenpairs3(pair_values, pair_vectors, scale, values, vectors);
+    return;
+  }
+
+  // Eigenvector of the eigenvalue furthest from the other two, as the largest cross product of two rows of A - λI.
+  const bool is_largest = descending[0] - descending[1] >= descending[1] - descending[2];
+  const T isolated = is_largest ? descending[0] : descending[2];
+  const T row0[3] = {a00 - isolated, a10, a20};
+  const T row1[3] = {a10, a11 - isolated, a21};
+  const T row2[3] = {a20, a21, a22 - isolated};
+  T cross01[3], cross02[3], cross12[3], v[3];
+  Cross3(row0, row1, cross01);
+  Cross3(row0, row2, cross02);
+  Cross3(row1, row2, cross12);
+  const T norm01 = Dot3(cross01, cross01), norm02 = Dot3(cross02, cross02), norm12 = Dot3(cross12, cross12);
+  const T* cross = norm01 >= norm02 ? (norm01 >= norm12 ? cross01 : cross12) : (norm02 >= norm12 ? cross02 : cross12);
+  const T inverse_norm = T(1) / std::sqrt(Max(Max(norm01, norm02), norm12));
+  FOR(i, 3) v[i] = inverse_norm * cross[i];
+
+  // Orthonormal basis (u, w) of the plane orthogonal to v, which is invariant under A.
+  T u[3], w[3];
+  if(Abs(v[0]) > Abs(v[1]))
+  {
+    const T inverse_length = T(1) / std::sqrt(v[0] * v[0] + v[2] * v[2]);
+    u[0] = -v[2] * inverse_length; u[1] = T(0); u[2] = v[0] * inverse_length;
+  }
+  else
+  {
+    const T inverse_length = T(1) / std::sqrt(v[1] * v[1] + v[2] * v[2]);
+    u[0] = T(0); u[1] = v[2] * inverse_length; u[2] = -v[1] * inverse_length;
+  }
+  Cross3(v, u, w);
+
+  // Diagonalise A restricted to the plane, M = [u w]^T A [u w], with a single (exact) Jacobi rotation.
+  const T au[3] = {a00 * u[0] + a10 * u[1] + a20 * u[2], a10 * u[0] + a11 * u[1] + a21 * u[2], a20 * u[0] + a21 * u[1] + a22 * u[2]};
+  const T aw[3] = {a00 * w[0] + a10 * w[1] + a20 * w[2], a10 * w[0] + a11 * w[1] + a21 * w[2], a20 * w[0] + a21 * w[1] + a22 * w[2]};
+  const T m00 = Dot3(u, au), m01 = Dot3(u, aw), m11 = Dot3(w, aw);
+  T tangent(0);
+  if(m01 != T(0))
+  {
+    const T tau = (m11 - m00) / (T(2) * m01);
+    tangent = (tau >= T(0) ? T(1) : T(-1)) / (Abs(tau) + std::hypot(T(1), tau));
+  }
+  const T cosine = T(1) / std::sqrt(T(1) + tangent * tangent);
+  const T sine = tangent * cosine;
+
+  // Eigenpairs, with the eigenvalue of v refined by its Rayleigh quotient.
+  const T av[3] = {a00 * v[0] + a10 * v[1] + a20 * v[2], a10 * v[0] + a11 * v[1] + a21 * v[2], a20 * v[0] + a21 * v[1] + a22 * v[2]};
+  pair_values[0] = Dot3(v, av);
+  pair_values[1] = m00 - tangent * m01;
+  pair_values[2] = m11 + tangent * m01;
+  FOR(i, 3)
+  {
+    pair_vectors[i] = v[i];
+    pair_vectors[3 + i] = cosine * u[i] - sine * w[i];
+    pair_vectors[6 + i] = sine * u[i] + cosine * w[i];
+  }
+  SortEigenpairs3(pair_values, pair_vectors, scale, values, vectors);
+}
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* 3 x 3 Symmetric Eigensolver
+***************************************************************************************************************************************************************/
+template<std::floating_point T>
+SymmetricEigenSystem3<T>
+SymmetricEigen(const SMatrix<T, 3>& matrix)
+{
+  SymmetricEigenSystem3<T> system;
+  detail::SymmetricEigen3(matrix(0, 0), matrix(1, 0), matrix(2, 0), matrix(1, 1), matrix(2, 1), matrix(2, 2), system.Eigenvalues.data(),
+                          system.Eigenvectors.data());
+  return system;
+}
+
+template<std::floating_point T>
+SVector3<T>
+SymmetricEigenvalues(const SMatrix<T, 3>& matrix)
+{
+  SVector3<T> eigenvalues;
+  detail::SymmetricEigen3(matrix(0, 0), matrix(1, 0), matrix(2, 0), matrix(1, 1), matrix(2, 1), matrix(2, 2), eigenvalues.data(), static_cast<T*>(nullptr));
+  return eigenvalues;
+}
+
+template<detail::Matrix3Range R>
+void
+SymmetricEigen(const R& matrices, std::span<SVector3<detail::Matrix3Value<R>>> eigenvalues, std::span<SMatrix<detail::Matrix3Value<R>, 3>> eigenvectors)
+{
+  using T = detail::Matrix3Value<R>;
+  const size_t n = std::ranges::size(matrices);
+  DEBUG_ASSERT(eigenvalues.size() == n && eigenvectors.size() == n, "There must be one output per matrix.")
+
+  const auto* a = std::ranges::data(matrices);
+  parallel::For(n, [&](const size_t first, const size_t last)
+  {
+    FOR(k, first, last)
+    {
+      const T* entries = a[k].data();
+      detail::SymmetricEigen3(entries[0], entries[1], entries[2], entries[4], entries[5], entries[8], eigenvalues[k].data(), eigenvectors[k].data());
+    }
+  });
+}
+
+template<detail::Matrix3Range R>
+void
+SymmetricEigenvalues(const R& matrices, std::span<SVector3<detail::Matrix3Value<R>>> eigenvalues)
+{
+  using T = detail::Matrix3Value<R>;
+  const size_t n = std::ranges::size(matrices);
+  DEBUG_ASSERT(eigenvalues.size() == n, "There must be one output per matrix.")
+
+  const auto* a = std::ranges::data(matrices);
+  parallel::For(n, [&](const size_t first, const size_t last)
+  {
+    FOR(k, first, last)
+    {
+      const T* entries = a[k].data();
+      detail::SymmetricEigen3(entries[0], entries[1], entries[2], entries[4], entries[5], entries[8], eigenvalues[k].data(), static_cast<T*>(nullptr));
+    }
+  });
+}
+
+/***************************************************************************************************************************************************************
+* Dense Symmetric Eigendecomposition
+***************************************************************************************************************************************************************/
+template<std::floating_point T>
+template<class D>
+void
+SymmetricEigenDecomposition<T>::Decompose(const Matrix<T, D>& matrix, const bool is_vector_computed)
+{
+  DEBUG_ASSERT(matrix.isSquare(), "Symmetric eigendecomposition requires a square matrix, not a ", matrix.nRows(), " x ", matrix.nColumns(), " matrix.")
+
+  auto tridiagonal = detail::DynamicCopy(matrix);
+  DynamicVector<T> off_diagonal;
+  isConverged_ = true;
+  Tridiagonalise(tridiagonal, off_diagonal, is_vector_computed);
+  DiagonaliseTridiagonal(off_diagonal, is_vector_computed);
+  SortEigenpairs(is_vector_computed);
+}
+
+template<std::floating_point T>
+void
+SymmetricEigenDecomposition<T>::Tridiagonalise(DynamicMatrix<T>& matrix, DynamicVector<T>& off_diagonal, const bool is_vector_computed)
+{
+  const size_t n = matrix.nRows();
+  T* a = matrix.data();
+  FOR(j, n) FOR(i, j) a[i + j * n] = a[j + i * n];
+
+  // Reduce column k with the reflection H = I - βvv^T, with v (where v_0 = 1) stored below the sub-diagonal, and update the trailing block A22 with the
+  // symmetric rank-2 update A22 - vw^T - wv^T, where w = p - (β/2)(p.v)v and p = βA22v.
+  DynamicVector<T> scales(n, T(0)), products(n), updates(n);
+  off_diagonal = DynamicVector<T>(n, T(0));
+  T* p = products.data();
+  T* w = updates.data();
+  for(size_t k = 0; k + 2 < n; ++k)
+  {
+    const size_t m = n - k - 1;
+    T* v = a + (k + 1) + k * n;
+    T* a22 = a + (k + 1) * (n + 1);
+
+    T sigma(0);
+    FOR(i, 1, m) sigma += v[i] * v[i];
+    if(sigma == T(0)) { off_diagonal[k] = v[0]; continue; }
+
+    const T norm = std::sqrt(v[0] * v[0] + sigma);
+    const T alpha = v[0] <= T(0) ? norm : -norm;
+    const T v0 = v[0] - alpha;
+    const T beta = T(2) * v0 * v0 / (v0 * v0 + sigma);
+    FOR(i, 1, m) v[i] /= v0;
+    v[0] = T(1);
+    off_diagonal[k] = alpha;
+    scales[k] = beta;
+
+    #pragma omp parallel for schedule(static) if(parallel::isParallel(m * m))
+    for(size_t i = 0; i < m; ++i)
+    {
+      const T* column = a22 + i * n;
+      T sum(0);
+      FOR(l, m) sum += column[l] * v[l];
+      p[i] = beta * sum;
+    }
+
+    T pv(0);
+    FOR(i, m) pv += p[i] * v[i];
+    const T gamma = T(0.5) * beta * pv;
+    FOR(i, m) w[i] = p[i] - gamma * v[i];
+
+    #pragma omp parallel for schedule(static) if(parallel::isParallel(m * m))
+    for(size_t j = 0; j < m; ++j)
+    {
+      T* column = a22 + j * n;
+      const T v_j = v[j], w_j = w[j];
+      FOR(i, m) column[i] -= v[i] * w_j + w[i] * v_j;
+    }
+  }
+  if(n >= 2) off_diagonal[n - 2] = a[(n - 1) + (n - 2) * n];
+
+  Eigenvalues_ = DynamicVector<T>(n);
+  FOR(i, n) Eigenvalues_[i] = a[i + i * n];
+  if(!is_vector_computed) { Eigenvectors_ = DynamicMatrix<T>(); return; }
+
+  // Accumulate Q = H_0 H_1 ... H_{n - 3} backwards, so that each reflection only acts on the trailing block of Q it affects.
+  Eigenvectors_ = DynamicMatrix<T>::Identity(n);
+  T* q = Eigenvectors_.data();
+  for(size_t k = n >= 3 ? n - 2 : 0; k-- > 0;)
+  {
+    if(scales[k] == T(0)) continue;
+
+    const size_t m = n - k - 1;
+    const T* v = a + (k + 1) + k * n;
+    #pragma omp parallel for schedule(static) if(parallel::isParallel(m * m))
+    for(size_t j = k + 1; j < n; ++j)
+    {
+      T* column = q + (k + 1) + j * n;
+      T sum(0);
+      FOR(i, m) sum += v[i] * column[i];
+      const T s = scales[k] * sum;
+      FOR(i, m) column[i] -= s * v[i];
+    }
+  }
+}
+
+template<std::floating_point T>
+void
+SymmetricEigenDecomposition<T>::DiagonaliseTridiagonal(DynamicVector<T>& off_diagonal, const bool is_vector_computed)
+{
+  constexpr size_t max_iterations = 30;
+  const size_t n = size();
+  T* d = Eigenvalues_.data();
+  T* e = off_diagonal.data();
+  T* z = Eigenvectors_.data();
+
+  // Implicit QL iterations with Wilkinson shifts, each chasing a bulge up the unreduced block [l, m] with Givens rotations, until e_l vanishes.
+  FOR(l, n)
+  {
+    size_t n_iterations = 0;
+    while(true)
+    {
+      size_t m = l;
+      for(; m + 1 < n; ++m)
+        if(Abs(e[m]) <= std::numeric_limits<T>::epsilon() * (Abs(d[m]) + Abs(d[m + 1]))) break;
+      if(m == l) break;
+      if(n_iterations++ == max_iterations) { isConverged_ = false; break; }
+
+      T g = (d[l + 1] - d[l]) / (T(2) * e[l]);
+      T r = std::hypot(g, T(1));
+      g = d[m] - d[l] + e[l] / (g + std::copysign(r, g));
+      T s(1), c(1), p(0);
+      bool is_underflow = false;
+      for(size_t i = m; i-- > l;)
+      {
+        const T f = s * e[i];
+        const T b = c * e[i];
+        r = std::hypot(f, g);
+        e[i + 1] = r;
+        if(r == T(0))
+        {
+          d[i + 1] -= p;
+          e[m] = T(0);
+          is_underflow = true;
+          break;
+        }
+        s = f / r;
+        c = g / r;
+        g = d[i + 1] - p;
+        r = (d[i] - g) * s + T(2) * c * b;
+        p = s * r;
+        d[i + 1] = g + p;
+        g = c * r - b;
+
+        if(is_vector_computed)
+        {
+          T* z0 = z + i * n;
+          T* z1 = z + (i + 1) * n;
+          FOR(k, n)
+          {
+            const T z1_k = z1[k];
+            z1[k] = s * z0[k] + c * z1_k;
+            z0[k] = c * z0[k] - s * z1_k;
+          }
+        }
+      }
+      if(is_underflow) continue;
+
+      d[l] -= p;
+      e[l] = g;
+      e[m] = T(0);
+    }
+  }
+}
+
+template<std::floating_point T>
+void
+SymmetricEigenDecomposition<T>::SortEigenpairs(const bool is_vector_computed)
+{
+  const size_t n = size();
+  DynamicArray<size_t> order;
+  order.resize(n);
+  std::iota(order.begin(), order.end(), size_t(0));
+  std::sort(order.begin(), order.end(), [this](const size_t i, const size_t j) { return Eigenvalues_[i] < Eigenvalues_[j]; });
+  if(std::is_sorted(order.begin(), order.end())) return;
+
+  const DynamicVector<T> unsorted = Eigenvalues_;
+  FOR(i, n) Eigenvalues_[i] = unsorted[order[i]];
+  if(!is_vector_computed) return;
+
+  DynamicMatrix<T> sorted(n, n);
+  FOR(j, n) std::copy_n(Eigenvectors_.data() + order[j] * n, n, sorted.data() + j * n);
+  Eigenvectors_ = std::move(sorted);
+}
+
+}
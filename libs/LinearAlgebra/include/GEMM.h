@@ -0,0 +1,207 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "../../DataContainer/include/Array.h"
+#include "../../DataContainer/include/SIMD.h"
+
+#include <omp.h>
+
+/***************************************************************************************************************************************************************
+* General Matrix Multiplication
+*
+* Products of dense matrices, C = A * B (or C += A * B), where C is column-major and A and B are strided, so that transposed and row-major operands are
+* multiplied without being copied. Large floating-point products are computed as in GotoBLAS: B is packed in kc x nc panels that stay in the last-level
+* cache, A in mc x kc blocks that stay in the L2 cache, and each block product is computed by a register-tiled SIMD micro-kernel (see SIMD.tpp), whose
+* packed operands stream through the L1 cache. The block products of each panel are distributed over threads.
+***************************************************************************************************************************************************************/
+
+namespace aprn::gemm {
+
+/** Read-only strided matrix operand, whose entry (i, j) is Data[i * RowStride + j * ColumnStride]. Column-major matrices have a unit row stride, and
+    their transposes (or row-major matrices) a unit column stride. */
+template<typename T>
+struct Operand
+{
+  const T* Data;
+  size_t   RowStride;
+  size_t   ColumnStride;
+
+  constexpr T
+  operator()(const size_t i, const size_t j) const { return Data[i * RowStride + j * ColumnStride]; }
+
+  constexpr Operand
+  Transpose() const { return {Data, ColumnStride, RowStride}; }
+};
+
+/** Cache block sizes, i.e. the depth (kc), rows (mc) and columns (nc) of the packed blocks. */
+template<typename T> constexpr size_t BlockDepth   = 256;
+template<typename T> constexpr size_t BlockRows    = 128 * sizeof(double) / sizeof(T);
+template<typename T> constexpr size_t BlockColumns = 2048;
+
+/** Number of columns of each packed panel of B that is multiplied by a thread at a time (a multiple of any micro-kernel tile). */
+constexpr size_t ThreadColumns = 96;
+
+/** Minimum number of multiply-adds (m * n * k) for which products are packed and computed by the SIMD kernels, and distributed over threads. */
+constexpr size_t MinBlockedProduct  = size_t(1) << 12;
+constexpr size_t MinParallelProduct = size_t(1) << 21;
+
+namespace detail {
+
+/** Pack an mc x kc block of alpha * A, in panels of tile_rows rows (zero-padded), each of which is stored column by column. */
+template<typename T>
+void
+PackBlock(const Operand<T>& a, const size_t i0, const size_t p0, const size_t mc, const size_t kc, const size_t tile_rows, const T alpha, T* packed)
+{
+  for(size_t i = 0; i < mc; i += tile_rows)
+  {
+    const size_t rows = Min(tile_rows, mc - i);
+    FOR(p, kc)
+    {
+      FOR(r, rows) *packed++ = alpha * a(i0 + i + r, p0 + p);
+      FOR(r, rows, tile_rows) *packed++ = T(0);
+    }
+  }
+}
+
+/** Pack a kc x tile_columns panel of B (zero-padded), row by row. */
+template<typename T>
+void
+PackPanel(const Operand<T>& b, const size_t p0, const size_t j0, const size_t kc, const size_t columns, const size_t tile_columns, T* packed)
+{
+  FOR(p, kc)
+  {
+    FOR(c, columns) *packed++ = b(p0 + p, j0 + c);
+    FOR(c, columns, tile_columns) *packed++ = T(0);
+  }
+}
+
+/** Plain product, for small or non-floating-point matrices. */
+template<typename T>
+void
+MultiplyUnblocked(const size_t m, const size_t n, const size_t k, const Operand<T>& a, const Operand<T>& b, T* c, const size_t ldc, const bool accumulate,
+                  const T alpha)
+{
+  FOR(j, n)
+  {
+    T* c_column = c + j * ldc;
+    if(!accumulate) FOR(i, m) c_column[i] = T(0);
+    FOR(p, k)
+    {
+      const T b_entry = alpha * b(p, j);
+      FOR(i, m) c_column[i] += a(i, p) * b_entry;
+    }
+  }
+}
+
+}//detail
+
+/** Compute C = alpha * A * B, or C += alpha * A * B if accumulating, where A is m x k, B is k x n, and C is m x n with leading dimension (column stride)
+    ldc. C must not overlap A or B. */
+template<typename T>
+void
+Multiply(const size_t m, const size_t n, const size_t k, const Operand<T>& a, const Operand<T>& b, T* c, const size_t ldc, const bool accumulate = false,
+         const T alpha = T(1))
+{
+  if constexpr(simd::SIMDType<T>)
+    if(m * n * k >= MinBlockedProduct)
+    {
+      const auto tile = simd::GEMMTile<T>();
+      const size_t tile_rows = tile.first;
+      const size_t tile_columns = tile.second;
+      const size_t max_depth = Min(k, BlockDepth<T>);
+      const size_t max_rows = Min(m, BlockRows<T>);
+      const size_t max_columns = Min(n, BlockColumns<T>);
+
+      AlignedArray<T> packed_b((max_columns / tile_columns + 1) * tile_columns * max_depth);
+      const bool is_parallel = m * n * k >= MinParallelProduct && omp_get_max_threads() > 1 && !omp_in_parallel();
+
+      #pragma omp parallel if(is_parallel)
+      {
+        AlignedArray<T> packed_a((max_rows / tile_rows + 1) * tile_rows * max_depth);
+
+        for(size_t jc = 0; jc < n; jc += BlockColumns<T>)
+        {
+          const size_t nc = Min(BlockColumns<T>, n - jc);
+          const size_t n_row_blocks = (m - 1) / BlockRows<T> + 1;
+          const size_t n_column_blocks = (nc - 1) / ThreadColumns + 1;
+
+          for(size_t pc = 0; pc < k; pc += BlockDepth<T>)
+          {
+            const size_t kc = Min(BlockDepth<T>, k - pc);
+
+            #pragma omp for schedule(static)
+            for(size_t jr = 0; jr < nc; jr += tile_columns)
+              detail::PackPanel(b, pc, jc + jr, kc, Min(tile_columns, nc - jr), tile_columns, packed_b.data() + jr * kc);
+
+            // Each thread multiplies a contiguous range of (row block, column block) pairs, so that its packed block of A is mostly reused.
+            size_t packed_block = -1;
+            #pragma omp for schedule(static)
+            for(size_t block = 0; block < n_row_blocks * n_column_blocks; ++block)
+            {
+              const size_t ic = block / n_column_blocks * BlockRows<T>;
+              const size_t jr = block % n_column_blocks * ThreadColumns;
+              const size_t mc = Min(BlockRows<T>, m - ic);
+              if(packed_block != ic) detail::PackBlock(a, ic, pc, mc, kc, tile_rows, alpha, packed_a.data());
+              packed_block = ic;
+
+              simd::GEMMBlock(mc, Min(ThreadColumns, nc - jr), kc, packed_a.data(), packed_b.data() + jr * kc, c + (jc + jr) * ldc + ic, ldc,
+                              accumulate || pc > 0);
+            }
+          }
+        }
+      }
+      return;
+    }
+
+  detail::MultiplyUnblocked(m, n, k, a, b, c, ldc, accumulate, alpha);
+}
+
+/** Compute y = A * x, or y += A * x if accumulating, where A is m x n. Column-major matrices are swept column by column over blocks of rows (in parallel for
+    large matrices), and row-major matrices row by row with SIMD dot products. y must not overlap A or x. */
+template<typename T>
+void
+MultiplyVector(const size_t m, const size_t n, const Operand<T>& a, const T* x, T* y, const bool accumulate = false)
+{
+  constexpr size_t block_rows = 256;
+
+  if(a.ColumnStride == 1 && a.RowStride != 1)
+  {
+    if constexpr(simd::SIMDType<T>)
+    {
+      FOR(i, m) y[i] = (accumulate ? y[i] : T(0)) + simd::Dot(a.Data + i * a.RowStride, x, n);
+      return;
+    }
+  }
+
+  const size_t n_blocks = m / block_rows + (m % block_rows != 0);
+  const bool is_parallel = m * n >= MinParallelProduct / 16 && omp_get_max_threads() > 1 && !omp_in_parallel();
+
+  #pragma omp parallel for schedule(static) if(is_parallel)
+  for(size_t block = 0; block < n_blocks; ++block)
+  {
+    const size_t first = block * block_rows;
+    const size_t last = Min(first + block_rows, m);
+    if(!accumulate) FOR(i, first, last) y[i] = T(0);
+    FOR(j, n)
+    {
+      const T x_entry = x[j];
+      FOR(i, first, last) y[i] += a(i, j) * x_entry;
+    }
+  }
+}
+
+}//aprn::gemm
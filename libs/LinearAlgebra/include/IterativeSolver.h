@@ -0,0 +1,163 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "../../DataContainer/include/Array.h"
+#include "LinearOperator.h"
+#include "SparseMatrix.h"
+#include "Vector.h"
+#include "VectorOperations.h"
+
+#include <chrono>
+#include <functional>
+
+/***************************************************************************************************************************************************************
+* Iterative Linear Solvers
+*
+* Krylov subspace methods for Ax = b, which only access A (and the preconditioner M, an approximation of A^-1) through matrix-vector products, and only
+* store a few vectors: conjugate gradients (CG) for symmetric positive-definite A, BiCGSTAB for general A, and restarted GMRES(m) for general A, which
+* stores m + 1 basis vectors. Each iteration costs one or two operator products, i.e. O(nnz) for sparse operators, and a few (parallel, SIMD) vector
+* updates and inner products. The convergence criterion is on the true (unpreconditioned) residual, |b - Ax| <= max(rtol * |b|, atol).
+***************************************************************************************************************************************************************/
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Iterative Solver Settings and Telemetry
+***************************************************************************************************************************************************************/
+struct IterativeSettings
+{
+  Real   RelativeTolerance{1.0e-8};
+  Real   AbsoluteTolerance{Zero};
+  size_t MaxIterations{1000};
+
+  /** Number of iterations between GMRES restarts, i.e. the Krylov subspace dimension. */
+  size_t Restart{30};
+
+  /** Whether the residual norm of each iteration is recorded. */
+  bool   isHistoryRecorded{false};
+
+  /** Function called after each iteration with the iteration number and the residual norm, which can stop the solver by returning false. */
+  std::function<bool(size_t, Real)> Monitor;
+};
+
+struct IterativeReport
+{
+  bool         isConverged{false};
+  size_t       nIterations{0};
+  size_t       nOperatorProducts{0};
+  size_t       nPreconditionerProducts{0};
+  Real         InitialResidual{Zero};
+  Real         FinalResidual{Zero};
+  DArray<Real> ResidualHistory;
+
+  /** Wall-clock time of the solve, in seconds. */
+  Real         Time{Zero};
+};
+
+/***************************************************************************************************************************************************************
+* Preconditioner Classes
+***************************************************************************************************************************************************************/
+
+/** Jacobi (diagonal) preconditioner, M = D^-1. */
+template<typename T>
+class JacobiPreconditioner final : public LinearOperator<T>
+{
+public:
+  template<bool is_row_compressed>
+  explicit JacobiPreconditioner(const CompressedMatrix<T, is_row_compressed>& matrix);
+
+  explicit JacobiPreconditioner(const DynamicVector<T>& diagonal);
+
+  size_t nRows() const override { return InverseDiagonal_.size(); }
+
+  size_t nColumns() const override { return InverseDiagonal_.size(); }
+
+  void Apply(const DynamicVector<T>& x, DynamicVector<T>& y) const override { y = x * InverseDiagonal_; }
+
+private:
+  DynamicVector<T> InverseDiagonal_;
+};
+
+/** Zero fill-in incomplete Cholesky preconditioner, IC(0), of a symmetric positive-definite CSR matrix: M = (LL^T)^-1, where L has the sparsity pattern of
+    the lower triangle of A. Both triangular solves of an application are sequential. */
+template<typename T>
+class IncompleteCholeskyPreconditioner final : public LinearOperator<T>
+{
+public:
+  explicit IncompleteCholeskyPreconditioner(const CsrMatrix<T>& matrix);
+
+  size_t nRows() const override { return Factor_.nRows(); }
+
+  size_t nColumns() const override { return Factor_.nRows(); }
+
+  void Apply(const DynamicVector<T>& x, DynamicVector<T>& y) const override;
+
+  /** L, whose last entry in each row is the diagonal entry. */
+  const CsrMatrix<T>&
+  Factor() const { return Factor_; }
+
+private:
+  CsrMatrix<T> Factor_;
+};
+
+/** Zero fill-in incomplete LU preconditioner, ILU(0), of a CSR matrix with a full diagonal: M = (LU)^-1, where L (unit lower-triangular) and U have the
+    sparsity pattern of A. Both triangular solves of an application are sequential. */
+template<typename T>
+class IncompleteLUPreconditioner final : public LinearOperator<T>
+{
+public:
+  explicit IncompleteLUPreconditioner(const CsrMatrix<T>& matrix);
+
+  size_t nRows() const override { return Factors_.nRows(); }
+
+  size_t nColumns() const override { return Factors_.nRows(); }
+
+  void Apply(const DynamicVector<T>& x, DynamicVector<T>& y) const override;
+
+  /** L (below the diagonal, without its unit diagonal) and U (on and above the diagonal), in the pattern of A. */
+  const CsrMatrix<T>&
+  Factors() const { return Factors_; }
+
+private:
+  CsrMatrix<T>         Factors_;
+  DynamicArray<size_t> Diagonals_;
+};
+
+/***************************************************************************************************************************************************************
+* Iterative Solvers
+***************************************************************************************************************************************************************/
+
+/** Solve Ax = b, starting from the given x (or from zero if x is not of the right size), with an optional preconditioner M ~ A^-1. */
+template<typename T>
+IterativeReport
+ConjugateGradient(const LinearOperator<T>& matrix, const DynamicVector<T>& rhs, DynamicVector<T>& solution,
+                  const LinearOperator<std::type_identity_t<T>>* preconditioner = nullptr, const IterativeSettings& settings = {});
+
+template<typename T>
+IterativeReport
+BiCGSTAB(const LinearOperator<T>& matrix, const DynamicVector<T>& rhs, DynamicVector<T>& solution,
+         const LinearOperator<std::type_identity_t<T>>* preconditioner = nullptr, const IterativeSettings& settings = {});
+
+/** Restarted GMRES, with right preconditioning, A M y = b and x = M y, so that the minimised residual is the true residual. */
+template<typename T>
+IterativeReport
+GMRES(const LinearOperator<T>& matrix, const DynamicVector<T>& rhs, DynamicVector<T>& solution,
+      const LinearOperator<std::type_identity_t<T>>* preconditioner = nullptr, const IterativeSettings& settings = {});
+
+}
+
+#include "IterativeSolver.tpp"
@@ -0,0 +1,438 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+namespace aprn {
+namespace detail {
+
+/** Book-keeping shared by the iterative solvers: the convergence threshold, the iteration count and limit, and the telemetry. */
+class IterationTracker
+{
+public:
+  IterationTracker(const IterativeSettings& settings, const Real rhs_norm)
+    : Settings_(settings), Threshold_(Max(settings.RelativeTolerance * rhs_norm, settings.AbsoluteTolerance)), Start_(std::chrono::steady_clock::now()) {}
+
+  IterativeReport&
+  Report() { return Report_; }
+
+  bool
+  isConverged(const Real residual) const { return residual <= Threshold_; }
+
+  /** Record the initial residual, returning false if no iterations are required. */
+  bool
+  Start(const Real residual)
+  {
+    Report_.InitialResidual = residual;
+    Record(residual);
+    Report_.isConverged = isConverged(residual);
+    return !Report_.isConverged && Settings_.MaxIterations > 0;
+  }
+
+  /** Record the residual of an iteration, returning false if the solver should stop, i.e. if it has converged, broken down (with a non-finite residual),
+      reached the iteration limit, or been stopped by the monitor. */
+  bool
+  Continue(const Real residual)
+  {
+    ++Report_.nIterations;
+    Record(residual);
+    Report_.isConverged = isConverged(residual);
+
+    const bool is_stopped = Settings_.Monitor && !Settings_.Monitor(Report_.nIterations, residual);
+    return !Report_.isConverged && !is_stopped && std::isfinite(residual) && Report_.nIterations < Settings_.MaxIterations;
+  }
+
+  IterativeReport
+  Finish()
+  {
+    Report_.Time = std::chrono::duration<Real>(std::chrono::steady_clock::now() - Start_).count();
+    return std::move(Report_);
+  }
+
+private:
+  void
+  Record(const Real residual)
+  {
+    Report_.FinalResidual = residual;
+    if(Settings_.isHistoryRecorded) Report_.ResidualHistory.push_back(residual);
+  }
+
+  const IterativeSettings&              Settings_;
+  const Real                            Threshold_;
+  const std::chrono::steady_clock::time_point Start_;
+  IterativeReport                       Report_;
+};
+
+/** Apply a preconditioner to a vector, returning the vector itself if there is no preconditioner. */
+template<typename T>
+const DynamicVector<T>&
+Precondition(const LinearOperator<T>* preconditioner, const DynamicVector<T>& vector, DynamicVector<T>& result, IterativeReport& report)
+{
+  if(!preconditioner) return vector;
+
+  preconditioner->Apply(vector, result);
+  ++report.nPreconditionerProducts;
+  return result;
+}
+
+template<typename T>
+Real
+Norm(const DynamicVector<T>& vector) { return std::sqrt(static_cast<Real>(InnerProduct(vector, vector))); }
+
+/** Check the operator, right-hand side and preconditioner sizes, and start from zero if the initial solution is not of the right size. */
+template<typename T>
+void
+PrepareSolve(const LinearOperator<T>& matrix, const DynamicVector<T>& rhs, DynamicVector<T>& solution, const LinearOperator<T>* preconditioner)
+{
+  const size_t n = matrix.nRows();
+  DEBUG_ASSERT(matrix.nColumns() == n, "Iterative solvers require a square operator, not a ", n, " x ", matrix.nColumns(), " operator.")
+  DEBUG_ASSERT(rhs.size() == n, "The right-hand side size ", rhs.size(), " must equal the operator size ", n, ".")
+  DEBUG_ASSERT(!preconditioner || preconditioner->nRows() == n, "The preconditioner size ", preconditioner->nRows(), " must equal the operator size ", n, ".")
+  if(solution.size() != n) solution = DynamicVector<T>(n, T(0));
+}
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* Preconditioner Classes
+***************************************************************************************************************************************************************/
+template<typename T>
+template<bool is_row_compressed>
+JacobiPreconditioner<T>::JacobiPreconditioner(const CompressedMatrix<T, is_row_compressed>& matrix)
+  : InverseDiagonal_(matrix.nRows())
+{
+  DEBUG_ASSERT(matrix.nRows() == matrix.nColumns(), "Jacobi preconditioning requires a square matrix.")
+  FOR(i, matrix.nRows())
+  {
+    const T diagonal = matrix(i, i);
+    ASSERT(diagonal != T(0), "Jacobi preconditioning requires non-zero diagonal entries, but entry (", i, ", ", i, ") is zero.")
+    InverseDiagonal_[i] = T(1) / diagonal;
+  }
+}
+
+template<typename T>
+JacobiPreconditioner<T>::JacobiPreconditioner(const DynamicVector<T>& diagonal)
+  : InverseDiagonal_(diagonal.size())
+{
+  FOR(i, diagonal.size())
+  {
+    ASSERT(diagonal[i] != T(0), "Jacobi preconditioning requires non-zero diagonal entries, but entry (", i, ", ", i, ") is zero.")
+    InverseDiagonal_[i] = T(1) / diagonal[i];
+  }
+}
+
+template<typename T>
+IncompleteCholeskyPreconditioner<T>::IncompleteCholeskyPreconditioner(const CsrMatrix<T>& matrix)
+{
+  DEBUG_ASSERT(matrix.nRows() == matrix.nColumns(), "Incomplete Cholesky preconditioning requires a square matrix.")
+
+  // Copy the lower triangle of A.
+  const size_t n = matrix.nRows();
+  DynamicArray<size_t> offsets{size_t(0)};
+  DynamicArray<size_t> indices;
+  AlignedArray<T> values;
+  offsets.reserve(n + 1);
+  FOR(i, n)
+  {
+    FOR(k, matrix.Offsets()[i], matrix.Offsets()[i + 1])
+      if(matrix.Indices()[k] <= i)
+      {
+        indices.push_back(matrix.Indices()[k]);
+        values.push_back(matrix.Values()[k]);
+      }
+    ASSERT(!indices.empty() && indices.back() == i, "Incomplete Cholesky preconditioning requires a full diagonal, but entry (", i, ", ", i, ") is absent.")
+    offsets.push_back(indices.size());
+  }
+
+  // Factorise row by row: L(i, j) = (A(i, j) - sum_k L(i, k) L(j, k)) / L(j, j), summed over the columns k < j common to both rows.
+  FOR(i, n)
+  {
+    FOR(k, offsets[i], offsets[i + 1])
+    {
+      const size_t j = indices[k];
+      const size_t j_diagonal = offsets[j + 1] - 1;
+      T sum = values[k];
+      for(size_t p = offsets[i], q = offsets[j]; p < k && q < j_diagonal;)
+      {
+        if(indices[p] < indices[q]) ++p;
+        else if(indices[p] > indices[q]) ++q;
+        else sum -= values[p++] * values[q++];
+      }
+
+      if(j < i) values[k] = sum / values[j_diagonal];
+      else
+      {
+        ASSERT(sum > T(0), "Incomplete Cholesky factorisation broke down at row ", i, ", as the matrix is not (sufficiently) positive-definite.")
+        values[k] = std::sqrt(sum);
+      }
+    }
+  }
+
+  Factor_ = CsrMatrix<T>(n, n, std::move(offsets), std::move(indices), std::move(values));
+}
+
+template<typename T>
+void
+IncompleteCholeskyPreconditioner<T>::Apply(const DynamicVector<T>& x, DynamicVector<T>& y) const
+{
+  const size_t n = nRows();
+  const size_t* offsets = Factor_.Offsets().data();
+  const size_t* indices = Factor_.Indices().data();
+  const T* values = Factor_.Values().data();
+  y.resize(n);
+
+  // Solve Lz = x by rows of L, and then L^T y = z by columns of L^T.
+  FOR(i, n)
+  {
+    const size_t diagonal = offsets[i + 1] - 1;
+    y[i] = (x[i] - detail::SparseDot(values, indices, y.data(), offsets[i], diagonal)) / values[diagonal];
+  }
+  for(size_t i = n; i-- > 0;)
+  {
+    const size_t diagonal = offsets[i + 1] - 1;
+    y[i] /= values[diagonal];
+    const T y_i = y[i];
+    FOR(k, offsets[i], diagonal) y[indices[k]] -= values[k] * y_i;
+  }
+}
+
+template<typename T>
+IncompleteLUPreconditioner<T>::IncompleteLUPreconditioner(const CsrMatrix<T>& matrix)
+  : Factors_(matrix)
+{
+  DEBUG_ASSERT(matrix.nRows() == matrix.nColumns(), "Incomplete LU preconditioning requires a square matrix.")
+
+  const size_t n = nRows();
+  const size_t* offsets = Factors_.Offsets().data();
+  const size_t* indices = Factors_.Indices().data();
+  T* values = Factors_.Values().data();
+
+  Diagonals_.resize(n);
+  FOR(i, n)
+  {
+    const auto diagonal = std::lower_bound(indices + offsets[i], indices + offsets[i + 1], i);
+    ASSERT(diagonal != indices + offsets[i + 1] && *diagonal == i, "Incomplete LU preconditioning requires a full diagonal, but entry (", i, ", ", i,
+           ") is absent.")
+    Diagonals_[i] = diagonal - indices;
+  }
+
+  // Eliminate row by row (the IKJ variant of Gaussian elimination), discarding any fill-in outside the pattern of A. The positions of the entries of the
+  // current row are scattered into a dense index to find matching columns.
+  constexpr size_t absent = -1;
+  DynamicArray<size_t> positions;
+  positions.assign(n, absent);
+  FOR(i, n)
+  {
+    FOR(k, offsets[i], offsets[i + 1]) positions[indices[k]] = k;
+    FOR(k, offsets[i], Diagonals_[i])
+    {
+      const size_t j = indices[k];
+      values[k] /= values[Diagonals_[j]];
+      const T l = values[k];
+      FOR(q, Diagonals_[j] + 1, offsets[j + 1]) if(positions[indices[q]] != absent) values[positions[indices[q]]] -= l * values[q];
+    }
+    ASSERT(values[Diagonals_[i]] != T(0), "Incomplete LU factorisation broke down with a zero pivot at row ", i, ".")
+    FOR(k, offsets[i], offsets[i + 1]) positions[indices[k]] = absent;
+  }
+}
+
+template<typename T>
+void
+IncompleteLUPreconditioner<T>::Apply(const DynamicVector<T>& x, DynamicVector<T>& y) const
+{
+  const size_t n = nRows();
+  const size_t* offsets = Factors_.Offsets().data();
+  const size_t* indices = Factors_.Indices().data();
+  const T* values = Factors_.Values().data();
+  y.resize(n);
+
+  FOR(i, n) y[i] = x[i] - detail::SparseDot(values, indices, y.data(), offsets[i], Diagonals_[i]);
+  for(size_t i = n; i-- > 0;)
+    y[i] = (y[i] - detail::SparseDot(values, indices, y.data(), Diagonals_[i] + 1, offsets[i + 1])) / values[Diagonals_[i]];
+}
+
+/***************************************************************************************************************************************************************
+* Iterative Solvers
+***************************************************************************************************************************************************************/
+template<typename T>
+IterativeReport
+ConjugateGradient(const LinearOperator<T>& matrix, const DynamicVector<T>& rhs, DynamicVector<T>& solution,
+                  const LinearOperator<std::type_identity_t<T>>* preconditioner, const IterativeSettings& settings)
+{
+  detail::PrepareSolve(matrix, rhs, solution, preconditioner);
+  detail::IterationTracker tracker(settings, detail::Norm(rhs));
+  auto& report = tracker.Report();
+
+  DynamicVector<T> residual, preconditioned, direction, product;
+  matrix.Apply(solution, product);
+  ++report.nOperatorProducts;
+  residual = rhs - product;
+  if(!tracker.Start(detail::Norm(residual))) return tracker.Finish();
+
+  direction = detail::Precondition(preconditioner, residual, preconditioned, report);
+  T rz = InnerProduct(residual, direction);
+  while(true)
+  {
+    matrix.Apply(direction, product);
+    ++report.nOperatorProducts;
+
+    const T alpha = rz / InnerProduct(direction, product);
+    solution += alpha * direction;
+    residual -= alpha * product;
+    if(!tracker.Continue(detail::Norm(residual))) break;
+
+    const auto& z = detail::Precondition(preconditioner, residual, preconditioned, report);
+    const T rz_next = InnerProduct(residual, z);
+    direction = z + (rz_next / rz) * direction;
+    rz = rz_next;
+  }
+  return tracker.Finish();
+}
+
+template<typename T>
+IterativeReport
+BiCGSTAB(const LinearOperator<T>& matrix, const DynamicVector<T>& rhs, DynamicVector<T>& solution,
+         const LinearOperator<std::type_identity_t<T>>* preconditioner, const IterativeSettings& settings)
+{
+  detail::PrepareSolve(matrix, rhs, solution, preconditioner);
+  detail::IterationTracker tracker(settings, detail::Norm(rhs));
+  auto& report = tracker.Report();
+
+  DynamicVector<T> residual, shadow, direction, product, preconditioned, stabiliser;
+  matrix.Apply(solution, product);
+  ++report.nOperatorProducts;
+  residual = rhs - product;
+  if(!tracker.Start(detail::Norm(residual))) return tracker.Finish();
+
+  shadow = residual;
+  direction = residual;
+  T rho = InnerProduct(shadow, residual);
+  while(true)
+  {
+    const auto& p = detail::Precondition(preconditioner, direction, preconditioned, report);
+    matrix.Apply(p, product);
+    ++report.nOperatorProducts;
+
+    const T alpha = rho / InnerProduct(shadow, product);
+    solution += alpha * p;
+    residual -= alpha * product;
+    const Real half_step_residual = detail::Norm(residual);
+    if(tracker.isConverged(half_step_residual)) { tracker.Continue(half_step_residual); break; }
+
+    // Stabilising step, minimising the residual along the preconditioned residual. The product of the previous step is kept for the direction update.
+    const auto& s = detail::Precondition(preconditioner, residual, preconditioned, report);
+    matrix.Apply(s, stabiliser);
+    ++report.nOperatorProducts;
+
+    const T omega = InnerProduct(stabiliser, residual) / InnerProduct(stabiliser, stabiliser);
+    solution += omega * s;
+    residual -= omega * stabiliser;
+    if(!tracker.Continue(detail::Norm(residual))) break;
+
+    const T rho_next = InnerProduct(shadow, residual);
+    if(rho_next == T(0) || omega == T(0)) break;
+
+    direction = residual + ((rho_next / rho) * (alpha / omega)) * (direction - omega * product);
+    rho = rho_next;
+  }
+  return tracker.Finish();
+}
+
+template<typename T>
+IterativeReport
+GMRES(const LinearOperator<T>& matrix, const DynamicVector<T>& rhs, DynamicVector<T>& solution,
+      const LinearOperator<std::type_identity_t<T>>* preconditioner, const IterativeSettings& settings)
+{
+  DEBUG_ASSERT(settings.Restart > 0, "The GMRES restart length must be positive.")
+
+  detail::PrepareSolve(matrix, rhs, solution, preconditioner);
+  detail::IterationTracker tracker(settings, detail::Norm(rhs));
+  auto& report = tracker.Report();
+
+  const size_t m = settings.Restart;
+  std::vector<DynamicVector<T>> basis(m + 1);
+  DynamicMatrix<T> hessenberg(m + 1, m);
+  std::vector<T> cosines(m), sines(m), projection(m + 1);
+  DynamicVector<T> residual, product, preconditioned;
+
+  matrix.Apply(solution, product);
+  ++report.nOperatorProducts;
+  residual = rhs - product;
+  Real residual_norm = detail::Norm(residual);
+  bool is_running = tracker.Start(residual_norm);
+
+  while(is_running)
+  {
+    basis[0] = (T(1) / static_cast<T>(residual_norm)) * residual;
+    std::fill(projection.begin(), projection.end(), T(0));
+    projection[0] = static_cast<T>(residual_norm);
+
+    // Arnoldi process with modified Gram-Schmidt orthogonalisation, reducing the Hessenberg matrix to triangular form with Givens rotations as it grows.
+    size_t n_columns = 0;
+    for(; n_columns < m && is_running; ++n_columns)
+    {
+      const size_t j = n_columns;
+      auto& w = product;
+      matrix.Apply(detail::Precondition(preconditioner, basis[j], preconditioned, report), w);
+      ++report.nOperatorProducts;
+
+      FOR(i, j + 1)
+      {
+        hessenberg(i, j) = InnerProduct(w, basis[i]);
+        w -= hessenberg(i, j) * basis[i];
+      }
+      const T w_norm = static_cast<T>(detail::Norm(w));
+      hessenberg(j + 1, j) = w_norm;
+      if(w_norm != T(0)) basis[j + 1] = (T(1) / w_norm) * w;
+
+      FOR(i, j)
+      {
+        const T h = cosines[i] * hessenberg(i, j) + sines[i] * hessenberg(i + 1, j);
+        hessenberg(i + 1, j) = cosines[i] * hessenberg(i + 1, j) - sines[i] * hessenberg(i, j);
+        hessenberg(i, j) = h;
+      }
+      const T radius = std::hypot(hessenberg(j, j), hessenberg(j + 1, j));
+      cosines[j] = radius != T(0) ? hessenberg(j, j) / radius : T(1);
+      sines[j] = radius != T(0) ? hessenberg(j + 1, j) / radius : T(0);
+      hessenberg(j, j) = radius;
+      hessenberg(j + 1, j) = T(0);
+      projection[j + 1] = -sines[j] * projection[j];
+      projection[j] *= cosines[j];
+
+      // An invariant subspace (w = 0) contains the exact solution.
+      is_running = tracker.Continue(Abs(static_cast<Real>(projection[j + 1]))) && w_norm != T(0);
+    }
+
+    // Minimise the residual over the Krylov subspace, and update the solution with the preconditioned combination of the basis vectors.
+    for(size_t i = n_columns; i-- > 0;)
+    {
+      FOR(k, i + 1, n_columns) projection[i] -= hessenberg(i, k) * projection[k];
+      projection[i] /= hessenberg(i, i);
+    }
+    product = projection[0] * basis[0];
+    FOR(i, 1, n_columns) product += projection[i] * basis[i];
+    solution += detail::Precondition(preconditioner, product, preconditioned, report);
+
+    if(is_running)
+    {
+      matrix.Apply(solution, product);
+      ++report.nOperatorProducts;
+      residual = rhs - product;
+      residual_norm = detail::Norm(residual);
+    }
+  }
+  return tracker.Finish();
+}
+
+}
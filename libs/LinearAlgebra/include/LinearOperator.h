@@ -0,0 +1,117 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "Matrix.h"
+#include "Vector.h"
+
+#include <functional>
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Linear Operator Abstract Base Class
+***************************************************************************************************************************************************************/
+
+/** Linear map y = Ax between dynamic vectors, which need not be stored as a matrix. Iterative solvers and preconditioners only access matrices through this
+    interface, so that sparse, dense and matrix-free operators are interchangeable. */
+template<typename T>
+class LinearOperator
+{
+public:
+  virtual ~LinearOperator() = default;
+
+  virtual size_t nRows() const = 0;
+
+  virtual size_t nColumns() const = 0;
+
+  /** Compute y = Ax, resizing y if required. x and y must not alias. */
+  virtual void Apply(const DynamicVector<T>& x, DynamicVector<T>& y) const = 0;
+};
+
+/***************************************************************************************************************************************************************
+* Linear Operator Classes
+***************************************************************************************************************************************************************/
+
+/** Operator of a dense or sparse matrix, which is referenced rather than copied. Sparse matrices are applied with their own (parallel) products. */
+template<class M>
+class MatrixOperator final : public LinearOperator<typename M::value_type>
+{
+  using T = typename M::value_type;
+
+public:
+  explicit MatrixOperator(const M& matrix)
+    : Matrix_(matrix) {}
+
+  size_t nRows() const override { return Matrix_.nRows(); }
+
+  size_t nColumns() const override { return Matrix_.nColumns(); }
+
+  void Apply(const DynamicVector<T>& x, DynamicVector<T>& y) const override
+  {
+    if constexpr(requires { Matrix_.Multiply(x, y); }) Matrix_.Multiply(x, y);
+    else Multiply(Matrix_, x, y);
+  }
+
+private:
+  const M& Matrix_;
+};
+
+/** Matrix-free operator, which is applied by a given function. */
+template<typename T>
+class FunctionOperator final : public LinearOperator<T>
+{
+public:
+  using Function = std::function<void(const DynamicVector<T>&, DynamicVector<T>&)>;
+
+  FunctionOperator(const size_t n_rows, const size_t n_columns, Function function)
+    : Function_(std::move(function)), nRows_(n_rows), nColumns_(n_columns) {}
+
+  size_t nRows() const override { return nRows_; }
+
+  size_t nColumns() const override { return nColumns_; }
+
+  void Apply(const DynamicVector<T>& x, DynamicVector<T>& y) const override
+  {
+    y.resize(nRows_);
+    Function_(x, y);
+  }
+
+private:
+  Function Function_;
+  size_t   nRows_;
+  size_t   nColumns_;
+};
+
+/** Identity operator of a given size, e.g. in place of a preconditioner. */
+template<typename T>
+class IdentityOperator final : public LinearOperator<T>
+{
+public:
+  explicit IdentityOperator(const size_t n)
+    : Size_(n) {}
+
+  size_t nRows() const override { return Size_; }
+
+  size_t nColumns() const override { return Size_; }
+
+  void Apply(const DynamicVector<T>& x, DynamicVector<T>& y) const override { y = x; }
+
+private:
+  size_t Size_;
+};
+
+}
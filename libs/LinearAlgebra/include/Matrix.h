@@ -17,23 +17,69 @@
 #include "../../../include/Global.h"
 #include "../../DataContainer/include/MultiArray.h"
 #include "../../DataContainer/include/NumericContainer.h"
+#include "GEMM.h"
+#include "Vector.h"
 
 namespace aprn {
 
+template<typename T, size_t M, size_t N> class StaticMatrix;
+template<typename T> class DynamicMatrix;
+
 /***************************************************************************************************************************************************************
 * Matrix Abstract Base Class
 ***************************************************************************************************************************************************************/
+
+/** Dense matrix, whose entries are stored in column-major order. Matrices support the entry-wise arithmetic of numeric containers, except that the product
+    of a matrix with a matrix or vector is the matrix product (see operator* below). */
 template<typename T, class D>
-class Matrix : detail::NumericContainer<T, Matrix<T, D>>
+class Matrix : public detail::NumericContainer<T, D>
 {
 protected:
   constexpr Matrix() = default;
 
-private:
+public:
+  using value_type = T;
+
+  /** Dimensions */
+  constexpr size_t
+  nRows() const { return Derived().Dimension(0); }
+
+  constexpr size_t
+  nColumns() const { return Derived().Dimension(1); }
+
+  constexpr size_t
+  size() const { return nRows() * nColumns(); }
+
+  constexpr bool
+  empty() const { return size() == 0; }
+
+  constexpr bool
+  isSquare() const { return nRows() == nColumns(); }
+
+  /** Entry access by storage (i.e. column-major) index. */
+  constexpr T&
+  operator[](const size_t index);
+
+  constexpr const T&
+  operator[](const size_t index) const;
+
+  /** The matrix (or its transpose) as a strided matrix multiplication operand. */
+  constexpr gemm::Operand<T>
+  Operand(const bool is_transposed = false) const
+  {
+    const gemm::Operand<T> operand{Derived().data(), 1, nRows()};
+    return is_transposed ? operand.Transpose() : operand;
+  }
+
+  /** Expression Assignment */
+  using detail::NumericContainer<T, D>::operator=;
+
   /** Derived Class Access */
-  constexpr D& Derived() noexcept { return static_cast<D&>(*this); }
+  constexpr D&
+  Derived() noexcept { return static_cast<D&>(*this); }
 
-  constexpr const D& Derived() const noexcept { return static_cast<const D&>(*this); }
+  constexpr const D&
+  Derived() const noexcept { return static_cast<const D&>(*this); }
 };
 
 /***************************************************************************************************************************************************************
@@ -44,24 +90,35 @@ class StaticMatrix final : public StaticMultiArray<T, M, N>,
                            public Matrix<T, StaticMatrix<T, M, N>>
 {
   using BaseMultiArray = StaticMultiArray<T, M, N>;
+  using BaseMatrix     = Matrix<T, StaticMatrix<T, M, N>>;
 
 public:
   /** Constructors */
   constexpr StaticMatrix()
     : BaseMultiArray() {}
 
-  explicit constexpr StaticMatrix(const T& value)
+  explicit constexpr StaticMatrix(const T value)
     : BaseMultiArray(value) {}
 
-  explicit constexpr StaticMatrix(const std::initializer_list<T>& list)
-    : BaseMultiArray(list) {}
+  /** Construction from a list of rows. */
+  constexpr StaticMatrix(const std::initializer_list<std::initializer_list<T>>& rows)
+    : BaseMultiArray() { MultiArray<T, BaseMultiArray>::operator=(rows); }
+
+  /** Construction from entries in column-major order. */
+  template<std::input_iterator It>
+  constexpr StaticMatrix(It first, It last);
 
-  template<class It>
-  constexpr StaticMatrix(const It first, const It last)
-    : BaseMultiArray(first, last) {}
+  static constexpr StaticMatrix
+  Identity();
 
-private:
-  friend Matrix<T, BaseMultiArray>;
+  /** Transposed copy of the matrix. */
+  constexpr StaticMatrix<T, N, M>
+  Transpose() const;
+
+  /** Operators */
+  using MultiArray<T, BaseMultiArray>::operator=;
+  using BaseMatrix::operator=;
+  using BaseMatrix::operator[];
 };
 
 /***************************************************************************************************************************************************************
@@ -72,27 +129,105 @@ class DynamicMatrix final : public DynamicMultiArray<T>,
                             public Matrix<T, DynamicMatrix<T>>
 {
   using BaseMultiArray = DynamicMultiArray<T>;
+  using BaseMatrix     = Matrix<T, DynamicMatrix<T>>;
 
 public:
   /** Constructors */
   DynamicMatrix()
-    : BaseMultiArray() {}
+    : BaseMultiArray(0, 0) {}
 
-  explicit DynamicMatrix(const size_t size)
-    : BaseMultiArray(size) {}
+  DynamicMatrix(const size_t n_rows, const size_t n_columns)
+    : BaseMultiArray(n_rows, n_columns) {}
 
-  DynamicMatrix(const size_t size, const T& value)
-    : BaseMultiArray(size, value) {}
+  DynamicMatrix(const size_t n_rows, const size_t n_columns, const T value);
 
-  explicit DynamicMatrix(const std::initializer_list<T>& list)
-    : BaseMultiArray(list) {}
+  /** Construction from a list of rows. */
+  DynamicMatrix(const std::initializer_list<std::initializer_list<T>>& rows);
 
-  template<class It>
-  DynamicMatrix(const It first, const It last)
-    : BaseMultiArray(first, last) {}
+  static DynamicMatrix
+  Identity(const size_t n);
 
-private:
-  friend Matrix<T, BaseMultiArray>;
+  /** Transposed copy of the matrix. */
+  DynamicMatrix
+  Transpose() const;
+
+  /** Matrix resize. Entries are not preserved. */
+  void
+  Resize(const size_t n_rows, const size_t n_columns) { BaseMultiArray::Resize(n_rows, n_columns); }
+
+  /** Resize to the dimensions of another matrix. */
+  template<class D>
+  void
+  Reshape(const Matrix<T, D>& matrix) { Resize(matrix.nRows(), matrix.nColumns()); }
+
+  /** Operators */
+  using MultiArray<T, BaseMultiArray>::operator=;
+  using BaseMatrix::operator=;
+  using BaseMatrix::operator[];
 };
 
+/***************************************************************************************************************************************************************
+* Matrix Aliases
+***************************************************************************************************************************************************************/
+template<typename T, size_t M, size_t N = M> using SMatrix = StaticMatrix<T, M, N>;
+
+template<size_t M, size_t N = M> using SMatrixR = SMatrix<Real, M, N>;
+using SMatrixR2 = SMatrixR<2>;
+using SMatrixR3 = SMatrixR<3>;
+using SMatrixR4 = SMatrixR<4>;
+
+template<size_t M, size_t N = M> using SMatrixF = SMatrix<float, M, N>;
+using SMatrixF2 = SMatrixF<2>;
+using SMatrixF3 = SMatrixF<3>;
+using SMatrixF4 = SMatrixF<4>;
+
+template<typename T> using DMatrix = DynamicMatrix<T>;
+
+using DMatrixR = DMatrix<Real>;
+using DMatrixF = DMatrix<float>;
+
+/***************************************************************************************************************************************************************
+* Matrix Products
+***************************************************************************************************************************************************************/
+namespace detail {
+
+/** Deduce the derived class of a matrix/vector from a pointer to it (unevaluated contexts only). */
+template<typename T, class D>
+D* DerivedMatrixPtr(const Matrix<T, D>*);
+
+template<typename T, class D>
+D* DerivedVectorPtr(const Vector<T, D>*);
+
+template<class X>
+concept MatrixType = requires(const RemoveConstRef<X>* x) { DerivedMatrixPtr(x); };
+
+template<class X>
+concept VectorType = requires(const RemoveConstRef<X>* x) { DerivedVectorPtr(x); };
+
+/** Operands whose product is a matrix product rather than an entry-wise product, which include matrix/vector-valued expressions. */
+template<class L, class R>
+concept MatrixProductOperands = MatrixType<OperandResult<L>> && (MatrixType<OperandResult<R>> || VectorType<OperandResult<R>>);
+
+/** Maximum number of multiply-adds for which products of static matrices/vectors are fully unrolled. */
+constexpr size_t MaxUnrolledProduct = 64;
+
+}//detail
+
+/** Matrix-matrix product, computed into a given matrix (which dynamic matrices are resized to). */
+template<typename T, class D0, class D1, class D2>
+constexpr void
+Multiply(const Matrix<T, D0>& matrix0, const Matrix<T, D1>& matrix1, Matrix<T, D2>& product);
+
+/** Matrix-vector product, computed into a given vector (which dynamic vectors are resized to). */
+template<typename T, class D0, class D1, class D2>
+constexpr void
+Multiply(const Matrix<T, D0>& matrix, const Vector<T, D1>& vector, Vector<T, D2>& product);
+
+/** Matrix-matrix and matrix-vector products. Products of static operands are static, and are fully unrolled for small sizes; other products are dynamic,
+    and are computed with the cache-blocked matrix multiplication kernels (see GEMM.h). Expression operands are first evaluated into their result types. */
+template<class L, class R> requires detail::NumericOperands<L, R> && detail::MatrixProductOperands<L, R>
+constexpr auto operator*(L&& lhs, R&& rhs);
+
 }
+
+#include "Matrix.tpp"
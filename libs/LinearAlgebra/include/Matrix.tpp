@@ -0,0 +1,228 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+namespace aprn {
+namespace detail {
+
+/** Dimensions of static matrices/vectors (vectors being single columns), which are zero for dynamic matrices/vectors. */
+template<class X>
+struct StaticShape
+{
+  static constexpr bool   isStatic = false;
+  static constexpr size_t Rows     = 0;
+  static constexpr size_t Columns  = 0;
+};
+
+template<typename T, size_t M, size_t N>
+struct StaticShape<StaticMatrix<T, M, N>>
+{
+  static constexpr bool   isStatic = true;
+  static constexpr size_t Rows     = M;
+  static constexpr size_t Columns  = N;
+};
+
+template<typename T, size_t N>
+struct StaticShape<StaticVector<T, N>>
+{
+  static constexpr bool   isStatic = true;
+  static constexpr size_t Rows     = N;
+  static constexpr size_t Columns  = 1;
+};
+
+/** Operand of a matrix product, of which expressions are evaluated (as the product kernels require contiguous entries). */
+template<class X>
+constexpr decltype(auto)
+ProductOperand(const X& operand)
+{
+  if constexpr(NumericExpressionType<X>) return operand.Evaluate();
+  else return (operand);
+}
+
+/** Transpose the entries of a column-major m x n matrix, in square blocks so that both matrices are accessed cache-efficiently. */
+template<typename T>
+constexpr void
+TransposeEntries(const T* entries, const size_t m, const size_t n, T* transpose)
+{
+  constexpr size_t block_size = 32;
+  for(size_t j0 = 0; j0 < n; j0 += block_size)
+    for(size_t i0 = 0; i0 < m; i0 += block_size)
+      FOR(j, j0, Min(j0 + block_size, n)) FOR(i, i0, Min(i0 + block_size, m)) transpose[j + i * n] = entries[i + j * m];
+}
+
+/** Fully unrolled product of column-major M x K and K x N matrices. */
+template<size_t M, size_t K, size_t N, typename T>
+constexpr void
+UnrolledMultiply(const T* a, const T* b, T* c)
+{
+  const auto entry = [&]<size_t... p>(const size_t i, const size_t j, std::index_sequence<p...>) { return ((a[i + p * M] * b[p + j * K]) + ...); };
+  [&]<size_t... ij>(std::index_sequence<ij...>) { ((c[ij] = entry(ij % M, ij / M, std::make_index_sequence<K>())), ...); }(std::make_index_sequence<M * N>());
+}
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* Matrix Abstract Base Class
+***************************************************************************************************************************************************************/
+template<typename T, class D>
+constexpr T&
+Matrix<T, D>::operator[](const size_t index)
+{
+  DEBUG_ASSERT(index < size(), "The matrix index ", index, " must be lesser than the matrix size ", size(), ".")
+  return Derived().data()[index];
+}
+
+template<typename T, class D>
+constexpr const T&
+Matrix<T, D>::operator[](const size_t index) const
+{
+  DEBUG_ASSERT(index < size(), "The matrix index ", index, " must be lesser than the matrix size ", size(), ".")
+  return Derived().data()[index];
+}
+
+/***************************************************************************************************************************************************************
+* Static Matrix Class
+***************************************************************************************************************************************************************/
+template<typename T, size_t M, size_t N>
+template<std::input_iterator It>
+constexpr StaticMatrix<T, M, N>::StaticMatrix(It first, It last)
+  : BaseMultiArray()
+{
+  size_t index = 0;
+  for(; first != last; ++first) (*this)[index++] = *first;
+  DEBUG_ASSERT(index == M * N, "The number of entries ", index, " must equal the matrix size ", M * N, ".")
+}
+
+template<typename T, size_t M, size_t N>
+constexpr StaticMatrix<T, M, N>
+StaticMatrix<T, M, N>::Identity()
+{
+  StaticMatrix identity(T(0));
+  FOR(i, Min(M, N)) identity(i, i) = T(1);
+  return identity;
+}
+
+template<typename T, size_t M, size_t N>
+constexpr StaticMatrix<T, N, M>
+StaticMatrix<T, M, N>::Transpose() const
+{
+  StaticMatrix<T, N, M> transpose;
+  detail::TransposeEntries(this->data(), M, N, transpose.data());
+  return transpose;
+}
+
+/***************************************************************************************************************************************************************
+* Dynamic Matrix Class
+***************************************************************************************************************************************************************/
+template<typename T>
+DynamicMatrix<T>::DynamicMatrix(const size_t n_rows, const size_t n_columns, const T value)
+  : BaseMultiArray(n_rows, n_columns) { std::fill(this->begin(), this->end(), value); }
+
+template<typename T>
+DynamicMatrix<T>::DynamicMatrix(const std::initializer_list<std::initializer_list<T>>& rows)
+  : BaseMultiArray(rows.size(), rows.size() ? rows.begin()->size() : 0) { MultiArray<T, BaseMultiArray>::operator=(rows); }
+
+template<typename T>
+DynamicMatrix<T>
+DynamicMatrix<T>::Identity(const size_t n)
+{
+  DynamicMatrix identity(n, n, T(0));
+  FOR(i, n) identity(i, i) = T(1);
+  return identity;
+}
+
+template<typename T>
+DynamicMatrix<T>
+DynamicMatrix<T>::Transpose() const
+{
+  DynamicMatrix transpose(this->nColumns(), this->nRows());
+  detail::TransposeEntries(this->data(), this->nRows(), this->nColumns(), transpose.data());
+  return transpose;
+}
+
+/***************************************************************************************************************************************************************
+* Matrix Products
+***************************************************************************************************************************************************************/
+template<typename T, class D0, class D1, class D2>
+constexpr void
+Multiply(const Matrix<T, D0>& matrix0, const Matrix<T, D1>& matrix1, Matrix<T, D2>& product)
+{
+  using S0 = detail::StaticShape<D0>;
+  using S1 = detail::StaticShape<D1>;
+
+  const auto& a = matrix0.Derived();
+  const auto& b = matrix1.Derived();
+  auto& c = product.Derived();
+
+  if constexpr(S0::isStatic && S1::isStatic) static_assert(S0::Columns == S1::Rows, "The inner dimensions of a matrix product must be equal.");
+  DEBUG_ASSERT(a.nColumns() == b.nRows(), "The inner dimensions ", a.nColumns(), " and ", b.nRows(), " of the matrix product must be equal.")
+
+  if constexpr(detail::StaticShape<D2>::isStatic)
+  {
+    DEBUG_ASSERT(c.nRows() == a.nRows() && c.nColumns() == b.nColumns(), "The product matrix must be of size ", a.nRows(), " x ", b.nColumns(), ".")
+  }
+  else c.Resize(a.nRows(), b.nColumns());
+  DEBUG_ASSERT(c.data() != a.data() && c.data() != b.data(), "Matrix products cannot be computed in-place.")
+
+  if constexpr(S0::isStatic && S1::isStatic && S0::Rows * S0::Columns * S1::Columns <= detail::MaxUnrolledProduct)
+    detail::UnrolledMultiply<S0::Rows, S0::Columns, S1::Columns>(a.data(), b.data(), c.data());
+  else gemm::Multiply(a.nRows(), b.nColumns(), a.nColumns(), a.Operand(), b.Operand(), c.data(), a.nRows());
+}
+
+template<typename T, class D0, class D1, class D2>
+constexpr void
+Multiply(const Matrix<T, D0>& matrix, const Vector<T, D1>& vector, Vector<T, D2>& product)
+{
+  using S0 = detail::StaticShape<D0>;
+  using S1 = detail::StaticShape<D1>;
+
+  const auto& a = matrix.Derived();
+  const auto& x = vector.Derived();
+  auto& y = product.Derived();
+
+  if constexpr(S0::isStatic && S1::isStatic) static_assert(S0::Columns == S1::Rows, "The matrix and vector sizes of a matrix-vector product must agree.");
+  DEBUG_ASSERT(a.nColumns() == x.size(), "The number of matrix columns ", a.nColumns(), " must equal the vector size ", x.size(), ".")
+
+  if constexpr(detail::StaticShape<D2>::isStatic) { DEBUG_ASSERT(y.size() == a.nRows(), "The product vector must be of size ", a.nRows(), ".") }
+  else y.resize(a.nRows());
+  DEBUG_ASSERT(y.data() != x.data(), "Matrix-vector products cannot be computed in-place.")
+
+  if constexpr(S0::isStatic && S1::isStatic && S0::Rows * S0::Columns <= detail::MaxUnrolledProduct)
+    detail::UnrolledMultiply<S0::Rows, S0::Columns, 1>(a.data(), x.data(), y.data());
+  else gemm::MultiplyVector(a.nRows(), a.nColumns(), a.Operand(), x.data(), y.data());
+}
+
+template<class L, class R> requires detail::NumericOperands<L, R> && detail::MatrixProductOperands<L, R>
+constexpr auto
+operator*(L&& lhs, R&& rhs)
+{
+  using T  = detail::OperandValue<L>;
+  using S0 = detail::StaticShape<detail::OperandResult<L>>;
+  using S1 = detail::StaticShape<detail::OperandResult<R>>;
+
+  const auto product = [&](auto&& result) { Multiply(detail::ProductOperand(lhs), detail::ProductOperand(rhs), result); return result; };
+  if constexpr(detail::MatrixType<detail::OperandResult<R>>)
+  {
+    if constexpr(S0::isStatic && S1::isStatic) return product(StaticMatrix<T, S0::Rows, S1::Columns>());
+    else return product(DynamicMatrix<T>());
+  }
+  else
+  {
+    if constexpr(S0::isStatic && S1::isStatic) return product(StaticVector<T, S0::Rows>());
+    else return product(DynamicVector<T>());
+  }
+}
+
+}
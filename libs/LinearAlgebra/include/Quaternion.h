@@ -0,0 +1,198 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "Matrix.h"
+#include "Vector.h"
+
+#include <algorithm>
+#include <utility>
+
+/***************************************************************************************************************************************************************
+* Quaternions
+*
+* A unit quaternion q = (cos(θ/2), sin(θ/2) n) represents the rotation by an angle θ about a unit axis n, which acts on vectors as v -> q v q*. Rotations
+* compose by quaternion products, which take 16 multiplications rather than the 27 of 3 x 3 matrix products, drift from unit length far more benignly than
+* matrices drift from orthogonality, and interpolate with constant angular velocity (slerp).
+***************************************************************************************************************************************************************/
+
+namespace aprn {
+
+class Quaternion
+{
+ public:
+   /** Constructors. The default quaternion is the identity rotation. */
+   constexpr Quaternion() = default;
+
+   constexpr Quaternion(const Real w, const Real x, const Real y, const Real z)
+     : Scalar_(w), Vector_{x, y, z} {}
+
+   constexpr Quaternion(const Real scalar, const SVectorR3& vector)
+     : Scalar_(scalar), Vector_(vector) {}
+
+   /** Unit quaternion of the rotation by an angle about an axis, which need not be normalised. */
+   static Quaternion
+   AxisAngle(const SVectorR3& axis, const Real angle)
+   {
+      const Real axis_magnitude = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+      ASSERT(axis_magnitude > Zero, "Cannot rotate about an axis of zero magnitude.")
+
+      const Real scale = std::sin(Half * angle) / axis_magnitude;
+      return {std::cos(Half * angle), scale * axis[0], scale * axis[1], scale * axis[2]};
+   }
+
+   /** Component Access */
+   constexpr Real w() const { return Scalar_; }
+   constexpr Real x() const { return Vector_[0]; }
+   constexpr Real y() const { return Vector_[1]; }
+   constexpr Real z() const { return Vector_[2]; }
+
+   constexpr Real Scalar() const { return Scalar_; }
+
+   constexpr const SVectorR3& Vector() const { return Vector_; }
+
+   /** Rotation axis (a unit vector) and angle in [0, 2π) of a unit quaternion. The axis of the identity rotation is taken to be the x-axis. */
+   std::pair<SVectorR3, Real>
+   ToAxisAngle() const
+   {
+      const Real w = std::clamp(Scalar_, -One, One);
+      const Real sine = std::sqrt(One - w * w);
+      if(sine < ZeroTolerance) return {xAxis3, Zero};
+      return {SVectorR3{x() / sine, y() / sine, z() / sine}, Two * std::acos(w)};
+   }
+
+   /** Rotation matrix of a unit quaternion. */
+   constexpr SMatrixR3
+   RotationMatrix() const
+   {
+      const Real w2 = Scalar_ * Scalar_, x2 = x() * x(), y2 = y() * y(), z2 = z() * z();
+      const Real wx = Scalar_ * x(), wy = Scalar_ * y(), wz = Scalar_ * z(), xy = x() * y(), xz = x() * z(), yz = y() * z();
+      return {{w2 + x2 - y2 - z2, Two * (xy - wz),      Two * (xz + wy)},
+              {Two * (xy + wz),      w2 - x2 + y2 - z2, Two * (yz - wx)},
+              {Two * (xz - wy),      Two * (yz + wx),      w2 - x2 - y2 + z2}};
+   }
+
+   /** Rotate a vector by a unit quaternion, via v + 2w (u x v) + 2u x (u x v), where u is the vector part, which avoids forming q v q* in full. */
+   constexpr SVectorR3
+   Rotate(const SVectorR3& vector) const
+   {
+      const Real tx = Two * (y() * vector[2] - z() * vector[1]);
+      const Real ty = Two * (z() * vector[0] - x() * vector[2]);
+      const Real tz = Two * (x() * vector[1] - y() * vector[0]);
+      return {vector[0] + Scalar_ * tx + y() * tz - z() * ty,
+              vector[1] + Scalar_ * ty + z() * tx - x() * tz,
+              vector[2] + Scalar_ * tz + x() * ty - y() * tx};
+   }
+
+   /** Operators */
+   constexpr Quaternion
+   operator-() const { return {-Scalar_, -x(), -y(), -z()}; }
+
+   constexpr Quaternion&
+   operator+=(const Quaternion& other)
+   {
+      Scalar_ += other.Scalar_;
+      FOR(i, 3) Vector_[i] += other.Vector_[i];
+      return *this;
+   }
+
+   constexpr Quaternion&
+   operator-=(const Quaternion& other) { return *this += -other; }
+
+   constexpr Quaternion&
+   operator*=(const Real scalar)
+   {
+      Scalar_ *= scalar;
+      FOR(i, 3) Vector_[i] *= scalar;
+      return *this;
+   }
+
+   constexpr Quaternion&
+   operator/=(const Real scalar) { return *this *= One / scalar; }
+
+   /** Hamilton product, i.e. the composition of the rotation of the other quaternion followed by that of this quaternion. */
+   constexpr Quaternion&
+   operator*=(const Quaternion& other) { return *this = *this * other; }
+
+   friend constexpr Quaternion
+   operator*(const Quaternion& q0, const Quaternion& q1)
+   {
+      return {q0.w() * q1.w() - q0.x() * q1.x() - q0.y() * q1.y() - q0.z() * q1.z(),
+              q0.w() * q1.x() + q0.x() * q1.w() + q0.y() * q1.z() - q0.z() * q1.y(),
+              q0.w() * q1.y() - q0.x() * q1.z() + q0.y() * q1.w() + q0.z() * q1.x(),
+              q0.w() * q1.z() + q0.x() * q1.y() - q0.y() * q1.x() + q0.z() * q1.w()};
+   }
+
+   friend constexpr Quaternion operator+(Quaternion q0, const Quaternion& q1) { return q0 += q1; }
+
+   friend constexpr Quaternion operator-(Quaternion q0, const Quaternion& q1) { return q0 -= q1; }
+
+   friend constexpr Quaternion operator*(Quaternion q, const Real scalar) { return q *= scalar; }
+
+   friend constexpr Quaternion operator*(const Real scalar, Quaternion q) { return q *= scalar; }
+
+   friend constexpr Quaternion operator/(Quaternion q, const Real scalar) { return q /= scalar; }
+
+   friend constexpr bool
+   operator==(const Quaternion& q0, const Quaternion& q1) { return q0.Scalar_ == q1.Scalar_ && q0.Vector_ == q1.Vector_; }
+
+ private:
+   Real      Scalar_{One};
+   SVectorR3 Vector_{Zero, Zero, Zero};
+};
+
+/***************************************************************************************************************************************************************
+* Quaternion Operations
+***************************************************************************************************************************************************************/
+constexpr Quaternion
+Conjugate(const Quaternion& q) { return {q.w(), -q.x(), -q.y(), -q.z()}; }
+
+constexpr Real
+InnerProduct(const Quaternion& q0, const Quaternion& q1) { return q0.w() * q1.w() + q0.x() * q1.x() + q0.y() * q1.y() + q0.z() * q1.z(); }
+
+inline Real
+Magnitude(const Quaternion& q) { return std::sqrt(InnerProduct(q, q)); }
+
+inline bool
+isNormalised(const Quaternion& q) { return isEqual(Magnitude(q), One); }
+
+inline Quaternion
+Normalise(const Quaternion& q)
+{
+   const auto magn = Magnitude(q);
+   return !isEqual(magn, Zero) ? q / magn : throw std::invalid_argument("Cannot normalise a quaternion of zero magnitude.");
+}
+
+/** Inverse of a quaternion, which is its conjugate if it is a unit quaternion. */
+constexpr Quaternion
+Inverse(const Quaternion& q) { return Conjugate(q) / InnerProduct(q, q); }
+
+/** Spherical linear interpolation between two unit quaternions, i.e. the rotation at a fraction t of the way from q0 to q1 at constant angular velocity,
+    along the shorter arc. Nearly parallel quaternions are interpolated linearly (and renormalised), which avoids dividing by a vanishing sine. */
+inline Quaternion
+Slerp(const Quaternion& q0, const Quaternion& q1, const Real t)
+{
+   const Real cosine = InnerProduct(q0, q1);
+   const Quaternion q_end = cosine < Zero ? -q1 : q1;
+   const Real abs_cosine = Abs(cosine);
+   if(abs_cosine > One - 1.0e-6) return Normalise((One - t) * q0 + t * q_end);
+
+   const Real angle = std::acos(abs_cosine);
+   const Real sine = std::sin(angle);
+   return (std::sin((One - t) * angle) / sine) * q0 + (std::sin(t * angle) / sine) * q_end;
+}
+
+}
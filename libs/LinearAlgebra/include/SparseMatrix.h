@@ -0,0 +1,235 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "../../DataContainer/include/Array.h"
+#include "../../DataContainer/include/Parallel.h"
+#include "../../DataContainer/include/SoAArray.h"
+#include "Matrix.h"
+#include "Vector.h"
+
+#include <omp.h>
+#include <span>
+
+/***************************************************************************************************************************************************************
+* Sparse Matrices
+*
+* Matrices are assembled in coordinate (COO) format, i.e. as an unordered list of (row, column, value) triplets, and converted to one of the compressed
+* formats for computation: compressed sparse rows (CSR) or columns (CSC), or block compressed sparse rows (BSR), which stores small dense B x B blocks rather
+* than single entries. Conversion from COO is parallel and deterministic: duplicate triplets are summed in the order in which they were appended.
+*
+* Sparse matrix-vector products are distributed over threads by ranges of rows with equal numbers of entries. CSR products are row-wise dot products with
+* several independent accumulators, and BSR products are fixed-size dense block products, which the compiler vectorises; BSR is hence preferred for
+* systems with several unknowns per node. CSC products scatter column-wise, which is inherently less parallel; CSC is instead efficient for products with
+* the transpose.
+***************************************************************************************************************************************************************/
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Coordinate Matrix Class
+***************************************************************************************************************************************************************/
+template<typename T>
+class CooMatrix
+{
+public:
+  CooMatrix() = default;
+
+  CooMatrix(const size_t n_rows, const size_t n_columns)
+    : nRows_(n_rows), nColumns_(n_columns) {}
+
+  /** Dimensions */
+  size_t
+  nRows() const { return nRows_; }
+
+  size_t
+  nColumns() const { return nColumns_; }
+
+  size_t
+  nEntries() const { return Entries_.size(); }
+
+  /** Append an entry, which is added to any other entries at the same position. */
+  void
+  Append(const size_t row, const size_t column, const T value)
+  {
+    DEBUG_ASSERT(row < nRows_ && column < nColumns_, "The entry (", row, ", ", column, ") lies outside the ", nRows_, " x ", nColumns_, " matrix.")
+    Entries_.Append(row, column, value);
+  }
+
+  void
+  Reserve(const size_t n_entries) { Entries_.Reserve(n_entries); }
+
+  void
+  clear() noexcept { Entries_.clear(); }
+
+  /** Triplet Access */
+  std::span<const size_t>
+  Rows() const { return Entries_.template Field<0>(); }
+
+  std::span<const size_t>
+  Columns() const { return Entries_.template Field<1>(); }
+
+  std::span<const T>
+  Values() const { return Entries_.template Field<2>(); }
+
+private:
+  SoAArray<size_t, size_t, T> Entries_;
+  size_t                      nRows_{0};
+  size_t                      nColumns_{0};
+};
+
+/***************************************************************************************************************************************************************
+* Compressed Sparse Row/Column Matrix Class
+***************************************************************************************************************************************************************/
+
+/** Sparse matrix which is compressed along its rows (CSR) or columns (CSC). The indices of the entries of each row (or column) are sorted, and start at the
+    corresponding offset. */
+template<typename T, bool is_row_compressed>
+class CompressedMatrix
+{
+public:
+  using value_type = T;
+
+  CompressedMatrix() = default;
+
+  explicit CompressedMatrix(const CooMatrix<T>& matrix);
+
+  /** Construction from compressed arrays, which must be sorted and free of duplicates. */
+  CompressedMatrix(const size_t n_rows, const size_t n_columns, DynamicArray<size_t>&& offsets, DynamicArray<size_t>&& indices, AlignedArray<T>&& values);
+
+  /** Dimensions */
+  size_t
+  nRows() const { return nRows_; }
+
+  size_t
+  nColumns() const { return nColumns_; }
+
+  size_t
+  nEntries() const { return Values_.size(); }
+
+  /** Entry (i, j), which is zero if it is not stored. */
+  T
+  operator()(const size_t i, const size_t j) const;
+
+  /** Compute y = Ax, or y += Ax if accumulating. */
+  template<class A0, class A1>
+  void
+  Multiply(const DynamicVector<T, A0>& x, DynamicVector<T, A1>& y, const bool accumulate = false) const;
+
+  /** Compute y = A^T x, or y += A^T x if accumulating. */
+  template<class A0, class A1>
+  void
+  MultiplyTranspose(const DynamicVector<T, A0>& x, DynamicVector<T, A1>& y, const bool accumulate = false) const;
+
+  DynamicMatrix<T>
+  Dense() const;
+
+  /** Compressed Array Access. Values can be modified, e.g. to reassemble a matrix with the same sparsity pattern. */
+  const DynamicArray<size_t>&
+  Offsets() const { return Offsets_; }
+
+  const DynamicArray<size_t>&
+  Indices() const { return Indices_; }
+
+  const AlignedArray<T>&
+  Values() const { return Values_; }
+
+  AlignedArray<T>&
+  Values() { return Values_; }
+
+private:
+  DynamicArray<size_t> Offsets_{size_t(0)};
+  DynamicArray<size_t> Indices_;
+  AlignedArray<T>      Values_;
+  size_t               nRows_{0};
+  size_t               nColumns_{0};
+};
+
+template<typename T> using CsrMatrix = CompressedMatrix<T, true>;
+template<typename T> using CscMatrix = CompressedMatrix<T, false>;
+
+/***************************************************************************************************************************************************************
+* Block Compressed Sparse Row Matrix Class
+***************************************************************************************************************************************************************/
+
+/** Sparse matrix of dense B x B blocks (stored column-major), compressed along its block rows. The matrix dimensions must be multiples of B. */
+template<typename T, size_t B>
+class BsrMatrix
+{
+  static_assert(B > 0, "The block size must be positive.");
+
+public:
+  using value_type = T;
+
+  static constexpr size_t BlockSize{B};
+
+  BsrMatrix() = default;
+
+  explicit BsrMatrix(const CooMatrix<T>& matrix);
+
+  /** Dimensions */
+  size_t
+  nRows() const { return nBlockRows_ * B; }
+
+  size_t
+  nColumns() const { return nBlockColumns_ * B; }
+
+  size_t
+  nBlocks() const { return Indices_.size(); }
+
+  /** Compute y = Ax, or y += Ax if accumulating. */
+  template<class A0, class A1>
+  void
+  Multiply(const DynamicVector<T, A0>& x, DynamicVector<T, A1>& y, const bool accumulate = false) const;
+
+  DynamicMatrix<T>
+  Dense() const;
+
+  /** Compressed Array Access, where the block of index k has entries [k * B * B, (k + 1) * B * B). */
+  const DynamicArray<size_t>&
+  Offsets() const { return Offsets_; }
+
+  const DynamicArray<size_t>&
+  Indices() const { return Indices_; }
+
+  const AlignedArray<T>&
+  Values() const { return Values_; }
+
+  AlignedArray<T>&
+  Values() { return Values_; }
+
+private:
+  DynamicArray<size_t> Offsets_{size_t(0)};
+  DynamicArray<size_t> Indices_;
+  AlignedArray<T>      Values_;
+  size_t               nBlockRows_{0};
+  size_t               nBlockColumns_{0};
+};
+
+/***************************************************************************************************************************************************************
+* Sparse Matrix-vector Products
+***************************************************************************************************************************************************************/
+template<typename T, bool is_row_compressed, class A>
+DynamicVector<T>
+operator*(const CompressedMatrix<T, is_row_compressed>& matrix, const DynamicVector<T, A>& vector);
+
+template<typename T, size_t B, class A>
+DynamicVector<T>
+operator*(const BsrMatrix<T, B>& matrix, const DynamicVector<T, A>& vector);
+
+}
+
+#include "SparseMatrix.tpp"
@@ -0,0 +1,312 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+namespace aprn {
+namespace detail {
+
+/** Replace counts with their exclusive prefix sums, returning the total. */
+inline size_t
+ExclusiveScan(size_t* counts, const size_t n)
+{
+  size_t total = 0;
+  FOR(i, n) total += std::exchange(counts[i], total);
+  return total;
+}
+
+/** Compress the entries of a COO matrix into B x B blocks along its rows (or, for unit blocks, its columns). For each major (row/column) block index, the
+    sorted minor block indices are stored from the major block's offset, and the values of each block from its index times B^2, column-major within each
+    block. Duplicate entries are summed in their order of appending. */
+template<size_t B, typename T>
+void
+Compress(const CooMatrix<T>& matrix, const bool is_row_compressed, DynamicArray<size_t>& offsets, DynamicArray<size_t>& indices, AlignedArray<T>& values)
+{
+  const size_t n_entries = matrix.nEntries();
+  const size_t n_major = (is_row_compressed ? matrix.nRows() : matrix.nColumns()) / B;
+  const size_t* majors = is_row_compressed ? matrix.Rows().data() : matrix.Columns().data();
+  const size_t* minors = is_row_compressed ? matrix.Columns().data() : matrix.Rows().data();
+  const T* entry_values = matrix.Values().data();
+  const bool is_parallel = parallel::isParallel(n_entries);
+
+  // Bucket the entries by their major block index.
+  DynamicArray<size_t> entry_offsets;
+  entry_offsets.assign(n_major + 1, 0);
+  size_t* counts = entry_offsets.data();
+  #pragma omp parallel for schedule(static) if(is_parallel)
+  for(size_t p = 0; p < n_entries; ++p)
+  {
+    #pragma omp atomic
+    ++counts[majors[p] / B];
+  }
+  ExclusiveScan(counts, n_major + 1);
+
+  DynamicArray<size_t> order;
+  order.resize(n_entries);
+  DynamicArray<size_t> cursors(entry_offsets.begin(), entry_offsets.end() - 1);
+  size_t* cursor_data = cursors.data();
+  #pragma omp parallel for schedule(static) if(is_parallel)
+  for(size_t p = 0; p < n_entries; ++p)
+  {
+    size_t position;
+    #pragma omp atomic capture
+    position = cursor_data[majors[p] / B]++;
+    order[position] = p;
+  }
+
+  // Sort each bucket by minor block index and then by order of appending (restoring the order lost to the atomic bucketing), and count its blocks.
+  offsets.assign(n_major + 1, 0);
+  #pragma omp parallel for schedule(dynamic, 256) if(is_parallel)
+  for(size_t major = 0; major < n_major; ++major)
+  {
+    const auto first = order.begin() + entry_offsets[major];
+    const auto last = order.begin() + entry_offsets[major + 1];
+    std::sort(first, last, [&](const size_t p, const size_t q) { return std::make_pair(minors[p] / B, p) < std::make_pair(minors[q] / B, q); });
+    for(auto it = first; it != last; ++it) offsets[major] += it == first || minors[*it] / B != minors[*(it - 1)] / B;
+  }
+  const size_t n_blocks = ExclusiveScan(offsets.data(), n_major + 1);
+
+  // Sum the entries into their blocks.
+  indices.resize(n_blocks);
+  values.assign(n_blocks * B * B, T(0));
+  #pragma omp parallel for schedule(dynamic, 256) if(is_parallel)
+  for(size_t major = 0; major < n_major; ++major)
+  {
+    size_t block = offsets[major] - 1;
+    FOR(position, entry_offsets[major], entry_offsets[major + 1])
+    {
+      const size_t p = order[position];
+      if(position == entry_offsets[major] || minors[p] / B != indices[block]) indices[++block] = minors[p] / B;
+      values[block * B * B + majors[p] % B + minors[p] % B * B] += entry_values[p];
+    }
+  }
+}
+
+/** Apply a function to ranges [first, last) of the major indices of a compressed matrix, distributed over threads so that each range has about the same
+    number of entries. */
+template<class F>
+void
+ForEachBalancedRange(const DynamicArray<size_t>& offsets, const size_t n_entries, F&& range_function)
+{
+  const size_t n_major = offsets.size() - 1;
+
+  #pragma omp parallel if(parallel::isParallel(n_entries))
+  {
+    const size_t n_threads = omp_get_num_threads();
+    const size_t thread = omp_get_thread_num();
+    const auto range_start = [&](const size_t t)
+    {
+      if(t == n_threads) return n_major;
+      return Min(static_cast<size_t>(std::lower_bound(offsets.begin(), offsets.end(), t * n_entries / n_threads) - offsets.begin()), n_major);
+    };
+    range_function(range_start(thread), range_start(thread + 1));
+  }
+}
+
+/** Sparse dot product of the entries [first, last) with a dense vector, with independent accumulators so that consecutive products are pipelined. */
+template<typename T>
+inline T
+SparseDot(const T* values, const size_t* indices, const T* x, const size_t first, const size_t last)
+{
+  T sums[4]{};
+  size_t k = first;
+  for(; k + 4 <= last; k += 4) FOR(l, 4) sums[l] += values[k + l] * x[indices[k + l]];
+  for(; k < last; ++k) sums[0] += values[k] * x[indices[k]];
+  return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
+/** Products y = Ax of matrices compressed along the rows of A (gather), or along its columns (scatter). Scattered products are accumulated in a separate
+    vector per thread, which are then summed. */
+template<typename T>
+void
+GatherProduct(const DynamicArray<size_t>& offsets, const size_t* indices, const T* values, const T* x, T* y, const bool accumulate)
+{
+  ForEachBalancedRange(offsets, offsets.back(), [&](const size_t first, const size_t last)
+  {
+    FOR(i, first, last) y[i] = (accumulate ? y[i] : T(0)) + SparseDot(values, indices, x, offsets[i], offsets[i + 1]);
+  });
+}
+
+template<typename T>
+void
+ScatterProduct(const DynamicArray<size_t>& offsets, const size_t* indices, const T* values, const T* x, T* y, const size_t n_rows, const bool accumulate)
+{
+  const size_t n_entries = offsets.back();
+  if(!accumulate) std::fill(y, y + n_rows, T(0));
+  if(!parallel::isParallel(n_entries))
+  {
+    FOR(j, offsets.size() - 1) FOR(k, offsets[j], offsets[j + 1]) y[indices[k]] += values[k] * x[j];
+    return;
+  }
+
+  std::vector<AlignedArray<T>> partials(omp_get_max_threads());
+  ForEachBalancedRange(offsets, n_entries, [&](const size_t first, const size_t last)
+  {
+    auto& partial = partials[omp_get_thread_num()];
+    partial.assign(n_rows, T(0));
+    FOR(j, first, last) FOR(k, offsets[j], offsets[j + 1]) partial[indices[k]] += values[k] * x[j];
+  });
+
+  #pragma omp parallel for schedule(static)
+  for(size_t i = 0; i < n_rows; ++i)
+    for(const auto& partial : partials) if(!partial.empty()) y[i] += partial[i];
+}
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* Compressed Sparse Row/Column Matrix Class
+***************************************************************************************************************************************************************/
+template<typename T, bool is_row_compressed>
+CompressedMatrix<T, is_row_compressed>::CompressedMatrix(const CooMatrix<T>& matrix)
+  : nRows_(matrix.nRows()), nColumns_(matrix.nColumns())
+{
+  detail::Compress<1>(matrix, is_row_compressed, Offsets_, Indices_, Values_);
+}
+
+template<typename T, bool is_row_compressed>
+CompressedMatrix<T, is_row_compressed>::CompressedMatrix(const size_t n_rows, const size_t n_columns, DynamicArray<size_t>&& offsets,
+                                                         DynamicArray<size_t>&& indices, AlignedArray<T>&& values)
+  : Offsets_(std::move(offsets)), Indices_(std::move(indices)), Values_(std::move(values)), nRows_(n_rows), nColumns_(n_columns)
+{
+  DEBUG_ASSERT(Offsets_.size() == (is_row_compressed ? n_rows : n_columns) + 1, "There must be an offset for each row/column, and the number of entries.")
+  DEBUG_ASSERT(Indices_.size() == Values_.size() && Offsets_.back() == Values_.size(), "The numbers of indices, values and entries must be equal.")
+}
+
+template<typename T, bool is_row_compressed>
+T
+CompressedMatrix<T, is_row_compressed>::operator()(const size_t i, const size_t j) const
+{
+  DEBUG_ASSERT(i < nRows_ && j < nColumns_, "The entry (", i, ", ", j, ") lies outside the ", nRows_, " x ", nColumns_, " matrix.")
+
+  const size_t major = is_row_compressed ? i : j;
+  const size_t minor = is_row_compressed ? j : i;
+  const auto first = Indices_.begin() + Offsets_[major];
+  const auto last = Indices_.begin() + Offsets_[major + 1];
+  const auto it = std::lower_bound(first, last, minor);
+  return it != last && *it == minor ? Values_[it - Indices_.begin()] : T(0);
+}
+
+template<typename T, bool is_row_compressed>
+template<class A0, class A1>
+void
+CompressedMatrix<T, is_row_compressed>::Multiply(const DynamicVector<T, A0>& x, DynamicVector<T, A1>& y, const bool accumulate) const
+{
+  DEBUG_ASSERT(x.size() == nColumns_, "The vector size ", x.size(), " must equal the number of matrix columns ", nColumns_, ".")
+  DEBUG_ASSERT(!accumulate || y.size() == nRows_, "The accumulated vector size ", y.size(), " must equal the number of matrix rows ", nRows_, ".")
+  DEBUG_ASSERT(x.data() != y.data(), "Sparse matrix-vector products cannot be computed in-place.")
+
+  y.resize(nRows_);
+  if constexpr(is_row_compressed) detail::GatherProduct(Offsets_, Indices_.data(), Values_.data(), x.data(), y.data(), accumulate);
+  else detail::ScatterProduct(Offsets_, Indices_.data(), Values_.data(), x.data(), y.data(), nRows_, accumulate);
+}
+
+template<typename T, bool is_row_compressed>
+template<class A0, class A1>
+void
+CompressedMatrix<T, is_row_compressed>::MultiplyTranspose(const DynamicVector<T, A0>& x, DynamicVector<T, A1>& y, const bool accumulate) const
+{
+  DEBUG_ASSERT(x.size() == nRows_, "The vector size ", x.size(), " must equal the number of matrix rows ", nRows_, ".")
+  DEBUG_ASSERT(!accumulate || y.size() == nColumns_, "The accumulated vector size ", y.size(), " must equal the number of matrix columns ", nColumns_, ".")
+  DEBUG_ASSERT(x.data() != y.data(), "Sparse matrix-vector products cannot be computed in-place.")
+
+  y.resize(nColumns_);
+  if constexpr(is_row_compressed) detail::ScatterProduct(Offsets_, Indices_.data(), Values_.data(), x.data(), y.data(), nColumns_, accumulate);
+  else detail::GatherProduct(Offsets_, Indices_.data(), Values_.data(), x.data(), y.data(), accumulate);
+}
+
+template<typename T, bool is_row_compressed>
+DynamicMatrix<T>
+CompressedMatrix<T, is_row_compressed>::Dense() const
+{
+  DynamicMatrix<T> dense(nRows_, nColumns_, T(0));
+  FOR(major, Offsets_.size() - 1) FOR(k, Offsets_[major], Offsets_[major + 1])
+    (is_row_compressed ? dense(major, Indices_[k]) : dense(Indices_[k], major)) = Values_[k];
+  return dense;
+}
+
+/***************************************************************************************************************************************************************
+* Block Compressed Sparse Row Matrix Class
+***************************************************************************************************************************************************************/
+template<typename T, size_t B>
+BsrMatrix<T, B>::BsrMatrix(const CooMatrix<T>& matrix)
+  : nBlockRows_(matrix.nRows() / B), nBlockColumns_(matrix.nColumns() / B)
+{
+  DEBUG_ASSERT(matrix.nRows() % B == 0 && matrix.nColumns() % B == 0, "The matrix dimensions must be multiples of the block size ", B, ".")
+  detail::Compress<B>(matrix, true, Offsets_, Indices_, Values_);
+}
+
+template<typename T, size_t B>
+template<class A0, class A1>
+void
+BsrMatrix<T, B>::Multiply(const DynamicVector<T, A0>& x, DynamicVector<T, A1>& y, const bool accumulate) const
+{
+  DEBUG_ASSERT(x.size() == nColumns(), "The vector size ", x.size(), " must equal the number of matrix columns ", nColumns(), ".")
+  DEBUG_ASSERT(!accumulate || y.size() == nRows(), "The accumulated vector size ", y.size(), " must equal the number of matrix rows ", nRows(), ".")
+  DEBUG_ASSERT(x.data() != y.data(), "Sparse matrix-vector products cannot be computed in-place.")
+
+  y.resize(nRows());
+  const size_t* indices = Indices_.data();
+  const T* values = Values_.data();
+  const T* x_data = x.data();
+  T* y_data = y.data();
+
+  detail::ForEachBalancedRange(Offsets_, nBlocks(), [&](const size_t first, const size_t last)
+  {
+    FOR(i, first, last)
+    {
+      T sums[B]{};
+      FOR(k, Offsets_[i], Offsets_[i + 1])
+      {
+        const T* block = values + k * B * B;
+        const T* x_block = x_data + indices[k] * B;
+        FOR(c, B) FOR(r, B) sums[r] += block[r + c * B] * x_block[c];
+      }
+      T* y_block = y_data + i * B;
+      FOR(r, B) y_block[r] = (accumulate ? y_block[r] : T(0)) + sums[r];
+    }
+  });
+}
+
+template<typename T, size_t B>
+DynamicMatrix<T>
+BsrMatrix<T, B>::Dense() const
+{
+  DynamicMatrix<T> dense(nRows(), nColumns(), T(0));
+  FOR(i, nBlockRows_) FOR(k, Offsets_[i], Offsets_[i + 1]) FOR(c, B) FOR(r, B) dense(i * B + r, Indices_[k] * B + c) = Values_[k * B * B + r + c * B];
+  return dense;
+}
+
+/***************************************************************************************************************************************************************
+* Sparse Matrix-vector Products
+***************************************************************************************************************************************************************/
+template<typename T, bool is_row_compressed, class A>
+DynamicVector<T>
+operator*(const CompressedMatrix<T, is_row_compressed>& matrix, const DynamicVector<T, A>& vector)
+{
+  DynamicVector<T> product;
+  matrix.Multiply(vector, product);
+  return product;
+}
+
+template<typename T, size_t B, class A>
+DynamicVector<T>
+operator*(const BsrMatrix<T, B>& matrix, const DynamicVector<T, A>& vector)
+{
+  DynamicVector<T> product;
+  matrix.Multiply(vector, product);
+  return product;
+}
+
+}
@@ -40,6 +40,9 @@ class Vector : public detail::NumericContainer<T, D>
 
    constexpr const T& z() const { return Derived()[2]; }
 
+   /** Expression Assignment */
+   using detail::NumericContainer<T, D>::operator=;
+
    /** Derived Class Access */
    constexpr D& Derived() noexcept { return static_cast<D&>(*this); }
 
@@ -56,7 +59,8 @@ template<typename T, size_t N>
 class StaticVector final : public StaticArray<T, N>,
                            public Vector<T, StaticVector<T, N>>
 {
-   using BaseArray = StaticArray<T, N>;
+   using BaseArray  = StaticArray<T, N>;
+   using BaseVector = Vector<T, StaticVector<T, N>>;
    friend Vector<T, BaseArray>;
 
  public:
@@ -78,16 +82,18 @@ class StaticVector final : public StaticArray<T, N>,
    /** Operators */
    using BaseArray::operator[];
    using BaseArray::operator=;
+   using BaseVector::operator=;
 };
 
 /***************************************************************************************************************************************************************
 * Dynamic Vector Class
 ***************************************************************************************************************************************************************/
-template<typename T>
-class DynamicVector final : public DynamicArray<T>,
-                            public Vector<T, DynamicVector<T>>
+template<typename T, class A = std::allocator<T>>
+class DynamicVector final : public DynamicArray<T, A>,
+                            public Vector<T, DynamicVector<T, A>>
 {
-   using BaseArray = DynamicArray<T>;
+   using BaseArray  = DynamicArray<T, A>;
+   using BaseVector = Vector<T, DynamicVector<T, A>>;
    friend Vector<T, BaseArray>;
 
  public:
@@ -95,23 +101,27 @@ class DynamicVector final : public DynamicArray<T>,
    DynamicVector()
      : BaseArray() {}
 
-   explicit DynamicVector(const size_t size)
-     : BaseArray(size) {}
+   explicit DynamicVector(const A& allocator)
+     : BaseArray(allocator) {}
+
+   explicit DynamicVector(const size_t size, const A& allocator = A())
+     : BaseArray(size, allocator) {}
 
-   DynamicVector(const size_t size, const std::convertible_to<T> auto& value)
-     : BaseArray(size, value) {}
+   DynamicVector(const size_t size, const std::convertible_to<T> auto& value, const A& allocator = A())
+     : BaseArray(size, value, allocator) {}
 
    template<std::convertible_to<T> T2>
-   DynamicVector(const std::initializer_list<T2>& list)
-     : BaseArray(list) {}
+   DynamicVector(const std::initializer_list<T2>& list, const A& allocator = A())
+     : BaseArray(list, allocator) {}
 
    template<class It>
-   DynamicVector(const It first, const It last)
-     : BaseArray(first, last) {}
+   DynamicVector(const It first, const It last, const A& allocator = A())
+     : BaseArray(first, last, allocator) {}
 
    /** Operators */
    using BaseArray::operator[];
    using BaseArray::operator=;
+   using BaseVector::operator=;
 };
 
 /***************************************************************************************************************************************************************
@@ -142,6 +152,13 @@ using SVectorR2 = SVectorR<2>;
 using SVectorR3 = SVectorR<3>;
 using SVectorR4 = SVectorR<4>;
 
+/** Sized single-precision vectors, e.g. for data that is passed on to the GPU. */
+template<size_t N> using SVectorF = SVector<float, N>;
+using SVectorF1 = SVectorF<1>;
+using SVectorF2 = SVectorF<2>;
+using SVectorF3 = SVectorF<3>;
+using SVectorF4 = SVectorF<4>;
+
 /** 2D and 3D Cartesian coordinate standard basis vectors. */
 constexpr SVectorR2 xAxis2{ 1.0, 0.0 };
 constexpr SVectorR2 yAxis2{ 0.0, 1.0 };
@@ -157,6 +174,11 @@ using DVectorB = DVector<Bool>;
 using DVectorU = DVector<UInt>;
 using DVectorI = DVector<Int>;
 using DVectorR = DVector<Real>;
+using DVectorF = DVector<float>;
+
+/** Dynamic vectors with cache-line aligned storage, and with storage drawn from a memory resource (e.g. a MonotonicArena). */
+template<typename T> using AlignedVector = DynamicVector<T, AlignedAllocator<T>>;
+template<typename T> using ArenaVector   = DynamicVector<T, ArenaAllocator<T>>;
 
 /***************************************************************************************************************************************************************
 * Static Vector Conversion
@@ -170,4 +192,14 @@ ToVector(const SVector<T, M>& from)
    return to;
 }
 
+/** Convert the entries of a static vector to another type, e.g. from Real to single precision. */
+template<typename U, typename T, size_t N>
+constexpr SVector<U, N>
+CastVector(const SVector<T, N>& from)
+{
+   SVector<U, N> to;
+   std::transform(from.begin(), from.end(), to.begin(), [](const T x){ return static_cast<U>(x); });
+   return to;
+}
+
 }
@@ -15,8 +15,14 @@
 #pragma once
 
 #include "../../../include/Global.h"
+#include "../../DataContainer/include/Parallel.h"
+#include "../../DataContainer/include/SoAArray.h"
+#include "../../LinearAlgebra/include/Quaternion.h"
 #include "../../LinearAlgebra/include/Vector.h"
 
+#include <ranges>
+#include <span>
+
 namespace aprn {
 
 /***************************************************************************************************************************************************************
@@ -26,9 +32,31 @@ template<typename T, class D>
 constexpr T
 InnerProduct(const Vector<T, D>& vector0, const Vector<T, D>& vector1)
 {
+   // Single-precision products are accumulated in double precision: over short vectors entry by entry, and over long vectors block by block, the blocks
+   // being short enough that their (vectorised) single-precision partial sums are accurate.
+   using A = AccumulationType<T>;
    const auto& v0 = vector0.Derived();
    const auto& v1 = vector1.Derived();
-   return std::inner_product(v0.begin(), v0.end(), v1.begin(), static_cast<T>(Zero));
+   if constexpr(detail::ContiguousOperand<D>)
+      if(!std::is_constant_evaluated() && v0.size() >= simd::MinKernelSize)
+      {
+         DEBUG_ASSERT(v0.size() == v1.size(), "The vector sizes ", v0.size(), " and ", v1.size(), " must be equal.")
+         const auto block_product = [&](const size_t first, const size_t last) -> A { return simd::Dot(v0.data() + first, v1.data() + first, last - first); };
+         return static_cast<T>(parallel::Reduce<A>(v0.size(), block_product, std::plus<A>()));
+      }
+
+   return static_cast<T>(std::inner_product(v0.begin(), v0.end(), v1.begin(), static_cast<A>(Zero), std::plus<A>(), std::multiplies<A>()));
+}
+
+/** Inner product involving lazily evaluated expressions, fused into a single pass without evaluating either operand. */
+template<class X0, class X1>
+requires detail::NumericOperands<X0, X1> && (detail::NumericExpressionType<X0> || detail::NumericExpressionType<X1>)
+constexpr auto
+InnerProduct(const X0& vector0, const X1& vector1)
+{
+   const auto& v0 = detail::ForwardOperand(vector0);
+   const auto& v1 = detail::ForwardOperand(vector1);
+   return std::inner_product(v0.begin(), v0.end(), v1.begin(), static_cast<detail::OperandValue<X0>>(Zero));
 }
 
 template<typename T, class D>
@@ -43,6 +71,11 @@ CrossProduct(const Vector<T, D>& vector0, const Vector<T, D>& vector1)
           SVectorR3{v0[1] * v1[2] - v0[2] * v1[1], v0[2] * v1[0] - v0[0] * v1[2], v0[0] * v1[1] - v0[1] * v1[0]};
 }
 
+template<class X0, class X1>
+requires detail::NumericOperands<X0, X1> && (detail::NumericExpressionType<X0> || detail::NumericExpressionType<X1>)
+constexpr SVectorR3
+CrossProduct(const X0& vector0, const X1& vector1) { return CrossProduct(detail::Evaluate(vector0), detail::Evaluate(vector1)); }
+
 /***************************************************************************************************************************************************************
 * Lp-Norms
 ***************************************************************************************************************************************************************/
@@ -78,6 +111,10 @@ template<typename T, class D>
 constexpr Real
 Magnitude(const Vector<T, D>& v) { return L2Norm(v); }
 
+template<detail::NumericExpressionType E>
+constexpr Real
+Magnitude(const E& expression) { return std::sqrt(InnerProduct(expression, expression)); }
+
 template<typename T, class D>
 constexpr bool
 isNormalised(const Vector<T, D>& v) { return isEqual(Magnitude(v), One); }
@@ -90,6 +127,10 @@ Normalise(const Vector<T, D>& v)
    return !isEqual(magn, Zero) ? v / magn : throw std::invalid_argument("Cannot normalise a vector of zero magnitude.");
 }
 
+template<detail::NumericExpressionType E>
+constexpr auto
+Normalise(const E& expression) { return Normalise(expression.Evaluate()); }
+
 /***************************************************************************************************************************************************************
 * Vector Angle/Alignment/Rotation
 ***************************************************************************************************************************************************************/
@@ -111,20 +152,412 @@ isAligned(const Vector<T, D>& v0, const Vector<T, D>& v1, const Real angle_thres
                                                  throw std::domain_error("Angle threshold is out of bounds.");
 }
 
+/** Rotate a 3D vector by an angle about an axis (by the right-hand rule), which need not be normalised. 2D vectors are rotated in the xy-plane, for which the
+    axis must be the (positive or negative) z-axis. */
 template<typename T, class D>
 constexpr D
 RotateAbout(const Vector<T, D>& vector, const Real& angle, const SVectorR3& axis = zAxis3)
 {
-   EXIT("TODO")
-   return D{};
+   const auto& v = vector.Derived();
+   ASSERT(v.size() == 2 || v.size() == 3, "Rotations can only be computed for 2D or 3D vectors.")
+
+   D rotated(v);
+   if(v.size() == 2)
+   {
+      DEBUG_ASSERT(axis[0] == Zero && axis[1] == Zero && axis[2] != Zero, "2D vectors can only be rotated about the z-axis.")
+      const Real cosine = std::cos(angle);
+      const Real sine = Sgn(axis[2]) * std::sin(angle);
+      rotated[0] = cosine * v[0] - sine * v[1];
+      rotated[1] = sine * v[0] + cosine * v[1];
+   }
+   else
+   {
+      const auto v_rotated = Quaternion::AxisAngle(axis, angle).Rotate(SVectorR3{v[0], v[1], v[2]});
+      FOR(i, 3) rotated[i] = v_rotated[i];
+   }
+   return rotated;
 }
 
+/** Rotate a vector by an angle towards a reference vector, in the plane spanned by the two vectors, which must not be aligned. */
 template<typename T, class D>
 constexpr D
 RotateTowards(const Vector<T, D>& vector, const Real& angle, const Vector<T, D>& reference)
 {
-   EXIT("TODO")
-   return D{};
+   const auto axis = CrossProduct(vector, reference);
+   ASSERT(Magnitude(axis) > Zero, "Cannot rotate a vector towards a reference vector with which it is aligned.")
+   return RotateAbout(vector, angle, axis);
+}
+
+/***************************************************************************************************************************************************************
+* Batched Vector Operations
+*
+* Products, norms and angles of many small vectors at once, stored either as arrays of static vectors (e.g. DynamicArray<SVectorR3>) or as structures-of-
+* arrays of coordinates. Each operation is a single pass with the vector components unrolled, which the compiler vectorises, and which is distributed
+* over threads if large enough, so that there is no per-call overhead of expression templates or temporaries. Outputs can be any contiguous array of the
+* right size.
+***************************************************************************************************************************************************************/
+namespace detail {
+
+template<class V> struct StaticVectorTraits;
+
+template<typename T, size_t N>
+struct StaticVectorTraits<StaticVector<T, N>>
+{
+   using value_type = T;
+   static constexpr size_t Size{N};
+};
+
+/** Contiguous range of static vectors, e.g. a DynamicArray<SVectorR3> or a span of SVectorR2. */
+template<class R>
+concept StaticVectorRange = std::ranges::contiguous_range<R> && requires { StaticVectorTraits<std::ranges::range_value_t<R>>::Size; };
+
+template<StaticVectorRange R> using BatchValue = typename StaticVectorTraits<std::ranges::range_value_t<R>>::value_type;
+
+template<StaticVectorRange R> constexpr size_t BatchDimension = StaticVectorTraits<std::ranges::range_value_t<R>>::Size;
+
+/** Apply a function to each index of a batch of a given size, in blocks which are distributed over threads if the batch is large enough. */
+template<class F>
+void
+ForEachInBatch(const size_t n, F&& function) { parallel::For(n, [&](const size_t first, const size_t last) { FOR(i, first, last) function(i); }); }
+
+template<typename T, size_t N>
+constexpr T
+SmallInnerProduct(const T* v0, const T* v1)
+{
+   T product = v0[0] * v1[0];
+   FOR(j, 1, N) product += v0[j] * v1[j];
+   return product;
+}
+
+/** Angle between two vectors. 2D and 3D angles are computed as atan2(|a x b|, a . b), which, unlike acos((a . b) / (|a||b|)), is accurate for nearly
+    (anti-)parallel vectors. */
+template<typename T, size_t N>
+T
+SmallAngle(const T* a, const T* b)
+{
+   const T inner_product = SmallInnerProduct<T, N>(a, b);
+   if constexpr(N == 2) return std::atan2(Abs(a[0] * b[1] - a[1] * b[0]), inner_product);
+   else if constexpr(N == 3)
+   {
+      const T c[3] = {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+      return std::atan2(std::sqrt(SmallInnerProduct<T, 3>(c, c)), inner_product);
+   }
+   else return std::acos(std::clamp(inner_product / std::sqrt(SmallInnerProduct<T, N>(a, a) * SmallInnerProduct<T, N>(b, b)), T(-1), T(1)));
+}
+
+template<class R0, class R1>
+void
+BatchSizeCheck(const R0& range0, const R1& range1)
+{
+   DEBUG_ASSERT(std::ranges::size(range0) == std::ranges::size(range1), "The batch sizes ", std::ranges::size(range0), " and ", std::ranges::size(range1),
+                " must be equal.")
+}
+
+}//detail
+
+/** Inner products of corresponding vectors in two arrays. */
+template<detail::StaticVectorRange R0, detail::StaticVectorRange R1>
+requires (isTypeSame<std::ranges::range_value_t<R0>, std::ranges::range_value_t<R1>>())
+void
+InnerProduct(const R0& vectors0, const R1& vectors1, std::span<detail::BatchValue<R0>> products)
+{
+   using T = detail::BatchValue<R0>;
+   constexpr size_t N = detail::BatchDimension<R0>;
+   detail::BatchSizeCheck(vectors0, vectors1);
+   detail::BatchSizeCheck(vectors0, products);
+
+   const auto* v0 = std::ranges::data(vectors0);
+   const auto* v1 = std::ranges::data(vectors1);
+   detail::ForEachInBatch(products.size(), [&](const size_t i) { products[i] = detail::SmallInnerProduct<T, N>(v0[i].data(), v1[i].data()); });
+}
+
+/** Cross products of corresponding 2D or 3D vectors in two arrays, which are 3D vectors (along the z-axis for 2D vectors). */
+template<detail::StaticVectorRange R0, detail::StaticVectorRange R1>
+requires (isTypeSame<std::ranges::range_value_t<R0>, std::ranges::range_value_t<R1>>())
+void
+CrossProduct(const R0& vectors0, const R1& vectors1, std::span<SVector3<detail::BatchValue<R0>>> products)
+{
+   using T = detail::BatchValue<R0>;
+   constexpr size_t N = detail::BatchDimension<R0>;
+   STATIC_ASSERT(N == 2 || N == 3, "Cross products can only be computed for 2D or 3D vectors.")
+   detail::BatchSizeCheck(vectors0, vectors1);
+   detail::BatchSizeCheck(vectors0, products);
+
+   const auto* v0 = std::ranges::data(vectors0);
+   const auto* v1 = std::ranges::data(vectors1);
+   detail::ForEachInBatch(products.size(), [&](const size_t i)
+   {
+      const T* a = v0[i].data();
+      const T* b = v1[i].data();
+      T* c = products[i].data();
+      if constexpr(N == 2)
+      {
+         c[0] = c[1] = T(0);
+         c[2] = a[0] * b[1] - a[1] * b[0];
+      }
+      else
+      {
+         c[0] = a[1] * b[2] - a[2] * b[1];
+         c[1] = a[2] * b[0] - a[0] * b[2];
+         c[2] = a[0] * b[1] - a[1] * b[0];
+      }
+   });
+}
+
+template<detail::StaticVectorRange R>
+void
+Magnitude(const R& vectors, std::span<detail::BatchValue<R>> magnitudes)
+{
+   using T = detail::BatchValue<R>;
+   constexpr size_t N = detail::BatchDimension<R>;
+   detail::BatchSizeCheck(vectors, magnitudes);
+
+   const auto* v = std::ranges::data(vectors);
+   detail::ForEachInBatch(magnitudes.size(), [&](const size_t i) { magnitudes[i] = std::sqrt(detail::SmallInnerProduct<T, N>(v[i].data(), v[i].data())); });
+}
+
+/** Normalise an array of vectors, which may be normalised in place. Any vectors of zero magnitude are copied unchanged, and an exception is thrown once
+    all other vectors have been normalised. */
+template<detail::StaticVectorRange R>
+void
+Normalise(const R& vectors, std::span<std::ranges::range_value_t<R>> normalised)
+{
+   using T = detail::BatchValue<R>;
+   constexpr size_t N = detail::BatchDimension<R>;
+   detail::BatchSizeCheck(vectors, normalised);
+
+   const auto* v = std::ranges::data(vectors);
+   const auto n_zero = parallel::Reduce<size_t>(normalised.size(), [&](const size_t first, const size_t last)
+   {
+      size_t count = 0;
+      FOR(i, first, last)
+      {
+         const T magnitude = std::sqrt(detail::SmallInnerProduct<T, N>(v[i].data(), v[i].data()));
+         const bool is_zero = isEqual(magnitude, Zero);
+         const T scale = is_zero ? T(1) : T(1) / magnitude;
+         count += is_zero;
+         FOR(j, N) normalised[i][j] = scale * v[i][j];
+      }
+      return count;
+   }, std::plus<size_t>());
+
+   if(n_zero) throw std::invalid_argument("Cannot normalise a vector of zero magnitude.");
+}
+
+/** Angles between corresponding vectors in two arrays, which must be of non-zero magnitude. Oriented angles are signed by the orientation of the cross
+    product relative to a given orientation vector, as for single vectors. */
+template<bool orientangle = false, detail::StaticVectorRange R0, detail::StaticVectorRange R1>
+requires (isTypeSame<std::ranges::range_value_t<R0>, std::ranges::range_value_t<R1>>())
+void
+ComputeAngle(const R0& vectors0, const R1& vectors1, std::span<detail::BatchValue<R0>> angles, const SVectorR3& orient = zAxis3)
+{
+   using T = detail::BatchValue<R0>;
+   constexpr size_t N = detail::BatchDimension<R0>;
+   detail::BatchSizeCheck(vectors0, vectors1);
+   detail::BatchSizeCheck(vectors0, angles);
+
+   const auto* v0 = std::ranges::data(vectors0);
+   const auto* v1 = std::ranges::data(vectors1);
+   detail::ForEachInBatch(angles.size(), [&](const size_t i)
+   {
+      const T* a = v0[i].data();
+      const T* b = v1[i].data();
+      const T angle = detail::SmallAngle<T, N>(a, b);
+      if constexpr(!orientangle) angles[i] = angle;
+      else
+      {
+         STATIC_ASSERT(N == 2 || N == 3, "Oriented angles can only be computed for 2D or 3D vectors.")
+         T orientation;
+         if constexpr(N == 2) orientation = static_cast<T>(orient[2]) * (a[0] * b[1] - a[1] * b[0]);
+         else orientation = static_cast<T>(orient[0]) * (a[1] * b[2] - a[2] * b[1]) + static_cast<T>(orient[1]) * (a[2] * b[0] - a[0] * b[2]) +
+                            static_cast<T>(orient[2]) * (a[0] * b[1] - a[1] * b[0]);
+         angles[i] = Sgn(orientation) * angle;
+      }
+   });
+}
+
+/** Check whether corresponding vectors in two arrays are aligned, i.e. parallel or anti-parallel to within a threshold angle. */
+template<detail::StaticVectorRange R0, detail::StaticVectorRange R1>
+requires (isTypeSame<std::ranges::range_value_t<R0>, std::ranges::range_value_t<R1>>())
+void
+isAligned(const R0& vectors0, const R1& vectors1, std::span<Bool> alignments, const Real angle_thresh = TwelfthPi)
+{
+   using T = detail::BatchValue<R0>;
+   constexpr size_t N = detail::BatchDimension<R0>;
+   if(!isBounded(angle_thresh, Zero, HalfPi)) throw std::domain_error("Angle threshold is out of bounds.");
+   detail::BatchSizeCheck(vectors0, vectors1);
+   detail::BatchSizeCheck(vectors0, alignments);
+
+   const auto* v0 = std::ranges::data(vectors0);
+   const auto* v1 = std::ranges::data(vectors1);
+   detail::ForEachInBatch(alignments.size(), [&](const size_t i)
+   {
+      const T* a = v0[i].data();
+      const T* b = v1[i].data();
+      const T angle = detail::SmallAngle<T, N>(a, b);
+      alignments[i] = angle < angle_thresh || angle > (Pi - angle_thresh);
+   });
+}
+
+/** Structure-of-arrays overloads for 3D vectors, stored as (x, y, z) records. */
+template<std::floating_point T>
+void
+InnerProduct(const SoAArray<T, T, T>& vectors0, const SoAArray<T, T, T>& vectors1, std::span<std::type_identity_t<T>> products)
+{
+   detail::BatchSizeCheck(vectors0, vectors1);
+   detail::BatchSizeCheck(vectors0, products);
+   const T* x0 = vectors0.template Field<0>().data(), * y0 = vectors0.template Field<1>().data(), * z0 = vectors0.template Field<2>().data();
+   const T* x1 = vectors1.template Field<0>().data(), * y1 = vectors1.template Field<1>().data(), * z1 = vectors1.template Field<2>().data();
+   T* p = products.data();
+   detail::ForEachInBatch(products.size(), [=](const size_t i) { p[i] = x0[i] * x1[i] + y0[i] * y1[i] + z0[i] * z1[i]; });
+}
+
+template<std::floating_point T>
+void
+CrossProduct(const SoAArray<T, T, T>& vectors0, const SoAArray<T, T, T>& vectors1, SoAArray<T, T, T>& products)
+{
+   detail::BatchSizeCheck(vectors0, vectors1);
+   products.Resize(vectors0.size());
+   const T* x0 = vectors0.template Field<0>().data(), * y0 = vectors0.template Field<1>().data(), * z0 = vectors0.template Field<2>().data();
+   const T* x1 = vectors1.template Field<0>().data(), * y1 = vectors1.template Field<1>().data(), * z1 = vectors1.template Field<2>().data();
+   T* x = products.template Field<0>().data(), * y = products.template Field<1>().data(), * z = products.template Field<2>().data();
+   detail::ForEachInBatch(products.size(), [=](const size_t i)
+   {
+      const T x_i = y0[i] * z1[i] - z0[i] * y1[i];
+      const T y_i = z0[i] * x1[i] - x0[i] * z1[i];
+      const T z_i = x0[i] * y1[i] - y0[i] * x1[i];
+      x[i] = x_i;
+      y[i] = y_i;
+      z[i] = z_i;
+   });
+}
+
+template<std::floating_point T>
+void
+Magnitude(const SoAArray<T, T, T>& vectors, std::span<std::type_identity_t<T>> magnitudes)
+{
+   detail::BatchSizeCheck(vectors, magnitudes);
+   const T* x = vectors.template Field<0>().data(), * y = vectors.template Field<1>().data(), * z = vectors.template Field<2>().data();
+   T* m = magnitudes.data();
+   detail::ForEachInBatch(magnitudes.size(), [=](const size_t i) { m[i] = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]); });
+}
+
+/** Normalise 3D vectors in place, with vectors of zero magnitude treated as for arrays of static vectors. */
+template<std::floating_point T>
+void
+Normalise(SoAArray<T, T, T>& vectors)
+{
+   T* x = vectors.template Field<0>().data(), * y = vectors.template Field<1>().data(), * z = vectors.template Field<2>().data();
+   const auto n_zero = parallel::Reduce<size_t>(vectors.size(), [=](const size_t first, const size_t last)
+   {
+      size_t count = 0;
+      FOR(i, first, last)
+      {
+         const T magnitude = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+         const bool is_zero = isEqual(magnitude, Zero);
+         const T scale = is_zero ? T(1) : T(1) / magnitude;
+         count += is_zero;
+         x[i] *= scale;
+         y[i] *= scale;
+         z[i] *= scale;
+      }
+      return count;
+   }, std::plus<size_t>());
+
+   if(n_zero) throw std::invalid_argument("Cannot normalise a vector of zero magnitude.");
+}
+
+/***************************************************************************************************************************************************************
+* Batched Vector Rotation
+*
+* Rotations of many 3D vectors, stored as structures-of-arrays, i.e. as separate x, y and z coordinate arrays, so that the loops over the vectors are
+* vectorised, and distributed over threads if large enough. A single rotation is applied as a rotation matrix (9 multiply-adds per vector), formed once,
+* and per-vector rotations are applied directly as quaternions (15 multiply-adds per vector), without forming matrices.
+***************************************************************************************************************************************************************/
+
+/** Rotate the vectors (x[i], y[i], z[i]) in place by a unit quaternion. The rotation matrix is formed at Real precision and rounded once to that of the
+    coordinates, which may be single-precision. */
+template<std::floating_point T>
+void
+Rotate(std::span<T> x, std::span<T> y, std::span<T> z, const Quaternion& rotation)
+{
+   const size_t n = x.size();
+   DEBUG_ASSERT(y.size() == n && z.size() == n, "The coordinate array sizes ", n, ", ", y.size(), " and ", z.size(), " must be equal.")
+
+   const auto matrix = rotation.RotationMatrix();
+   const T r00 = matrix(0, 0), r01 = matrix(0, 1), r02 = matrix(0, 2);
+   const T r10 = matrix(1, 0), r11 = matrix(1, 1), r12 = matrix(1, 2);
+   const T r20 = matrix(2, 0), r21 = matrix(2, 1), r22 = matrix(2, 2);
+   T* const px = x.data();
+   T* const py = y.data();
+   T* const pz = z.data();
+   parallel::For(n, [=](const size_t first, const size_t last)
+   {
+      FOR(i, first, last)
+      {
+         const T x_i = px[i], y_i = py[i], z_i = pz[i];
+         px[i] = r00 * x_i + r01 * y_i + r02 * z_i;
+         py[i] = r10 * x_i + r11 * y_i + r12 * z_i;
+         pz[i] = r20 * x_i + r21 * y_i + r22 * z_i;
+      }
+   });
+}
+
+/** Rotate the vectors (x[i], y[i], z[i]) in place by an angle about an axis, which need not be normalised. */
+template<std::floating_point T>
+void
+RotateAbout(std::span<T> x, std::span<T> y, std::span<T> z, const Real angle, const SVectorR3& axis = zAxis3)
+{ Rotate(x, y, z, Quaternion::AxisAngle(axis, angle)); }
+
+/** Rotate each vector (x[i], y[i], z[i]) in place by its own unit quaternion (qw[i], qx[i], qy[i], qz[i]). */
+template<std::floating_point T>
+void
+Rotate(std::span<T> x, std::span<T> y, std::span<T> z, std::span<const T> qw, std::span<const T> qx, std::span<const T> qy, std::span<const T> qz)
+{
+   const size_t n = x.size();
+   DEBUG_ASSERT(y.size() == n && z.size() == n, "The coordinate array sizes ", n, ", ", y.size(), " and ", z.size(), " must be equal.")
+   DEBUG_ASSERT(qw.size() == n && qx.size() == n && qy.size() == n && qz.size() == n, "There must be one quaternion per vector.")
+
+   T* const px = x.data();
+   T* const py = y.data();
+   T* const pz = z.data();
+   const T* const pqw = qw.data();
+   const T* const pqx = qx.data();
+   const T* const pqy = qy.data();
+   const T* const pqz = qz.data();
+   parallel::For(n, [=](const size_t first, const size_t last)
+   {
+      // v + w t + u x t, where t = 2u x v and u is the vector part of the quaternion.
+      FOR(i, first, last)
+      {
+         const T x_i = px[i], y_i = py[i], z_i = pz[i];
+         const T tx = T(2) * (pqy[i] * z_i - pqz[i] * y_i);
+         const T ty = T(2) * (pqz[i] * x_i - pqx[i] * z_i);
+         const T tz = T(2) * (pqx[i] * y_i - pqy[i] * x_i);
+         px[i] = x_i + pqw[i] * tx + pqy[i] * tz - pqz[i] * ty;
+         py[i] = y_i + pqw[i] * ty + pqz[i] * tx - pqx[i] * tz;
+         pz[i] = z_i + pqw[i] * tz + pqx[i] * ty - pqy[i] * tx;
+      }
+   });
+}
+
+/** Structure-of-arrays overloads, with vectors stored as (x, y, z) records and quaternions as (w, x, y, z) records. */
+template<std::floating_point T>
+void
+Rotate(SoAArray<T, T, T>& vectors, const Quaternion& rotation)
+{ Rotate(vectors.template Field<0>(), vectors.template Field<1>(), vectors.template Field<2>(), rotation); }
+
+template<std::floating_point T>
+void
+RotateAbout(SoAArray<T, T, T>& vectors, const Real angle, const SVectorR3& axis = zAxis3)
+{ RotateAbout(vectors.template Field<0>(), vectors.template Field<1>(), vectors.template Field<2>(), angle, axis); }
+
+template<std::floating_point T>
+void
+Rotate(SoAArray<T, T, T>& vectors, const SoAArray<T, T, T, T>& rotations)
+{
+   Rotate(vectors.template Field<0>(), vectors.template Field<1>(), vectors.template Field<2>(),
+          rotations.template Field<0>(), rotations.template Field<1>(), rotations.template Field<2>(), rotations.template Field<3>());
 }
 
 }
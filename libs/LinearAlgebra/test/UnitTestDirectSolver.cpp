@@ -0,0 +1,167 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../include/DirectSolver.h"
+
+#ifdef DEBUG_MODE
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Direct Solver Test Fixture
+***************************************************************************************************************************************************************/
+class DirectSolverTest : public testing::Test
+{
+ public:
+   /** Random matrix, which is made diagonally dominant (and hence well-conditioned) if required. */
+   static DynamicMatrix<Real>
+   RandomMatrix(const size_t m, const size_t n, const bool is_dominant = true)
+   {
+      DynamicMatrix<Real> matrix(m, n);
+      matrix.Randomise();
+      if(is_dominant) FOR(i, Min(m, n)) matrix(i, i) += static_cast<Real>(n);
+      return matrix;
+   }
+
+   template<class D0, class D1>
+   static Real
+   MaxDifference(const D0& a, const D1& b)
+   {
+      Real difference(Zero);
+      FOR(i, a.size()) difference = Max(difference, std::abs(a[i] - b[i]));
+      return difference;
+   }
+};
+
+/***************************************************************************************************************************************************************
+* Test Closed-form Static Solutions
+***************************************************************************************************************************************************************/
+TEST_F(DirectSolverTest, StaticSolutions)
+{
+   constexpr SMatrixR2 a{{2.0, 1.0}, {1.0, 1.0}};
+   static_assert(Determinant(a) == 1.0);
+   constexpr auto a_inverse = Inverse(a);
+   static_assert(a_inverse(0, 0) == 1.0 && a_inverse(1, 0) == -1.0 && a_inverse(1, 1) == 2.0);
+
+   constexpr StaticMatrix<int, 3, 3> b{{2, 0, 1}, {1, 3, 2}, {1, 1, 2}};
+   static_assert(Determinant(b) == 6);
+
+   // Closed-form solutions must agree with LU factorisation.
+   SMatrixR3 c;
+   SMatrixR4 d;
+   c.Randomise();
+   d.Randomise();
+   EXPECT_NEAR(Determinant(c), LUFactorisation<Real>(c).Determinant(), 1e-12);
+   EXPECT_NEAR(Determinant(d), LUFactorisation<Real>(d).Determinant(), 1e-12);
+   EXPECT_LT(MaxDifference(Inverse(c), LUFactorisation<Real>(c).Inverse()), 1e-8);
+   EXPECT_LT(MaxDifference(Inverse(d), LUFactorisation<Real>(d).Inverse()), 1e-8);
+   EXPECT_LT(MaxDifference(d * Inverse(d), SMatrixR4::Identity()), 1e-8);
+
+   const SVectorR4 x{1.0, -2.0, 3.0, 0.5};
+   EXPECT_LT(MaxDifference(Solve(d, SVectorR4(d * x)), x), 1e-8);
+}
+
+/***************************************************************************************************************************************************************
+* Test Factorisations
+***************************************************************************************************************************************************************/
+TEST_F(DirectSolverTest, LUFactorisation)
+{
+   // Sizes spanning several panels, which are not multiples of the panel width.
+   const auto a = RandomMatrix(203, 203, false);
+   DynamicVector<Real> x(203);
+   x.Randomise();
+   const DynamicVector<Real> b = a * x;
+
+   const LUFactorisation<Real> lu(a);
+   EXPECT_FALSE(lu.isSingular());
+   EXPECT_LT(MaxDifference(lu.Solve(b), x), 1e-8);
+   EXPECT_LT(MaxDifference(Solve(a, b), x), 1e-8);
+
+   // Many right-hand sides with a single factorisation.
+   const auto xs = RandomMatrix(203, 150, false);
+   const auto bs = a * xs;
+   EXPECT_LT(MaxDifference(lu.Solve(bs), xs), 1e-8);
+   EXPECT_LT(MaxDifference(a * lu.Inverse(), DMatrixR::Identity(203)), 1e-8);
+
+   // The determinant of a product is the product of the determinants.
+   const auto c = RandomMatrix(70, 70);
+   const auto d = RandomMatrix(70, 70);
+   EXPECT_NEAR(Determinant(c * d) / (Determinant(c) * Determinant(d)), One, 1e-10);
+
+   DynamicMatrix<Real> singular{{1.0, 2.0}, {2.0, 4.0}};
+   EXPECT_TRUE(LUFactorisation<Real>(singular).isSingular());
+   EXPECT_DEATH(LUFactorisation<Real>(singular).Solve(DynamicVector<Real>{1.0, 1.0}), "");
+}
+
+TEST_F(DirectSolverTest, CholeskyFactorisation)
+{
+   // A = B * B^T + n * I is symmetric positive-definite.
+   const auto b = RandomMatrix(150, 150, false);
+   DynamicMatrix<Real> a = b * b.Transpose();
+   FOR(i, 150) a(i, i) += 150.0;
+
+   DynamicVector<Real> x(150);
+   x.Randomise();
+   const DynamicVector<Real> rhs = a * x;
+
+   const CholeskyFactorisation<Real> cholesky(a);
+   ASSERT_TRUE(cholesky.isPositiveDefinite());
+   EXPECT_LT(MaxDifference(cholesky.Factor() * cholesky.Factor().Transpose(), a), 1e-8);
+   EXPECT_LT(MaxDifference(cholesky.Solve(rhs), x), 1e-10);
+
+   const auto xs = RandomMatrix(150, 20, false);
+   EXPECT_LT(MaxDifference(cholesky.Solve(DynamicMatrix<Real>(a * xs)), xs), 1e-10);
+
+   const auto c = RandomMatrix(20, 20, false);
+   const DynamicMatrix<Real> c_square = c * c.Transpose();
+   EXPECT_NEAR(CholeskyFactorisation<Real>(c_square).Determinant() / Determinant(c_square), One, 1e-6);
+
+   DynamicMatrix<Real> indefinite{{1.0, 2.0}, {2.0, 1.0}};
+   EXPECT_FALSE(CholeskyFactorisation<Real>(std::move(indefinite)).isPositiveDefinite());
+}
+
+TEST_F(DirectSolverTest, QRFactorisation)
+{
+   const auto a = RandomMatrix(300, 140, false);
+   const QRFactorisation<Real> qr(a);
+   ASSERT_FALSE(qr.isRankDeficient());
+
+   const auto q = qr.Q();
+   const auto r = qr.R();
+   EXPECT_LT(MaxDifference(q * r, a), 1e-10);
+   EXPECT_LT(MaxDifference(q.Transpose() * q, DMatrixR::Identity(140)), 1e-10);
+   FOR(j, 140) FOR(i, j + 1, 140) EXPECT_EQ(r(i, j), Zero);
+
+   // Consistent systems are solved exactly, and the residual of a least-squares solution is orthogonal to the column space.
+   DynamicVector<Real> x(140);
+   x.Randomise();
+   EXPECT_LT(MaxDifference(qr.Solve(DynamicVector<Real>(a * x)), x), 1e-10);
+
+   DynamicVector<Real> b(300);
+   b.Randomise();
+   const auto least_squares = qr.Solve(b);
+   const DynamicVector<Real> residual = a * least_squares - b;
+   const DynamicVector<Real> projection = a.Transpose() * residual;
+   FOR(i, projection.size()) EXPECT_NEAR(projection[i], Zero, 1e-10);
+
+   const auto xs = RandomMatrix(140, 7, false);
+   EXPECT_LT(MaxDifference(qr.Solve(a * xs), xs), 1e-10);
+}
+
+}
+
+#endif
@@ -0,0 +1,167 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../include/EigenSolver.h"
+#include "../include/VectorOperations.h"
+
+#ifdef DEBUG_MODE
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Eigensolver Test Fixture
+***************************************************************************************************************************************************************/
+class EigenSolverTest : public testing::Test
+{
+ public:
+   template<class M>
+   static M
+   RandomSymmetric(M matrix)
+   {
+      matrix.Randomise();
+      return matrix + matrix.Transpose();
+   }
+
+   /** Maximum of the residuals |Av - λv| and of the deviations of the eigenvectors from orthonormality, relative to the largest eigenvalue. */
+   template<class M, class V, class E>
+   static Real
+   MaxError(const M& matrix, const V& eigenvalues, const E& eigenvectors)
+   {
+      const size_t n = eigenvalues.size();
+      Real scale(Zero), error(Zero);
+      FOR(i, n) scale = Max(scale, std::abs(eigenvalues[i]));
+      FOR(j, n)
+      {
+         FOR(i, n)
+         {
+            Real av(Zero), vv(Zero);
+            FOR(k, n) av += matrix(i, k) * eigenvectors(k, j);
+            FOR(k, n) vv += eigenvectors(k, i) * eigenvectors(k, j);
+            error = Max(error, std::abs(av - eigenvalues[j] * eigenvectors(i, j)) / scale);
+            error = Max(error, std::abs(vv - (i == j ? One : Zero)));
+         }
+         if(j > 0) EXPECT_LE(eigenvalues[j - 1], eigenvalues[j]);
+      }
+      return error;
+   }
+};
+
+/***************************************************************************************************************************************************************
+* Test 3 x 3 Symmetric Eigensolver
+***************************************************************************************************************************************************************/
+TEST_F(EigenSolverTest, Symmetric3)
+{
+   const SMatrixR3 a{{2.0, 1.0, 0.0}, {1.0, 2.0, 0.0}, {0.0, 0.0, 5.0}};
+   const auto [eigenvalues, eigenvectors] = SymmetricEigen(a);
+   EXPECT_NEAR(eigenvalues[0], One, 1e-14);
+   EXPECT_NEAR(eigenvalues[1], Three, 1e-14);
+   EXPECT_NEAR(eigenvalues[2], Five, 1e-14);
+   EXPECT_LT(MaxError(a, eigenvalues, eigenvectors), 1e-14);
+
+   // Only the lower triangle is read.
+   SMatrixR3 lower = a;
+   lower(0, 1) = 100.0;
+   EXPECT_LT(MaxError(a, SymmetricEigen(lower).Eigenvalues, SymmetricEigen(lower).Eigenvectors), 1e-14);
+
+   // Repeated and nearly repeated eigenvalues, and multiples of the identity.
+   const SVectorR3 u = Normalise(SVectorR3{One, Two, -Two});
+   SMatrixR3 rank_one;
+   FOR(i, 3) FOR(j, 3) rank_one(i, j) = Three * u[i] * u[j] + (i == j ? One : Zero);
+   const auto [repeated_values, repeated_vectors] = SymmetricEigen(rank_one);
+   EXPECT_NEAR(repeated_values[0], One, 1e-14);
+   EXPECT_NEAR(repeated_values[1], One, 1e-14);
+   EXPECT_NEAR(repeated_values[2], Four, 1e-14);
+   EXPECT_LT(MaxError(rank_one, repeated_values, repeated_vectors), 1e-14);
+
+   SMatrixR3 nearly_repeated = rank_one;
+   nearly_repeated(1, 1) += 1e-10;
+   const auto nearly_repeated_system = SymmetricEigen(nearly_repeated);
+   EXPECT_LT(MaxError(nearly_repeated, nearly_repeated_system.Eigenvalues, nearly_repeated_system.Eigenvectors), 1e-14);
+
+   const SMatrixR3 identity = Two * SMatrixR3::Identity();
+   const auto identity_system = SymmetricEigen(identity);
+   EXPECT_LT(MaxError(identity, identity_system.Eigenvalues, identity_system.Eigenvectors), 1e-15);
+   EXPECT_EQ(SymmetricEigen(SMatrixR3(Zero)).Eigenvalues[2], Zero);
+
+   // Badly scaled matrices.
+   const SMatrixR3 tiny = 1e-150 * a;
+   EXPECT_NEAR(1e150 * SymmetricEigenvalues(tiny)[2], Five, 1e-13);
+   const SVectorR3 rescaled_eigenvalues = 1e150 * SymmetricEigenvalues(tiny);
+   EXPECT_LT(MaxError(a, rescaled_eigenvalues, SymmetricEigen(tiny).Eigenvectors), 1e-13);
+}
+
+TEST_F(EigenSolverTest, BatchedSymmetric3)
+{
+   const size_t n = 50000;
+   DynamicArray<SMatrixR3> matrices(n);
+   FOR(k, n) matrices[k] = RandomSymmetric(SMatrixR3());
+   // Every hundredth matrix is a (nearly) repeated multiple of the identity.
+   for(size_t k = 0; k < n; k += 100) FOR(i, 3) FOR(j, 3) matrices[k](i, j) = (i == j ? Two : Zero) + (k % 200 ? 1e-9 * matrices[k](i, j) : Zero);
+
+   DynamicArray<SVectorR3> eigenvalues(n), eigenvalues_only(n);
+   DynamicArray<SMatrixR3> eigenvectors(n);
+   SymmetricEigen(matrices, eigenvalues, eigenvectors);
+   SymmetricEigenvalues(matrices, eigenvalues_only);
+
+   Real error(Zero), difference(Zero);
+   FOR(k, n)
+   {
+      error = Max(error, MaxError(matrices[k], eigenvalues[k], eigenvectors[k]));
+      FOR(i, 3) difference = Max(difference, std::abs(eigenvalues[k][i] - eigenvalues_only[k][i]));
+      EXPECT_TRUE(eigenvalues[k] == SymmetricEigen(matrices[k]).Eigenvalues);
+   }
+   EXPECT_LT(error, 1e-13);
+   EXPECT_LT(difference, 1e-13);
+}
+
+/***************************************************************************************************************************************************************
+* Test Dense Symmetric Eigendecomposition
+***************************************************************************************************************************************************************/
+TEST_F(EigenSolverTest, SymmetricEigenDecomposition)
+{
+   const auto a = RandomSymmetric(DynamicMatrix<Real>(150, 150));
+   const SymmetricEigenDecomposition<Real> decomposition(a);
+   EXPECT_TRUE(decomposition.isConverged());
+   EXPECT_LT(MaxError(a, decomposition.Eigenvalues(), decomposition.Eigenvectors()), 1e-12);
+
+   const SymmetricEigenDecomposition<Real> eigenvalues_only(a, false);
+   EXPECT_EQ(eigenvalues_only.Eigenvectors().size(), 0);
+   FOR(i, a.nRows()) EXPECT_NEAR(eigenvalues_only.Eigenvalues()[i], decomposition.Eigenvalues()[i], 1e-12);
+
+   // Eigenvalues of the 1D Laplacian, 2 - 2cos(kπ / (n + 1)).
+   const size_t n = 300;
+   DynamicMatrix<Real> laplacian(n, n, Zero);
+   FOR(i, n)
+   {
+      laplacian(i, i) = Two;
+      if(i > 0) laplacian(i, i - 1) = laplacian(i - 1, i) = -One;
+   }
+   const SymmetricEigenDecomposition<Real> laplacian_decomposition(laplacian);
+   EXPECT_LT(MaxError(laplacian, laplacian_decomposition.Eigenvalues(), laplacian_decomposition.Eigenvectors()), 1e-12);
+   FOR(k, n) EXPECT_NEAR(laplacian_decomposition.Eigenvalues()[k], Two - Two * std::cos(static_cast<Real>(k + 1) * Pi / static_cast<Real>(n + 1)), 1e-13);
+
+   // Agreement with the 3 x 3 solver, and trivial sizes.
+   const auto b = RandomSymmetric(SMatrixR3());
+   const SymmetricEigenDecomposition<Real> small_decomposition(b);
+   FOR(i, 3) EXPECT_NEAR(small_decomposition.Eigenvalues()[i], SymmetricEigenvalues(b)[i], 1e-14);
+   EXPECT_EQ(SymmetricEigenDecomposition<Real>(DynamicMatrix<Real>(1, 1, Three)).Eigenvalues()[0], Three);
+   EXPECT_EQ(SymmetricEigenDecomposition<Real>(DynamicMatrix<Real>()).size(), 0);
+}
+
+}
+
+#endif
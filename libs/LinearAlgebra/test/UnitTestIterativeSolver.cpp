@@ -0,0 +1,193 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../include/IterativeSolver.h"
+
+#ifdef DEBUG_MODE
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Iterative Solver Test Fixture
+***************************************************************************************************************************************************************/
+class IterativeSolverTest : public testing::Test
+{
+ public:
+   /** Finite-difference matrix of -u_xx - u_yy + c u_x on an n x n grid, which is symmetric positive-definite if c = 0. */
+   static CsrMatrix<Real>
+   ConvectionDiffusion(const size_t n, const Real c)
+   {
+      CooMatrix<Real> coo(n * n, n * n);
+      coo.Reserve(5 * n * n);
+      FOR(i, n)
+         FOR(j, n)
+         {
+            const size_t k = i * n + j;
+            coo.Append(k, k, 4.0);
+            if(i > 0)     coo.Append(k, k - n, -1.0);
+            if(i + 1 < n) coo.Append(k, k + n, -1.0);
+            if(j > 0)     coo.Append(k, k - 1, -1.0 - c);
+            if(j + 1 < n) coo.Append(k, k + 1, -1.0 + c);
+         }
+      return CsrMatrix<Real>(coo);
+   }
+
+   static Real
+   Residual(const CsrMatrix<Real>& matrix, const DynamicVector<Real>& rhs, const DynamicVector<Real>& solution)
+   {
+      const DynamicVector<Real> residual = rhs - matrix * solution;
+      return std::sqrt(InnerProduct(residual, residual) / InnerProduct(rhs, rhs));
+   }
+};
+
+/***************************************************************************************************************************************************************
+* Test Symmetric Positive-definite Systems
+***************************************************************************************************************************************************************/
+TEST_F(IterativeSolverTest, ConjugateGradient)
+{
+   const auto matrix = ConvectionDiffusion(60, Zero);
+   const MatrixOperator op(matrix);
+   DynamicVector<Real> rhs(matrix.nRows());
+   rhs.Randomise();
+
+   DynamicVector<Real> solution;
+   const auto report = ConjugateGradient(op, rhs, solution);
+   EXPECT_TRUE(report.isConverged);
+   EXPECT_LT(Residual(matrix, rhs, solution), 1e-8);
+   EXPECT_EQ(report.nOperatorProducts, report.nIterations + 1);
+   EXPECT_EQ(report.nPreconditionerProducts, 0);
+
+   const JacobiPreconditioner jacobi(matrix);
+   solution.clear();
+   const auto jacobi_report = ConjugateGradient(op, rhs, solution, &jacobi);
+   EXPECT_TRUE(jacobi_report.isConverged);
+   EXPECT_LT(Residual(matrix, rhs, solution), 1e-8);
+   EXPECT_EQ(jacobi_report.nPreconditionerProducts, jacobi_report.nIterations);
+
+   const IncompleteCholeskyPreconditioner cholesky(matrix);
+   solution.clear();
+   const auto cholesky_report = ConjugateGradient(op, rhs, solution, &cholesky);
+   EXPECT_TRUE(cholesky_report.isConverged);
+   EXPECT_LT(Residual(matrix, rhs, solution), 1e-8);
+   EXPECT_LT(cholesky_report.nIterations, report.nIterations);
+
+   // Restarting from the solution requires no iterations.
+   const auto restart_report = ConjugateGradient(op, rhs, solution, &cholesky);
+   EXPECT_TRUE(restart_report.isConverged);
+   EXPECT_EQ(restart_report.nIterations, 0);
+
+   // Dense and matrix-free operators.
+   const DynamicMatrix<Real> dense = ConvectionDiffusion(8, Zero).Dense();
+   DynamicVector<Real> small_rhs(64);
+   small_rhs.Randomise();
+   solution.clear();
+   EXPECT_TRUE(ConjugateGradient(MatrixOperator(dense), small_rhs, solution).isConverged);
+   EXPECT_LT(Residual(ConvectionDiffusion(8, Zero), small_rhs, solution), 1e-8);
+
+   const FunctionOperator<Real> laplacian(64, 64, [](const DynamicVector<Real>& x, DynamicVector<Real>& y)
+   {
+      FOR(k, 64) y[k] = 4.0 * x[k] - (k >= 8 ? x[k - 8] : Zero) - (k < 56 ? x[k + 8] : Zero) - (k % 8 ? x[k - 1] : Zero) - (k % 8 < 7 ? x[k + 1] : Zero);
+   });
+   solution.clear();
+   EXPECT_TRUE(ConjugateGradient(laplacian, small_rhs, solution).isConverged);
+   EXPECT_LT(Residual(ConvectionDiffusion(8, Zero), small_rhs, solution), 1e-8);
+}
+
+/***************************************************************************************************************************************************************
+* Test Non-symmetric Systems
+***************************************************************************************************************************************************************/
+TEST_F(IterativeSolverTest, NonSymmetric)
+{
+   const auto matrix = ConvectionDiffusion(50, 0.4);
+   const MatrixOperator op(matrix);
+   const IncompleteLUPreconditioner lu(matrix);
+   DynamicVector<Real> rhs(matrix.nRows());
+   rhs.Randomise();
+
+   DynamicVector<Real> solution;
+   const auto bicgstab_report = BiCGSTAB(op, rhs, solution);
+   EXPECT_TRUE(bicgstab_report.isConverged);
+   EXPECT_LT(Residual(matrix, rhs, solution), 1e-8);
+
+   solution.clear();
+   const auto preconditioned_bicgstab_report = BiCGSTAB(op, rhs, solution, &lu);
+   EXPECT_TRUE(preconditioned_bicgstab_report.isConverged);
+   EXPECT_LT(Residual(matrix, rhs, solution), 1e-8);
+   EXPECT_LT(preconditioned_bicgstab_report.nIterations, bicgstab_report.nIterations);
+
+   solution.clear();
+   const auto gmres_report = GMRES(op, rhs, solution);
+   EXPECT_TRUE(gmres_report.isConverged);
+   EXPECT_LT(Residual(matrix, rhs, solution), 1e-8);
+
+   solution.clear();
+   const auto preconditioned_gmres_report = GMRES(op, rhs, solution, &lu);
+   EXPECT_TRUE(preconditioned_gmres_report.isConverged);
+   EXPECT_LT(Residual(matrix, rhs, solution), 1e-8);
+   EXPECT_LT(preconditioned_gmres_report.nIterations, gmres_report.nIterations);
+
+   // GMRES converges exactly (up to rounding) within n iterations without restarts.
+   const auto small_matrix = ConvectionDiffusion(4, 0.4);
+   DynamicVector<Real> small_rhs(16);
+   small_rhs.Randomise();
+   solution.clear();
+   IterativeSettings settings;
+   settings.RelativeTolerance = 1e-12;
+   settings.Restart = 16;
+   const auto exact_report = GMRES(MatrixOperator(small_matrix), small_rhs, solution, nullptr, settings);
+   EXPECT_TRUE(exact_report.isConverged);
+   EXPECT_LE(exact_report.nIterations, 16);
+   EXPECT_LT(Residual(small_matrix, small_rhs, solution), 1e-11);
+}
+
+/***************************************************************************************************************************************************************
+* Test Solver Telemetry
+***************************************************************************************************************************************************************/
+TEST_F(IterativeSolverTest, Telemetry)
+{
+   const auto matrix = ConvectionDiffusion(30, Zero);
+   DynamicVector<Real> rhs(matrix.nRows());
+   rhs.Randomise();
+
+   DynamicVector<Real> solution;
+   size_t n_calls = 0;
+   IterativeSettings settings;
+   settings.isHistoryRecorded = true;
+   settings.Monitor = [&n_calls](size_t, Real){ return ++n_calls < 5; };
+   solution.clear();
+   const auto report = ConjugateGradient(MatrixOperator(matrix), rhs, solution, nullptr, settings);
+   EXPECT_FALSE(report.isConverged);
+   EXPECT_EQ(report.nIterations, 5);
+   EXPECT_EQ(n_calls, 5);
+   ASSERT_EQ(report.ResidualHistory.size(), 6);
+   EXPECT_EQ(report.ResidualHistory.front(), report.InitialResidual);
+   EXPECT_EQ(report.ResidualHistory.back(), report.FinalResidual);
+   EXPECT_LT(report.FinalResidual, report.InitialResidual);
+   EXPECT_GE(report.Time, Zero);
+
+   settings = {};
+   settings.MaxIterations = 3;
+   solution.clear();
+   const auto limited_report = GMRES(MatrixOperator(matrix), rhs, solution, nullptr, settings);
+   EXPECT_FALSE(limited_report.isConverged);
+   EXPECT_EQ(limited_report.nIterations, 3);
+   EXPECT_TRUE(limited_report.ResidualHistory.empty());
+}
+
+}
+
+#endif
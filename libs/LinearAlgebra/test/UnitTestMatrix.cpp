@@ -0,0 +1,198 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../include/Matrix.h"
+
+#ifdef DEBUG_MODE
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Matrix Test Fixture
+***************************************************************************************************************************************************************/
+class MatrixTest : public testing::Test
+{
+ public:
+   /** Reference product, computed entry by entry. */
+   template<class D0, class D1>
+   static DynamicMatrix<Real>
+   ReferenceProduct(const D0& a, const D1& b)
+   {
+      DynamicMatrix<Real> product(a.nRows(), b.nColumns(), Zero);
+      FOR(i, a.nRows()) FOR(j, b.nColumns()) FOR(p, a.nColumns()) product(i, j) += a(i, p) * b(p, j);
+      return product;
+   }
+
+   template<class D0, class D1>
+   static Real
+   MaxDifference(const D0& a, const D1& b)
+   {
+      Real difference(Zero);
+      FOR(i, a.size()) difference = Max(difference, std::abs(static_cast<Real>(a[i]) - static_cast<Real>(b[i])));
+      return difference;
+   }
+};
+
+/***************************************************************************************************************************************************************
+* Test Matrix Initialisation and Transposition
+***************************************************************************************************************************************************************/
+TEST_F(MatrixTest, Initialisation)
+{
+   constexpr StaticMatrix<int, 2, 3> static_matrix{{1, 2, 3}, {4, 5, 6}};
+   EXPECT_EQ(static_matrix.nRows(), 2);
+   EXPECT_EQ(static_matrix.nColumns(), 3);
+   EXPECT_EQ(static_matrix(1, 0), 4);
+   EXPECT_EQ(static_matrix[1], 4); // Column-major storage
+
+   constexpr auto static_transpose = static_matrix.Transpose();
+   static_assert(static_transpose(2, 1) == 6);
+
+   DynamicMatrix<Real> matrix(37, 45);
+   matrix.Randomise();
+   const auto transpose = matrix.Transpose();
+   EXPECT_EQ(transpose.nRows(), 45);
+   FOR(i, matrix.nRows()) FOR(j, matrix.nColumns()) EXPECT_EQ(transpose(j, i), matrix(i, j));
+
+   EXPECT_EQ(SMatrixR3::Identity()(2, 2), One);
+   EXPECT_EQ(DMatrixR::Identity(4)(3, 2), Zero);
+
+   // Entry-wise arithmetic preserves the matrix shape.
+   const DynamicMatrix<Real> sum = matrix + 2.0 * matrix;
+   EXPECT_EQ(sum.nRows(), 37);
+   EXPECT_EQ(sum.nColumns(), 45);
+   EXPECT_DOUBLE_EQ(sum(3, 4), 3.0 * matrix(3, 4));
+}
+
+/***************************************************************************************************************************************************************
+* Test Matrix Products
+***************************************************************************************************************************************************************/
+TEST_F(MatrixTest, StaticProducts)
+{
+   constexpr StaticMatrix<int, 2, 3> a{{1, 2, 3}, {4, 5, 6}};
+   constexpr StaticMatrix<int, 3, 2> b{{1, 0}, {0, 1}, {2, 2}};
+   constexpr auto product = a * b;
+   static_assert(product(0, 0) == 7 && product(0, 1) == 8 && product(1, 0) == 16 && product(1, 1) == 17);
+
+   constexpr StaticVector<int, 3> x{1, 1, 1};
+   constexpr auto y = a * x;
+   static_assert(y[0] == 6 && y[1] == 15);
+
+   SMatrixR4 rotation;
+   rotation.Randomise();
+   const auto square = rotation * rotation;
+   EXPECT_LT(MaxDifference(square, ReferenceProduct(rotation, rotation)), 1e-12);
+
+   // Static products too large to be unrolled.
+   StaticMatrix<Real, 7, 9> c;
+   StaticMatrix<Real, 9, 5> d;
+   c.Randomise();
+   d.Randomise();
+   EXPECT_LT(MaxDifference(c * d, ReferenceProduct(c, d)), 1e-12);
+
+   // Products of matrix-valued expressions are matrix products rather than entry-wise products.
+   const SMatrixR2 e{{1.0, 2.0}, {3.0, 4.0}};
+   const SMatrixR2 f{{5.0, 6.0}, {7.0, 8.0}};
+   const SMatrixR2 g{{1.0, 0.0}, {2.0, 1.0}};
+   const SMatrixR2 e_sum = e + f;
+   const SMatrixR2 f_difference = f - g;
+   EXPECT_EQ(MaxDifference(2.0 * e * f, SMatrixR2{{38.0, 44.0}, {86.0, 100.0}}), Zero);
+   EXPECT_EQ(MaxDifference((e + f) * g, ReferenceProduct(e_sum, g)), Zero);
+   EXPECT_EQ(MaxDifference(e * (f - g), ReferenceProduct(e, f_difference)), Zero);
+   EXPECT_EQ(MaxDifference((e + f) * StaticVector<Real, 2>{1.0, 1.0}, ReferenceProduct(e_sum, SMatrixR<2, 1>{{1.0}, {1.0}})), Zero);
+}
+
+TEST_F(MatrixTest, DynamicProducts)
+{
+   // Sizes that span several row blocks, and are not multiples of the register tiles.
+   DynamicMatrix<Real> a(150, 37), b(37, 130);
+   a.Randomise();
+   b.Randomise();
+
+   const auto product = a * b;
+   ASSERT_EQ(product.nRows(), 150);
+   ASSERT_EQ(product.nColumns(), 130);
+   EXPECT_LT(MaxDifference(product, ReferenceProduct(a, b)), 1e-12);
+
+   // Products with transposed operands, accumulated into an existing product.
+   const auto b_transpose = b.Transpose();
+   DynamicMatrix<Real> accumulated(product);
+   gemm::Multiply(150, 130, 37, a.Operand(), b_transpose.Operand(true), accumulated.data(), 150, true);
+   EXPECT_LT(MaxDifference(accumulated, product + product), 1e-12);
+
+   // Products spanning several depth and column blocks, of which a sample of columns is checked.
+   DynamicMatrix<Real> c(9, 263), d(263, 2100);
+   c.Randomise();
+   d.Randomise();
+   const auto deep_product = c * d;
+   for(size_t j = 0; j < 2100; j += 97)
+      FOR(i, 9)
+      {
+         Real entry(Zero);
+         FOR(p, 263) entry += c(i, p) * d(p, j);
+         EXPECT_NEAR(deep_product(i, j), entry, 1e-10);
+      }
+
+   // Single precision.
+   DynamicMatrix<float> a_float(70, 90), b_float(90, 80);
+   a_float.Randomise();
+   b_float.Randomise();
+   EXPECT_LT(MaxDifference(a_float * b_float, ReferenceProduct(a_float, b_float)), 1e-3);
+
+   // Mixed static and dynamic operands.
+   SMatrixR3 rotation = SMatrixR3::Identity();
+   DynamicMatrix<Real> points(3, 10, One);
+   EXPECT_EQ(MaxDifference(rotation * points, points), Zero);
+   EXPECT_DEATH(points * points, "");
+
+   // Products of matrix-valued expressions.
+   DynamicMatrix<Real> e(40, 30), f(30, 20), g(30, 20);
+   e.Randomise();
+   f.Randomise();
+   g.Randomise();
+   const DynamicMatrix<Real> e_scaled = 2.0 * e;
+   const DynamicMatrix<Real> e_sum = e + e;
+   const DynamicMatrix<Real> f_difference = f - g;
+   EXPECT_LT(MaxDifference(2.0 * e * f, ReferenceProduct(e_scaled, f)), 1e-12);
+   EXPECT_LT(MaxDifference((e + e) * f, ReferenceProduct(e_sum, f)), 1e-12);
+   EXPECT_LT(MaxDifference(e * (f - g), ReferenceProduct(e, f_difference)), 1e-12);
+}
+
+TEST_F(MatrixTest, MatrixVectorProducts)
+{
+   DynamicMatrix<Real> a(513, 300);
+   DynamicVector<Real> x(300);
+   a.Randomise();
+   x.Randomise();
+
+   DynamicMatrix<Real> x_matrix(300, 1);
+   FOR(i, x.size()) x_matrix[i] = x[i];
+   const auto reference = ReferenceProduct(a, x_matrix);
+
+   const DynamicVector<Real> y = a * x;
+   ASSERT_EQ(y.size(), 513);
+   EXPECT_LT(MaxDifference(y, reference), 1e-10);
+
+   // Row-major (i.e. transposed) operand.
+   const auto a_transpose = a.Transpose();
+   DynamicVector<Real> y_transpose(513);
+   gemm::MultiplyVector(513, 300, a_transpose.Operand(true), x.data(), y_transpose.data());
+   EXPECT_LT(MaxDifference(y_transpose, reference), 1e-10);
+}
+
+}
+
+#endif
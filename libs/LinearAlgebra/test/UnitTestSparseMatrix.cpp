@@ -0,0 +1,144 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../include/SparseMatrix.h"
+
+#ifdef DEBUG_MODE
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Sparse Matrix Test Fixture
+***************************************************************************************************************************************************************/
+class SparseMatrixTest : public testing::Test
+{
+ public:
+   /** Random sparse matrix with about n_entries entries (including duplicates), and its dense equivalent. */
+   static std::pair<CooMatrix<Real>, DynamicMatrix<Real>>
+   RandomMatrix(const size_t m, const size_t n, const size_t n_entries)
+   {
+      Random<size_t> row_randomiser(0, m - 1);
+      Random<size_t> column_randomiser(0, n - 1);
+      Random<Real> value_randomiser(-One, One);
+
+      CooMatrix<Real> coo(m, n);
+      DynamicMatrix<Real> dense(m, n, Zero);
+      coo.Reserve(n_entries);
+      FOR(k, n_entries)
+      {
+         const size_t i = row_randomiser();
+         const size_t j = column_randomiser();
+         const Real value = value_randomiser();
+         coo.Append(i, j, value);
+         dense(i, j) += value;
+      }
+      return {coo, dense};
+   }
+
+   template<class D0, class D1>
+   static Real
+   MaxDifference(const D0& a, const D1& b)
+   {
+      Real difference(Zero);
+      FOR(i, a.size()) difference = Max(difference, std::abs(a[i] - b[i]));
+      return difference;
+   }
+};
+
+/***************************************************************************************************************************************************************
+* Test Sparse Matrix Formats
+***************************************************************************************************************************************************************/
+TEST_F(SparseMatrixTest, Conversion)
+{
+   CooMatrix<Real> coo(3, 4);
+   coo.Append(2, 1, 1.0);
+   coo.Append(0, 3, 2.0);
+   coo.Append(2, 1, 0.5);
+   coo.Append(0, 0, 4.0);
+
+   const CsrMatrix<Real> csr(coo);
+   EXPECT_EQ(csr.nEntries(), 3);
+   EXPECT_TRUE(std::ranges::equal(csr.Offsets(), std::array<size_t, 4>{0, 2, 2, 3}));
+   EXPECT_TRUE(std::ranges::equal(csr.Indices(), std::array<size_t, 3>{0, 3, 1}));
+   EXPECT_EQ(csr(2, 1), 1.5);
+   EXPECT_EQ(csr(1, 1), Zero);
+
+   const CscMatrix<Real> csc(coo);
+   EXPECT_TRUE(std::ranges::equal(csc.Offsets(), std::array<size_t, 5>{0, 1, 2, 2, 3}));
+   EXPECT_EQ(csc(0, 3), 2.0);
+
+   // Large matrices, whose conversion is parallel and must be deterministic.
+   const auto [large_coo, dense] = RandomMatrix(600, 480, 40000);
+   const CsrMatrix<Real> large_csr(large_coo);
+   EXPECT_EQ(MaxDifference(large_csr.Dense(), dense), Zero);
+   EXPECT_TRUE(std::ranges::equal(large_csr.Values(), CsrMatrix<Real>(large_coo).Values()));
+   EXPECT_EQ(MaxDifference(CscMatrix<Real>(large_coo).Dense(), dense), Zero);
+   EXPECT_EQ(MaxDifference(BsrMatrix<Real, 3>(large_coo).Dense(), dense), Zero);
+   EXPECT_EQ(MaxDifference(BsrMatrix<Real, 4>(large_coo).Dense(), dense), Zero);
+}
+
+/***************************************************************************************************************************************************************
+* Test Sparse Matrix-vector Products
+***************************************************************************************************************************************************************/
+TEST_F(SparseMatrixTest, Products)
+{
+   const CooMatrix<Real> coo = RandomMatrix(600, 480, 40000).first;
+   DynamicVector<Real> x(480);
+   DynamicVector<Real> x_transpose(600);
+   x.Randomise();
+   x_transpose.Randomise();
+
+   // Reference products, accumulated from the entries directly.
+   DynamicVector<Real> reference(600, Zero);
+   DynamicVector<Real> reference_transpose(480, Zero);
+   FOR(k, coo.nEntries())
+   {
+      const size_t i = coo.Rows()[k];
+      const size_t j = coo.Columns()[k];
+      reference[i] += coo.Values()[k] * x[j];
+      reference_transpose[j] += coo.Values()[k] * x_transpose[i];
+   }
+
+   const CsrMatrix<Real> csr(coo);
+   const CscMatrix<Real> csc(coo);
+   const BsrMatrix<Real, 3> bsr(coo);
+   EXPECT_LT(MaxDifference(csr * x, reference), 1e-12);
+   EXPECT_LT(MaxDifference(csc * x, reference), 1e-12);
+   EXPECT_LT(MaxDifference(bsr * x, reference), 1e-12);
+
+   DynamicVector<Real> product;
+   csr.MultiplyTranspose(x_transpose, product);
+   EXPECT_LT(MaxDifference(product, reference_transpose), 1e-12);
+   csc.MultiplyTranspose(x_transpose, product);
+   EXPECT_LT(MaxDifference(product, reference_transpose), 1e-12);
+
+   // Accumulated products.
+   DynamicVector<Real> accumulated = csr * x;
+   bsr.Multiply(x, accumulated, true);
+   EXPECT_LT(MaxDifference(accumulated, 2.0 * reference), 1e-12);
+
+   // Matrices with empty rows.
+   CooMatrix<Real> diagonal(10, 10);
+   for(size_t i = 0; i < 10; i += 2) diagonal.Append(i, i, static_cast<Real>(i));
+   const DynamicVector<Real> ones(10, One);
+   const DynamicVector<Real> diagonal_product = CsrMatrix<Real>(diagonal) * ones;
+   FOR(i, 10) EXPECT_EQ(diagonal_product[i], i % 2 ? Zero : static_cast<Real>(i));
+}
+
+}
+
+#endif
@@ -400,6 +400,39 @@ TEST_F(VectorTest, VectorDivideEqual)
   }
 }
 
+TEST_F(VectorTest, FusedExpression)
+{
+  // Multi-term expressions
+  RealStaticVectorTest  = RealStaticVector + RealStaticVector * Two - RealStaticVector / Four;
+  RealDynamicVectorTest = RealDynamicVector + RealDynamicVector * Two - RealDynamicVector / Four;
+  IntDynamicVectorTest  = -(IntDynamicVector * 3 - IntDynamicVector) + 2 * IntDynamicVector;
+
+  FOR(i, ContainerSize)
+  {
+    EXPECT_DOUBLE_EQ(RealStaticVectorTest[i], RealStaticVector[i] + RealStaticVector[i] * Two - RealStaticVector[i] / Four);
+    EXPECT_DOUBLE_EQ(RealDynamicVectorTest[i], RealDynamicVector[i] + RealDynamicVector[i] * Two - RealDynamicVector[i] / Four);
+    EXPECT_EQ(IntDynamicVectorTest[i], 0);
+  }
+
+  // Expressions aliasing the assigned vector, and compound assignment from expressions
+  RealDynamicVectorTest = RealDynamicVector;
+  RealDynamicVectorTest = RealDynamicVectorTest * RealDynamicVectorTest + RealDynamicVectorTest;
+  RealStaticVectorTest  = RealStaticVector;
+  RealStaticVectorTest += RealStaticVector * Two;
+
+  FOR(i, ContainerSize)
+  {
+    EXPECT_DOUBLE_EQ(RealDynamicVectorTest[i], RealDynamicVector[i] * RealDynamicVector[i] + RealDynamicVector[i]);
+    EXPECT_DOUBLE_EQ(RealStaticVectorTest[i], Three * RealStaticVector[i]);
+  }
+
+  // Expression evaluation into a new vector and fused inner products
+  const DynamicVector<Real> sum = RealDynamicVector + RealDynamicVector;
+  EXPECT_EQ(sum.size(), ContainerSize);
+  const auto inner_product = Two * InnerProduct(RealDynamicVector, RealDynamicVector);
+  EXPECT_NEAR(InnerProduct(RealDynamicVector + RealDynamicVector, RealDynamicVector), inner_product, Small * inner_product);
+}
+
 /***************************************************************************************************************************************************************
 * Test Other Vector Operations
 ***************************************************************************************************************************************************************/
@@ -552,6 +585,228 @@ TEST_F(VectorTest, isAligned)
   EXPECT_THROW(isAligned(xAxis3, SVectorR3{One, Zero, Zero}, DegToRad(90.00001)), std::domain_error);
 }
 
+TEST_F(VectorTest, RotateAbout)
+{
+  const auto rotated2 = RotateAbout(xAxis2, HalfPi);
+  EXPECT_NEAR(rotated2[0], Zero, 1e-15);
+  EXPECT_DOUBLE_EQ(rotated2[1], One);
+  EXPECT_DOUBLE_EQ(RotateAbout(xAxis2, HalfPi, -zAxis3)[1], -One);
+
+  const auto rotated3 = RotateAbout(xAxis3, HalfPi, SVectorR3{Zero, Zero, Two});
+  EXPECT_NEAR(rotated3[0], Zero, 1e-15);
+  EXPECT_DOUBLE_EQ(rotated3[1], One);
+  EXPECT_DOUBLE_EQ(rotated3[2], Zero);
+
+  // A third of a turn about the diagonal permutes the axes.
+  const auto permuted = RotateAbout(xAxis3, TwoPi / Three, SVectorR3{One, One, One});
+  FOR(i, 3) EXPECT_NEAR(permuted[i], yAxis3[i], 1e-15);
+
+  const DynamicVector<Real> dynamic{One, Two, Three};
+  const auto dynamic_rotated = RotateAbout(dynamic, Pi, xAxis3);
+  EXPECT_DOUBLE_EQ(dynamic_rotated[0], One);
+  EXPECT_NEAR(dynamic_rotated[1], -Two, 1e-15);
+  EXPECT_NEAR(dynamic_rotated[2], -Three, 1e-15);
+}
+
+TEST_F(VectorTest, RotateTowards)
+{
+  const auto rotated2 = RotateTowards(xAxis2, QuarterPi, SVectorR2{-One, -One});
+  EXPECT_DOUBLE_EQ(rotated2[0], std::sqrt(Half));
+  EXPECT_DOUBLE_EQ(rotated2[1], -std::sqrt(Half));
+
+  const auto rotated3 = RotateTowards(SVectorR3{Zero, Two, Zero}, HalfPi, zAxis3);
+  EXPECT_NEAR(rotated3[1], Zero, 1e-15);
+  EXPECT_DOUBLE_EQ(rotated3[2], Two);
+}
+
+TEST_F(VectorTest, Quaternion)
+{
+  const auto q0 = Quaternion::AxisAngle(SVectorR3{One, Two, -One}, 0.7);
+  const auto q1 = Quaternion::AxisAngle(SVectorR3{-Three, One, Half}, 2.1);
+  EXPECT_TRUE(isNormalised(q0 * q1));
+
+  // Composition, and agreement with rotation matrices.
+  const SVectorR3 v{0.3, -1.2, 2.5};
+  const auto v_composed = (q0 * q1).Rotate(v);
+  const auto v_sequential = q0.Rotate(q1.Rotate(v));
+  const auto v_matrix = q0.RotationMatrix() * v;
+  const auto v_inverse = Inverse(q0).Rotate(q0.Rotate(v));
+  FOR(i, 3)
+  {
+    EXPECT_NEAR(v_composed[i], v_sequential[i], 1e-14);
+    EXPECT_NEAR(v_matrix[i], q0.Rotate(v)[i], 1e-14);
+    EXPECT_NEAR(v_inverse[i], v[i], 1e-14);
+  }
+
+  // Axis-angle conversion.
+  const auto [axis, angle] = q0.ToAxisAngle();
+  const auto normalised_axis = Normalise(SVectorR3{One, Two, -One});
+  EXPECT_NEAR(angle, 0.7, 1e-14);
+  FOR(i, 3) EXPECT_NEAR(axis[i], normalised_axis[i], 1e-14);
+  EXPECT_EQ(Quaternion().ToAxisAngle().second, Zero);
+
+  // Spherical interpolation has constant angular velocity, and takes the shorter arc.
+  const auto q_start = Quaternion::AxisAngle(zAxis3, 0.2);
+  const auto q_end = Quaternion::AxisAngle(zAxis3, 1.4);
+  EXPECT_NEAR(Slerp(q_start, q_end, 0.25).ToAxisAngle().second, 0.5, 1e-14);
+  EXPECT_NEAR(Slerp(q_start, -q_end, 0.25).ToAxisAngle().second, 0.5, 1e-14);
+  EXPECT_EQ(Slerp(q_start, q_end, Zero), q_start);
+  EXPECT_NEAR(Slerp(q_start, q_start, 0.5).w(), q_start.w(), 1e-15);
+}
+
+TEST_F(VectorTest, BatchedRotation)
+{
+  const size_t n = 100000;
+  SoAArray<Real, Real, Real> vectors(n);
+  SoAArray<Real, Real, Real, Real> rotations(n);
+  Random<Real> randomiser(-One, One);
+  FOR(i, n)
+  {
+    vectors[i] = std::make_tuple(randomiser(), randomiser(), randomiser());
+    const auto q = Quaternion::AxisAngle(SVectorR3{randomiser(), randomiser(), One}, Pi * randomiser());
+    rotations[i] = std::make_tuple(q.w(), q.x(), q.y(), q.z());
+  }
+  const auto original = vectors;
+
+  const auto q = Quaternion::AxisAngle(SVectorR3{One, -Two, Half}, 1.3);
+  RotateAbout(vectors, 1.3, SVectorR3{One, -Two, Half});
+  Real max_difference(Zero);
+  FOR(i, n)
+  {
+    const auto [x, y, z] = original[i];
+    const auto rotated = q.Rotate(SVectorR3{x, y, z});
+    const auto [x_batched, y_batched, z_batched] = vectors[i];
+    const SVectorR3 batched{x_batched, y_batched, z_batched};
+    FOR(j, 3) Maximise(max_difference, Abs(rotated[j] - batched[j]));
+  }
+  EXPECT_LT(max_difference, 1e-14);
+
+  vectors = original;
+  Rotate(vectors, rotations);
+  max_difference = Zero;
+  FOR(i, n)
+  {
+    const auto [x, y, z] = original[i];
+    const auto [w, qx, qy, qz] = rotations[i];
+    const auto rotated = Quaternion(w, qx, qy, qz).Rotate(SVectorR3{x, y, z});
+    const auto [x_batched, y_batched, z_batched] = vectors[i];
+    const SVectorR3 batched{x_batched, y_batched, z_batched};
+    FOR(j, 3) Maximise(max_difference, Abs(rotated[j] - batched[j]));
+  }
+  EXPECT_LT(max_difference, 1e-14);
+}
+
+TEST_F(VectorTest, BatchedOperations)
+{
+  const size_t n = 100000;
+  Random<Real> randomiser(-One, One);
+  DynamicArray<SVectorR3> vectors0(n), vectors1(n);
+  DynamicArray<SVectorR2> planar0(n), planar1(n);
+  DynamicArray<SVectorR4> vectors4(n);
+  SoAArray<Real, Real, Real> soa0(n), soa1(n);
+  FOR(i, n)
+  {
+    FOR(j, 3) vectors0[i][j] = randomiser();
+    FOR(j, 3) vectors1[i][j] = randomiser();
+    FOR(j, 2) planar0[i][j] = vectors0[i][j];
+    FOR(j, 2) planar1[i][j] = vectors1[i][j];
+    FOR(j, 4) vectors4[i][j] = randomiser();
+    soa0[i] = std::make_tuple(vectors0[i][0], vectors0[i][1], vectors0[i][2]);
+    soa1[i] = std::make_tuple(vectors1[i][0], vectors1[i][1], vectors1[i][2]);
+  }
+
+  DynamicArray<Real> products(n), soa_products(n), products4(n), magnitudes(n), angles(n), oriented_angles(n);
+  DynamicArray<SVectorR3> crosses(n), normalised(n);
+  DynamicArray<Bool> alignments(n);
+  SoAArray<Real, Real, Real> soa_crosses;
+  InnerProduct(vectors0, vectors1, products);
+  InnerProduct(soa0, soa1, soa_products);
+  InnerProduct(vectors4, vectors4, products4);
+  CrossProduct(vectors0, vectors1, crosses);
+  CrossProduct(soa0, soa1, soa_crosses);
+  Magnitude(vectors0, magnitudes);
+  Normalise(vectors0, normalised);
+  Normalise(soa0);
+  ComputeAngle(vectors0, vectors1, angles);
+  ComputeAngle<true>(planar0, planar1, oriented_angles);
+  isAligned(vectors0, vectors1, alignments, QuarterPi);
+
+  // Batched angles are computed with atan2, which is more accurate than acos for nearly parallel vectors.
+  FOR(i, n)
+  {
+    EXPECT_DOUBLE_EQ(products[i], InnerProduct(vectors0[i], vectors1[i]));
+    EXPECT_DOUBLE_EQ(soa_products[i], products[i]);
+    EXPECT_DOUBLE_EQ(products4[i], InnerProduct(vectors4[i], vectors4[i]));
+    EXPECT_DOUBLE_EQ(magnitudes[i], Magnitude(vectors0[i]));
+    EXPECT_NEAR(angles[i], ComputeAngle(vectors0[i], vectors1[i]), 1e-8);
+    EXPECT_NEAR(oriented_angles[i], ComputeAngle<true>(planar0[i], planar1[i]), 1e-8);
+    EXPECT_EQ(alignments[i], isAligned(vectors0[i], vectors1[i], QuarterPi));
+
+    const auto cross = CrossProduct(vectors0[i], vectors1[i]);
+    const auto [x, y, z] = soa_crosses[i];
+    const auto [x_normalised, y_normalised, z_normalised] = soa0[i];
+    const SVectorR3 soa_cross{x, y, z};
+    const SVectorR3 soa_normalised{x_normalised, y_normalised, z_normalised};
+    FOR(j, 3)
+    {
+      EXPECT_DOUBLE_EQ(crosses[i][j], cross[j]);
+      EXPECT_DOUBLE_EQ(soa_cross[j], cross[j]);
+      EXPECT_NEAR(normalised[i][j], Normalise(vectors0[i])[j], 1e-15);
+      EXPECT_DOUBLE_EQ(soa_normalised[j], normalised[i][j]);
+    }
+  }
+
+  // Zero vectors are not normalised, after all other vectors have been.
+  vectors0[1] = SVectorR3{Zero, Zero, Zero};
+  EXPECT_THROW(Normalise(vectors0, vectors0), std::invalid_argument);
+  EXPECT_TRUE(isNormalised(vectors0[0]));
+  EXPECT_EQ(Magnitude(vectors0[1]), Zero);
+  EXPECT_THROW(isAligned(vectors0, vectors1, alignments, Pi), std::domain_error);
+}
+
+TEST_F(VectorTest, SinglePrecision)
+{
+  // Single-precision inner products are accumulated in double precision, so that their error does not grow with the vector size.
+  const size_t n = 100000;
+  Random<float> randomiser(0.0f, 1.0f);
+  DVectorF v0(n), v1(n);
+  Real exact(Zero);
+  FOR(i, n)
+  {
+    v0[i] = randomiser();
+    v1[i] = randomiser();
+    exact += static_cast<Real>(v0[i]) * static_cast<Real>(v1[i]);
+  }
+  EXPECT_NEAR(InnerProduct(v0, v1), exact, 1e-6 * exact);
+
+  const SVectorF3 u{1.0f, 2.0f, 2.0f};
+  EXPECT_FLOAT_EQ(InnerProduct(u, u), 9.0f);
+  EXPECT_FLOAT_EQ(Magnitude(u), 3.0f);
+
+  const auto u_real = CastVector<Real>(u);
+  FOR(i, 3) EXPECT_EQ(u_real[i], static_cast<Real>(u[i]));
+  EXPECT_EQ(CastVector<float>(u_real), u);
+
+  // Batched rotations of single-precision coordinates agree with those in Real to single precision.
+  SoAArray<float, float, float> vectors(n);
+  SoAArray<Real, Real, Real> vectors_real(n);
+  FOR(i, n)
+  {
+    vectors[i] = std::make_tuple(v0[i], v1[i], 1.0f);
+    vectors_real[i] = std::make_tuple(v0[i], v1[i], One);
+  }
+  RotateAbout(vectors, 1.3, SVectorR3{One, -Two, Half});
+  RotateAbout(vectors_real, 1.3, SVectorR3{One, -Two, Half});
+  Real max_difference(Zero);
+  FOR(i, n)
+  {
+    const auto [x, y, z] = vectors[i];
+    const auto [x_real, y_real, z_real] = vectors_real[i];
+    Maximise(max_difference, Max(Abs(x - x_real), Max(Abs(y - y_real), Abs(z - z_real))));
+  }
+  EXPECT_LT(max_difference, 1e-6);
+}
+
 }
 
-#endif
\ No newline at end of file
+#endif
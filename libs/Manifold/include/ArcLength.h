@@ -0,0 +1,88 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "DataContainer/include/Array.h"
+#include "DataContainer/include/Parallel.h"
+
+#include <functional>
+
+/***************************************************************************************************************************************************************
+* Arc-Length Tables
+*
+* The arc length of a curve, i.e. the integral of its speed, is tabulated at the ends of equal intervals of its parameter, each integrated by 8-point
+* Gauss-Legendre quadrature. The number of intervals is doubled until the tabulated arc lengths change by less than a tolerance, or until a maximum number
+* of intervals, which bounds the memory used, is reached.
+*
+* The arc length at a parameter is then found in constant time, by integrating from the start of its interval, and the parameter at an arc length by a
+* binary search of the table followed by Newton's method (safeguarded by bisection) within its interval.
+***************************************************************************************************************************************************************/
+
+namespace aprn::mnfld {
+
+template<std::floating_point T = Real>
+class ArcLengthTable
+{
+ public:
+   static constexpr T DefaultTolerance = T(1000) * Epsilon<T>;
+
+   static constexpr size_t DefaultMaxIntervals = 1 << 16;
+
+   ArcLengthTable() = default;
+
+   /** Tabulate the arc length of a curve over the parameter range [first, last] from its speed, i.e. the magnitude of its tangent, which is kept for later
+       queries. The tolerance is relative to the total length. */
+   ArcLengthTable(std::function<T(const T)> speed, const T first, const T last, const T tolerance = DefaultTolerance,
+                  const size_t max_intervals = DefaultMaxIntervals);
+
+   /** Arc length from the start of the range to a parameter within it. */
+   T ArcLength(const T param) const;
+
+   /** Parameter at an arc length within [0, Length()], to within the tolerance. */
+   T Parameter(const T arc_length) const;
+
+   /** Accessors */
+   T Length() const { return Lengths_.back(); }
+
+   T First() const { return First_; }
+
+   T Last() const { return Last_; }
+
+   T Tolerance() const { return Tolerance_; }
+
+   size_t IntervalCount() const { return Lengths_.size() - 1; }
+
+   /** Check whether the tolerance was met within the maximum number of intervals. */
+   bool isConverged() const { return isConverged_; }
+
+ private:
+   void Tabulate(const size_t n_intervals, DArray<T>& lengths) const;
+
+   /** Arc length from one parameter to another, by Gauss-Legendre quadrature. */
+   T Integrate(const T start, const T end) const;
+
+   constexpr T IntervalSize() const { return (Last_ - First_) / static_cast<T>(IntervalCount()); }
+
+   std::function<T(const T)> Speed_;
+   DArray<T>                 Lengths_{T(Zero)};
+   T                         First_{Zero};
+   T                         Last_{Zero};
+   T                         Tolerance_{DefaultTolerance};
+   bool                      isConverged_{true};
+};
+
+}
+
+#include "ArcLength.tpp"
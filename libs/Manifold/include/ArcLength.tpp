@@ -0,0 +1,154 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+namespace aprn::mnfld {
+
+namespace detail {
+
+/** Nodes and weights of 8-point Gauss-Legendre quadrature on [-1, 1], of which the nodes are symmetric about zero. */
+constexpr std::array<Real, 4> GaussLegendreNodes{0.1834346424956498049, 0.5255324099163289858, 0.7966664774136267396, 0.9602898564975362317};
+constexpr std::array<Real, 4> GaussLegendreWeights{0.3626837833783619830, 0.3137066458778872873, 0.2223810344533744706, 0.1012285362903762592};
+
+/** Maximum number of Newton iterations when inverting arc lengths, which converge in a few iterations for all but pathological speeds. */
+constexpr size_t MaxArcLengthIterations = 50;
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* Arc-Length Table Implementation
+***************************************************************************************************************************************************************/
+template<std::floating_point T>
+ArcLengthTable<T>::ArcLengthTable(std::function<T(const T)> speed, const T first, const T last, const T tolerance, const size_t max_intervals)
+   : Speed_(std::move(speed)), First_(first), Last_(last), Tolerance_(tolerance)
+{
+   ASSERT(first <= last, "The parameter range [", first, ", ", last, "] of an arc-length table cannot be reversed.")
+   ASSERT(Positive(tolerance, -1) && max_intervals > 0, "An arc-length table requires a positive tolerance and number of intervals.")
+
+   size_t n_intervals = Min(size_t(16), max_intervals);
+   Tabulate(n_intervals, Lengths_);
+
+   DArray<T> finer_lengths;
+   while(true)
+   {
+      if(2 * n_intervals > max_intervals)
+      {
+         isConverged_ = false;
+         break;
+      }
+
+      Tabulate(2 * n_intervals, finer_lengths);
+      T change(Zero);
+      FOR(i, n_intervals + 1) change = Max(change, Abs(finer_lengths[2 * i] - Lengths_[i]));
+
+      Lengths_ = std::move(finer_lengths);
+      n_intervals *= 2;
+      if(change <= Tolerance_ * Length()) break;
+   }
+}
+
+template<std::floating_point T>
+T
+ArcLengthTable<T>::ArcLength(const T param) const
+{
+   if(!isBounded<true, true>(param, First_, Last_))
+      throw std::domain_error("The parameter must be in the range [" + ToString(First_) + ", " + ToString(Last_) + "] for this arc-length table.");
+
+   const size_t n_intervals = IntervalCount();
+   const T      interval    = IntervalSize();
+   const size_t index       = Min(static_cast<size_t>((param - First_) / interval), n_intervals - 1);
+   return Lengths_[index] + Integrate(First_ + static_cast<T>(index) * interval, param);
+}
+
+template<std::floating_point T>
+T
+ArcLengthTable<T>::Parameter(const T arc_length) const
+{
+   if(!isBounded<true, true>(arc_length, T(Zero), Length()))
+      throw std::domain_error("The arc length must be in the range [0, " + ToString(Length()) + "] for this arc-length table.");
+
+   // Find the interval containing the arc length, and interpolate its parameter linearly as the initial guess.
+   const size_t n_intervals = IntervalCount();
+   const T      interval    = IntervalSize();
+   const size_t index       = Min(static_cast<size_t>(std::upper_bound(Lengths_.begin(), Lengths_.end(), arc_length) - Lengths_.begin()), n_intervals) - 1;
+
+   const T start       = First_ + static_cast<T>(index) * interval;
+   const T end         = index + 1 == n_intervals ? Last_ : start + interval;
+   const T target      = arc_length - Lengths_[index];
+   const T length      = Lengths_[index + 1] - Lengths_[index];
+   const T tolerance   = Tolerance_ * Length();
+   T       param       = Positive(length, -1) ? start + target / length * (end - start) : start;
+   T       lower_bound = start;
+   T       upper_bound = end;
+
+   // Refine the parameter by Newton's method, bisecting the bracketing interval whenever a step leaves it.
+   FOR(i, detail::MaxArcLengthIterations)
+   {
+      const T residual = Integrate(start, param) - target;
+      if(Abs(residual) <= tolerance) break;
+
+      if(residual > T(Zero)) upper_bound = param;
+      else lower_bound = param;
+
+      const T speed = Speed_(param);
+      T next = Positive(speed, -1) ? param - residual / speed : lower_bound;
+      if(next <= lower_bound || next >= upper_bound) next = T(Half) * (lower_bound + upper_bound);
+      if(next == param) break;
+      param = next;
+   }
+   return param;
+}
+
+template<std::floating_point T>
+void
+ArcLengthTable<T>::Tabulate(const size_t n_intervals, DArray<T>& lengths) const
+{
+   const T interval = (Last_ - First_) / static_cast<T>(n_intervals);
+   lengths = DArray<T>(n_intervals + 1);
+
+   T* length = lengths.data();
+   length[0] = T(Zero);
+   parallel::For(n_intervals, [&](const size_t first, const size_t last)
+   {
+      FOR(i, first, last)
+      {
+         const T start = First_ + static_cast<T>(i) * interval;
+         length[i + 1] = Integrate(start, i + 1 == n_intervals ? Last_ : start + interval);
+      }
+   });
+   FOR(i, n_intervals) length[i + 1] += length[i];
+}
+
+template<std::floating_point T>
+T
+ArcLengthTable<T>::Integrate(const T start, const T end) const
+{
+   const T midpoint  = T(Half) * (start + end);
+   const T half_size = T(Half) * (end - start);
+
+   T integral(Zero);
+   FOR(i, detail::GaussLegendreNodes.size())
+   {
+      const T offset = half_size * static_cast<T>(detail::GaussLegendreNodes[i]);
+      integral += static_cast<T>(detail::GaussLegendreWeights[i]) * (Speed_(midpoint - offset) + Speed_(midpoint + offset));
+   }
+   return half_size * integral;
+}
+
+}
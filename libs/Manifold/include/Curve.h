@@ -14,32 +14,62 @@
 
 #pragma once
 
+#include "DataContainer/include/Parallel.h"
+#include "DataContainer/include/SIMD.h"
 #include "LinearAlgebra/include/Vector.h"
+#include "ArcLength.h"
+
+#include <span>
 
 namespace aprn::mnfld {
 
 /***************************************************************************************************************************************************************
 * Curve Class Definition
 ***************************************************************************************************************************************************************/
-template<size_t ambient_dim = 3>
+template<size_t ambient_dim = 3, std::floating_point T = Real>
 class Curve
 {
-   using Vector = SVectorR<ambient_dim>;
+   using Vector = SVector<T, ambient_dim>;
 
  public:
-   virtual constexpr Vector Point(const Real param) const = 0;
+   virtual constexpr Vector Point(const T param) const = 0;
 
-   virtual constexpr Vector Tangent(const Real param) const = 0;
+   virtual constexpr Vector Tangent(const T param) const = 0;
 
-   virtual constexpr Vector Normal(const Real param) const = 0;
+   virtual constexpr Vector Normal(const T param) const = 0;
 
-   virtual constexpr Real Length() const = 0;
+   virtual constexpr T Length() const = 0;
 
    constexpr Vector Binormal(const Vector& tangent, const Vector& normal) const;
 
    constexpr void MakeUnitSpeed() noexcept { UnitSpeed_ = true; }
 
+   /** Points, tangents and normals at many parameters, which are evaluated in parallel, into arrays of the same size as the parameters, or new arrays. */
+   void Points(std::span<const T> params, std::span<Vector> points) const;
+
+   void Tangents(std::span<const T> params, std::span<Vector> tangents) const;
+
+   void Normals(std::span<const T> params, std::span<Vector> normals) const;
+
+   DArray<Vector> Points(std::span<const T> params) const;
+
+   DArray<Vector> Tangents(std::span<const T> params) const;
+
+   DArray<Vector> Normals(std::span<const T> params) const;
+
+   /** Arc-length table of the curve over a range of its parameter, tabulated from the magnitude of its tangent. The table evaluates the curve, which it
+       must not outlive. */
+   ArcLengthTable<T> MakeArcLengthTable(const T first, const T last, const T tolerance = ArcLengthTable<T>::DefaultTolerance,
+                                        const size_t max_intervals = ArcLengthTable<T>::DefaultMaxIntervals) const;
+
  protected:
+   /** Batched evaluation, which evaluates the curve at each parameter in turn by default, and is overridden by curves with cheaper closed forms. */
+   virtual void ComputePoints(std::span<const T> params, std::span<Vector> points) const;
+
+   virtual void ComputeTangents(std::span<const T> params, std::span<Vector> tangents) const;
+
+   virtual void ComputeNormals(std::span<const T> params, std::span<Vector> normals) const;
+
    bool UnitSpeed_{false};
 };
 
@@ -49,83 +79,124 @@ class Curve
 
 /** Line
 ***************************************************************************************************************************************************************/
-template<size_t ambient_dim = 2>
-class Line : public Curve<ambient_dim>
+template<size_t ambient_dim = 2, std::floating_point T = Real>
+class Line : public Curve<ambient_dim, T>
 {
-   using Vector = SVectorR<ambient_dim>;
+   using Vector = SVector<T, ambient_dim>;
 
  public:
    constexpr Line(const Vector& direction, const Vector& point = Vector{});
 
-   constexpr Vector Point(const Real t) const override;
+   constexpr Vector Point(const T t) const override;
 
-   constexpr Vector Tangent(const Real t) const override;
+   constexpr Vector Tangent(const T t) const override;
 
-   constexpr Vector Normal(const Real t) const override;
+   constexpr Vector Normal(const T t) const override;
 
-   constexpr Real Length() const override { return InfFloat<>; }
+   constexpr T Length() const override { return InfFloat<T>; }
 
  protected:
+   void ComputePoints(std::span<const T> params, std::span<Vector> points) const override;
+
+   void ComputeTangents(std::span<const T> params, std::span<Vector> tangents) const override;
+
    Vector Direction;
    Vector Start;
-   Real   DirectionNorm_;
-   Real   Normaliser_;
+   T      DirectionNorm_;
+   T      Normaliser_;
 };
 
 /** Ray
 ***************************************************************************************************************************************************************/
-template<size_t ambient_dim = 2>
-class Ray final : public Line<ambient_dim>
+template<size_t ambient_dim = 2, std::floating_point T = Real>
+class Ray final : public Line<ambient_dim, T>
 {
-   using Vector = SVectorR<ambient_dim>;
+   using Vector = SVector<T, ambient_dim>;
 
  public:
    constexpr Ray(const Vector& direction, const Vector& start = Vector{});
 
-   constexpr Vector Point(const Real t) const override;
+   constexpr Vector Point(const T t) const override;
+
+   constexpr T Length() const override { return InfFloat<T>; }
 
-   constexpr Real Length() const override { return InfFloat<>; }
+ private:
+   void ComputePoints(std::span<const T> params, std::span<Vector> points) const override;
+
+   constexpr T CheckParam(const T t) const;
 };
 
 /** Line Segment
 ***************************************************************************************************************************************************************/
-template<size_t ambient_dim = 2>
-class LineSegment final : public Line<ambient_dim>
+template<size_t ambient_dim = 2, std::floating_point T = Real>
+class LineSegment final : public Line<ambient_dim, T>
 {
-   using Vector = SVectorR<ambient_dim>;
+   using Vector = SVector<T, ambient_dim>;
 
  public:
    constexpr LineSegment(const Vector& start, const Vector& end);
 
-   constexpr Vector Point(const Real t) const override;
+   constexpr Vector Point(const T t) const override;
+
+   constexpr T Length() const override { return this->DirectionNorm_; }
 
-   constexpr Real Length() const override { return this->DirectionNorm_; }
+ private:
+   void ComputePoints(std::span<const T> params, std::span<Vector> points) const override;
+
+   constexpr T CheckParam(const T t) const;
 };
 
 /** Line Segment Chain
 ***************************************************************************************************************************************************************/
-template<size_t ambient_dim = 2>
-class LineSegmentChain final : public Curve<ambient_dim>
+template<size_t ambient_dim = 2, std::floating_point T = Real>
+class LineSegmentChain final : public Curve<ambient_dim, T>
 {
-   using Vector  = SVectorR<ambient_dim>;
-   using Segment = LineSegment<ambient_dim>;
+   using Vector  = SVector<T, ambient_dim>;
+   using Segment = LineSegment<ambient_dim, T>;
 
  public:
    template<class D>
    LineSegmentChain(const Array<Vector, D>& vertices, bool is_closed = false);
 
-   constexpr Vector Point(const Real l) const override;
+   constexpr Vector Point(const T l) const override;
 
-   constexpr Vector Tangent(const Real t) const override;
+   /** Tangent of the segment containing the parameter, which is that of the preceding segment at a vertex. */
+   constexpr Vector Tangent(const T t) const override;
 
-   constexpr Vector Normal(const Real t) const override;
+   /** Unit normal, i.e. the unit tangent rotated anti-clockwise, which is only defined for planar chains, as the chain has no curvature between its
+       vertices. */
+   constexpr Vector Normal(const T t) const override;
 
-   constexpr Real Length() const override { return ChainLength_; }
+   constexpr T Length() const override { return ChainLength_; }
 
  private:
+   /** Batched evaluation, in which the segment of each parameter is searched for onwards from that of the previous one, so that sorted parameters cost
+       amortised constant time each, and unsorted parameters a binary search each. */
+   void ComputePoints(std::span<const T> params, std::span<Vector> points) const override;
+
+   void ComputeTangents(std::span<const T> params, std::span<Vector> tangents) const override;
+
+   void ComputeNormals(std::span<const T> params, std::span<Vector> normals) const override;
+
+   /** Arc length at a parameter, which must lie within the chain. */
+   constexpr T ArcLength(const T t) const;
+
+   /** Index of the segment containing an arc length, which is searched for by galloping onwards from the given segment, or by a binary search of the
+       preceding segments if the arc length precedes it. */
+   constexpr size_t SegmentIndex(const T arc_length, const size_t hint = 0) const;
+
+   constexpr Vector SegmentPoint(const size_t index, const T arc_length) const;
+
+   constexpr Vector SegmentTangent(const size_t index) const;
+
+   constexpr Vector SegmentNormal(const size_t index) const;
+
+   template<class F>
+   void Evaluate(std::span<const T> params, std::span<Vector> results, F&& function) const;
+
    DArray<Segment> Segments_;
-   DArray<Real>    CumulativeLengths_;
-   Real            ChainLength_;
+   DArray<T>       CumulativeLengths_;
+   T               ChainLength_;
    bool            Closed_;
 };
 
@@ -135,82 +206,117 @@ class LineSegmentChain final : public Curve<ambient_dim>
 
 /** Circle
 ***************************************************************************************************************************************************************/
-template<size_t ambient_dim = 2>
-class Circle : public Curve<ambient_dim>
+template<size_t ambient_dim = 2, std::floating_point T = Real>
+class Circle : public Curve<ambient_dim, T>
 {
-   using Vector = SVectorR<ambient_dim>;
+   using Vector = SVector<T, ambient_dim>;
 
  public:
-   Circle(const Real radius, const Vector& centre = Vector{});
+   Circle(const T radius, const Vector& centre = Vector{});
 
-   Circle(const Real radius, const Real start_angle, const Vector& centre = Vector{});
+   Circle(const T radius, const T start_angle, const Vector& centre = Vector{});
 
-   constexpr Vector Point(const Real t) const override;
+   constexpr Vector Point(const T t) const override;
 
-   constexpr Vector Tangent(const Real t) const override;
+   constexpr Vector Tangent(const T t) const override;
 
-   constexpr Vector Normal(const Real t) const override;
+   constexpr Vector Normal(const T t) const override;
 
-   constexpr Real Length() const override { return Length_; }
+   constexpr T Length() const override { return Length_; }
 
  protected:
-   constexpr Real Angle(const Real t) const;
+   /** Batched evaluation, whose sines and cosines are computed by vectorised kernels. */
+   void ComputePoints(std::span<const T> params, std::span<Vector> points) const override;
+
+   void ComputeTangents(std::span<const T> params, std::span<Vector> tangents) const override;
+
+   void ComputeNormals(std::span<const T> params, std::span<Vector> normals) const override;
+
+   constexpr void CheckParam(const T t) const;
+
+   constexpr T Angle(const T t) const;
 
    Vector Centre_;
-   Real   Radius_;
-   Real   StartAngle_{Zero};
-   Real   Normaliser_;
-   Real   Length_;
+   T      Radius_;
+   T      StartAngle_{Zero};
+   T      Normaliser_;
+   T      Length_;
 };
 
 /** Circular Arc
 ***************************************************************************************************************************************************************/
-template<size_t ambient_dim = 2>
-class Arc final : public Circle<ambient_dim>
+template<size_t ambient_dim = 2, std::floating_point T = Real>
+class Arc final : public Circle<ambient_dim, T>
 {
-   using Vector = SVectorR<ambient_dim>;
+   using Vector = SVector<T, ambient_dim>;
 
  public:
-   Arc(const Real radius, const Real angle, const Vector& centre = Vector{});
+   Arc(const T radius, const T angle, const Vector& centre = Vector{});
 
-   Arc(const Real radius, const Real start_angle, const Real end_angle, const Vector& centre = Vector{});
+   Arc(const T radius, const T start_angle, const T end_angle, const Vector& centre = Vector{});
 
-   constexpr Vector Point(const Real t) const override;
+   constexpr Vector Point(const T t) const override;
 
-   constexpr Vector Tangent(const Real t) const override;
+   constexpr Vector Tangent(const T t) const override;
 
-   constexpr Vector Normal(const Real t) const override;
+   constexpr Vector Normal(const T t) const override;
 
-   constexpr void CheckAngle(const Real t) const;
+   constexpr void CheckAngle(const T t) const;
 
  private:
-   Real EndAngle_;
+   void ComputePoints(std::span<const T> params, std::span<Vector> points) const override;
+
+   void ComputeTangents(std::span<const T> params, std::span<Vector> tangents) const override;
+
+   void ComputeNormals(std::span<const T> params, std::span<Vector> normals) const override;
+
+   T EndAngle_;
 };
 
 /** Ellipse
 ***************************************************************************************************************************************************************/
-template<size_t ambient_dim = 2>
-class Ellipse final : public Curve<ambient_dim>
+template<size_t ambient_dim = 2, std::floating_point T = Real>
+class Ellipse final : public Curve<ambient_dim, T>
 {
-   using Vector = SVectorR<ambient_dim>;
+   using Vector = SVector<T, ambient_dim>;
 
  public:
-   Ellipse(const Real radius_x, const Real radius_y, const Vector& centre = Vector{});
+   /** The length of the ellipse, and the angles at unit speed, are found from an arc-length table to within the given (relative) tolerance. */
+   Ellipse(const T radius_x, const T radius_y, const Vector& centre = Vector{}, const T tolerance = ArcLengthTable<T>::DefaultTolerance);
+
+   /** The parameter is the angle, t, in [0, 2*PI] by convention, or the arc length from t = 0 if unit speed, in [0, Length()]. */
+   constexpr Vector Point(const T t) const override;
 
-   constexpr Vector Point(const Real t) const override;
+   /** Derivatives with respect to the angle, as for circles, or with respect to arc length if unit speed. */
+   constexpr Vector Tangent(const T t) const override;
 
-   constexpr Vector Tangent(const Real t) const override;
+   constexpr Vector Normal(const T t) const override;
 
-   constexpr Vector Normal(const Real t) const override;
+   constexpr T Length() const override { return Length_; }
 
-   constexpr Real Length() const override { return Length_; }
+   const ArcLengthTable<T>& ArcLengths() const { return ArcLengths_; }
 
  private:
-   Vector Centre_;
-   Real   RadiusX_;
-   Real   RadiusY_;
-   Real   Length_;
+   void ComputePoints(std::span<const T> params, std::span<Vector> points) const override;
+
+   void ComputeTangents(std::span<const T> params, std::span<Vector> tangents) const override;
+
+   void ComputeNormals(std::span<const T> params, std::span<Vector> normals) const override;
+
+   constexpr void CheckParam(const T t) const;
+
+   constexpr T Angle(const T t) const;
+
+   /** Planar components of the tangent and normal, from the sine and cosine of the angle. */
+   constexpr std::pair<T, T> PlanarTangent(const T sin, const T cos) const;
+
+   constexpr std::pair<T, T> PlanarNormal(const T sin, const T cos) const;
 
+   Vector            Centre_;
+   T                 RadiusX_;
+   T                 RadiusY_;
+   ArcLengthTable<T> ArcLengths_;
+   T                 Length_;
 };
 
 /***************************************************************************************************************************************************************
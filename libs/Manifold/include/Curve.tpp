@@ -15,15 +15,154 @@
 #pragma once
 #include "LinearAlgebra/include/VectorOperations.h"
 
+#include <algorithm>
+#include <exception>
+
 namespace aprn::mnfld {
 
+namespace detail {
+
+/** Evaluate a function at each parameter, in parallel. As exceptions cannot leave parallel regions, the first exception thrown is rethrown once all
+    parameters have been evaluated. */
+template<typename T, typename V, class F>
+void
+EvaluateEach(std::span<const T> params, std::span<V> results, F&& function)
+{
+   std::exception_ptr exception;
+   parallel::For(params.size(), [&](const size_t first, const size_t last)
+   {
+      try { FOR(i, first, last) results[i] = function(params[i]); }
+      catch(...)
+      {
+         #pragma omp critical
+         if(!exception) exception = std::current_exception();
+      }
+   });
+   if(exception) std::rethrow_exception(exception);
+}
+
+/** Apply a function to the index, and the sine and cosine of the angle, of each parameter, in parallel. The sines and cosines are computed in chunks by
+    vectorised kernels. */
+template<typename T, class A, class F>
+void
+ForEachSinCos(std::span<const T> params, A&& angle, F&& function)
+{
+   constexpr size_t chunk_size = 256;
+   parallel::For(params.size(), [&](const size_t first, const size_t last)
+   {
+      T angles[chunk_size], sines[chunk_size], cosines[chunk_size];
+      for(size_t i = first; i < last; i += chunk_size)
+      {
+         const size_t n = Min(chunk_size, last - i);
+         FOR(j, n) angles[j] = angle(params[i + j]);
+         if constexpr(simd::SIMDType<T>) simd::SinCos(angles, sines, cosines, n);
+         else FOR(j, n)
+         {
+            sines[j]   = std::sin(angles[j]);
+            cosines[j] = std::cos(angles[j]);
+         }
+         FOR(j, n) function(i + j, sines[j], cosines[j]);
+      }
+   });
+}
+
+/** Store the planar vector (x, y) in a vector of any dimension, offset by another vector, if given. */
+template<size_t D, typename T>
+void
+StorePlanar(const T x, const T y, T* result, const T* offset = nullptr)
+{
+   const T xy[2]{x, y};
+   FOR(j, D) result[j] = (j < 2 ? xy[j] : T(Zero)) + (offset ? offset[j] : T(Zero));
+}
+
+}//detail
+
 /***************************************************************************************************************************************************************
 * Curve Class Implementation
 ***************************************************************************************************************************************************************/
 
-template<size_t D>
-constexpr SVectorR<D>
-Curve<D>::Binormal(const Vector& tangent, const Vector& normal) const { return CrossProduct(tangent, normal); }
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+Curve<D, T>::Binormal(const Vector& tangent, const Vector& normal) const { return CrossProduct(tangent, normal); }
+
+template<size_t D, std::floating_point T>
+void
+Curve<D, T>::Points(std::span<const T> params, std::span<Vector> points) const
+{
+   ASSERT(params.size() == points.size(), "The number of parameters ", params.size(), " must match the number of points ", points.size(), ".")
+   ComputePoints(params, points);
+}
+
+template<size_t D, std::floating_point T>
+void
+Curve<D, T>::Tangents(std::span<const T> params, std::span<Vector> tangents) const
+{
+   ASSERT(params.size() == tangents.size(), "The number of parameters ", params.size(), " must match the number of tangents ", tangents.size(), ".")
+   ComputeTangents(params, tangents);
+}
+
+template<size_t D, std::floating_point T>
+void
+Curve<D, T>::Normals(std::span<const T> params, std::span<Vector> normals) const
+{
+   ASSERT(params.size() == normals.size(), "The number of parameters ", params.size(), " must match the number of normals ", normals.size(), ".")
+   ComputeNormals(params, normals);
+}
+
+template<size_t D, std::floating_point T>
+DArray<SVector<T, D>>
+Curve<D, T>::Points(std::span<const T> params) const
+{
+   DArray<Vector> points(params.size());
+   ComputePoints(params, points);
+   return points;
+}
+
+template<size_t D, std::floating_point T>
+DArray<SVector<T, D>>
+Curve<D, T>::Tangents(std::span<const T> params) const
+{
+   DArray<Vector> tangents(params.size());
+   ComputeTangents(params, tangents);
+   return tangents;
+}
+
+template<size_t D, std::floating_point T>
+DArray<SVector<T, D>>
+Curve<D, T>::Normals(std::span<const T> params) const
+{
+   DArray<Vector> normals(params.size());
+   ComputeNormals(params, normals);
+   return normals;
+}
+
+template<size_t D, std::floating_point T>
+ArcLengthTable<T>
+Curve<D, T>::MakeArcLengthTable(const T first, const T last, const T tolerance, const size_t max_intervals) const
+{
+   return ArcLengthTable<T>([this](const T t){ return Magnitude(Tangent(t)); }, first, last, tolerance, max_intervals);
+}
+
+template<size_t D, std::floating_point T>
+void
+Curve<D, T>::ComputePoints(std::span<const T> params, std::span<Vector> points) const
+{
+   detail::EvaluateEach(params, points, [this](const T t){ return Point(t); });
+}
+
+template<size_t D, std::floating_point T>
+void
+Curve<D, T>::ComputeTangents(std::span<const T> params, std::span<Vector> tangents) const
+{
+   detail::EvaluateEach(params, tangents, [this](const T t){ return Tangent(t); });
+}
+
+template<size_t D, std::floating_point T>
+void
+Curve<D, T>::ComputeNormals(std::span<const T> params, std::span<Vector> normals) const
+{
+   detail::EvaluateEach(params, normals, [this](const T t){ return Normal(t); });
+}
 
 /***************************************************************************************************************************************************************
 * Linear/Piecewise Linear Curves
@@ -31,104 +170,253 @@ Curve<D>::Binormal(const Vector& tangent, const Vector& normal) const { return C
 
 /** Line
 ***************************************************************************************************************************************************************/
-template<size_t D>
-constexpr Line<D>::Line(const Vector& direction, const Vector& point)
-   : Direction(direction), Start(point), DirectionNorm_(Magnitude(Direction)), Normaliser_(One / DirectionNorm_) {}
+template<size_t D, std::floating_point T>
+constexpr Line<D, T>::Line(const Vector& direction, const Vector& point)
+   : Direction(direction), Start(point), DirectionNorm_(Magnitude(Direction)), Normaliser_(T(One) / DirectionNorm_) {}
 
-template<size_t D>
-constexpr SVectorR<D>
-Line<D>::Point(const Real t) const { return Start + t * (this->UnitSpeed_ ? Normaliser_ : One) * Direction; }
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+Line<D, T>::Point(const T t) const { return Start + t * (this->UnitSpeed_ ? Normaliser_ : T(One)) * Direction; }
 
-template<size_t D>
-constexpr SVectorR<D>
-Line<D>::Tangent([[maybe_unused]] const Real t) const { return (this->UnitSpeed_ ? Normaliser_ : One) * Direction; }
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+Line<D, T>::Tangent([[maybe_unused]] const T t) const { return (this->UnitSpeed_ ? Normaliser_ : T(One)) * Direction; }
 
-template<size_t D>
-constexpr SVectorR<D>
-Line<D>::Normal(const Real t) const
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+Line<D, T>::Normal(const T t) const
 {
    EXIT("TODO")
    return Direction;
 }
 
+template<size_t D, std::floating_point T>
+void
+Line<D, T>::ComputePoints(std::span<const T> params, std::span<Vector> points) const
+{
+   const T  scale     = this->UnitSpeed_ ? Normaliser_ : T(One);
+   const T* start     = Start.data();
+   const T* direction = Direction.data();
+   parallel::For(params.size(), [&](const size_t first, const size_t last)
+   {
+      FOR(i, first, last)
+      {
+         const T t = params[i] * scale;
+         T* point = points[i].data();
+         FOR(j, D) point[j] = start[j] + t * direction[j];
+      }
+   });
+}
+
+template<size_t D, std::floating_point T>
+void
+Line<D, T>::ComputeTangents(std::span<const T> params, std::span<Vector> tangents) const
+{
+   std::fill(tangents.begin(), tangents.end(), Tangent(T(Zero)));
+}
+
 /** Ray
 ***************************************************************************************************************************************************************/
-template<size_t D>
-constexpr Ray<D>::Ray(const Vector& direction, const Vector& start)
-   : Line<D>::Line(direction, start) {}
+template<size_t D, std::floating_point T>
+constexpr Ray<D, T>::Ray(const Vector& direction, const Vector& start)
+   : Line<D, T>::Line(direction, start) {}
 
-template<size_t D>
-constexpr SVectorR<D>
-Ray<D>::Point(const Real t) const
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+Ray<D, T>::Point(const T t) const { return Line<D, T>::Point(CheckParam(t)); }
+
+template<size_t D, std::floating_point T>
+void
+Ray<D, T>::ComputePoints(std::span<const T> params, std::span<Vector> points) const
 {
-   return Positive(t) ? Line<D>::Point(t) : throw std::domain_error("The parameter must be positive for rays.");
+   for(const T t : params) CheckParam(t);
+   Line<D, T>::ComputePoints(params, points);
 }
 
+template<size_t D, std::floating_point T>
+constexpr T
+Ray<D, T>::CheckParam(const T t) const { return Positive(t) ? t : throw std::domain_error("The parameter must be positive for rays."); }
+
 /** Segment
 ***************************************************************************************************************************************************************/
-template<size_t D>
-constexpr LineSegment<D>::LineSegment(const Vector& start, const Vector& end)
-   : Line<D>::Line(end - start, start) {}
+template<size_t D, std::floating_point T>
+constexpr LineSegment<D, T>::LineSegment(const Vector& start, const Vector& end)
+   : Line<D, T>::Line(end - start, start) {}
+
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+LineSegment<D, T>::Point(const T t) const { return Line<D, T>::Point(CheckParam(t)); }
+
+template<size_t D, std::floating_point T>
+void
+LineSegment<D, T>::ComputePoints(std::span<const T> params, std::span<Vector> points) const
+{
+   for(const T t : params) CheckParam(t);
+   Line<D, T>::ComputePoints(params, points);
+}
 
-template<size_t D>
-constexpr SVectorR<D>
-LineSegment<D>::Point(const Real t) const
+template<size_t D, std::floating_point T>
+constexpr T
+LineSegment<D, T>::CheckParam(const T t) const
 {
-   const Real max_bound = this->UnitSpeed_ ? Length() : One;
-   return isBounded<true, true>(t, Zero, max_bound) ? Line<D>::Point(t) :
+   const T max_bound = this->UnitSpeed_ ? Length() : T(One);
+   return isBounded<true, true>(t, T(Zero), max_bound) ? t :
           throw std::domain_error("The parameter must be in the range [0, " + ToString(max_bound) + "] for this segment.");
 }
 
 /** SegmentChain
 ***************************************************************************************************************************************************************/
-template<size_t Dim>
+template<size_t Dim, std::floating_point T>
 template<class D>
-LineSegmentChain<Dim>::LineSegmentChain(const Array<Vector, D>& vertex_list, const bool is_closed)
+LineSegmentChain<Dim, T>::LineSegmentChain(const Array<Vector, D>& vertex_list, const bool is_closed)
    : Closed_(is_closed)
 {
    const auto& vertices = vertex_list.Derived();
 
    Segments_.reserve(vertices.size());
    CumulativeLengths_.reserve(vertices.size());
-   ChainLength_ = Zero;
 
+   // Accumulate the lengths at (at least) double precision, so that single-precision chains of many segments do not drift.
+   AccumulationType<T> chain_length(Zero);
    FOR(i, vertices.size() - static_cast<size_t>(!Closed_))
    {
       Segments_.emplace_back(vertices[i], vertices[(i + 1) % vertices.size()]);
       Segments_.back().MakeUnitSpeed();
 
-      ChainLength_ += Segments_.back().Length();
-      CumulativeLengths_.emplace_back(ChainLength_);
+      chain_length += Segments_.back().Length();
+      CumulativeLengths_.emplace_back(static_cast<T>(chain_length));
    }
+   ChainLength_ = static_cast<T>(chain_length);
+}
+
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+LineSegmentChain<D, T>::Point(const T t) const
+{
+   const T arc_length = ArcLength(t);
+   return SegmentPoint(SegmentIndex(arc_length), arc_length);
+}
+
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+LineSegmentChain<D, T>::Tangent(const T t) const { return SegmentTangent(SegmentIndex(ArcLength(t))); }
+
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+LineSegmentChain<D, T>::Normal(const T t) const { return SegmentNormal(SegmentIndex(ArcLength(t))); }
+
+template<size_t D, std::floating_point T>
+void
+LineSegmentChain<D, T>::ComputePoints(std::span<const T> params, std::span<Vector> points) const
+{
+   Evaluate(params, points, [this](const size_t index, const T arc_length){ return SegmentPoint(index, arc_length); });
+}
+
+template<size_t D, std::floating_point T>
+void
+LineSegmentChain<D, T>::ComputeTangents(std::span<const T> params, std::span<Vector> tangents) const
+{
+   Evaluate(params, tangents, [this](const size_t index, const T){ return SegmentTangent(index); });
+}
+
+template<size_t D, std::floating_point T>
+void
+LineSegmentChain<D, T>::ComputeNormals(std::span<const T> params, std::span<Vector> normals) const
+{
+   // Non-planar chains throw here, rather than on any thread.
+   if constexpr(D != 2) SegmentNormal(0);
+
+   Evaluate(params, normals, [this](const size_t index, const T){ return SegmentNormal(index); });
+}
+
+template<size_t D, std::floating_point T>
+constexpr T
+LineSegmentChain<D, T>::ArcLength(const T t) const
+{
+   const T upper_bound = this->UnitSpeed_ ? ChainLength_ : T(One);
+   return isBounded<true, true, true>(t, T(Zero), upper_bound) ? t * (this->UnitSpeed_ ? T(One) : ChainLength_) :
+             throw std::domain_error("The parameter must be in the range [0, " + ToString(upper_bound) + "] for this segment.");
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-LineSegmentChain<D>::Point(const Real t) const
+template<size_t D, std::floating_point T>
+constexpr size_t
+LineSegmentChain<D, T>::SegmentIndex(const T arc_length, const size_t hint) const
 {
-   const Real upper_bound  = this->UnitSpeed_ ? ChainLength_ : One;
-   const Real param_length = isBounded<true, true, true>(t, Zero, upper_bound) ? t * (this->UnitSpeed_ ? One : ChainLength_) :
-                             throw std::domain_error("The parameter must be in the range [0, " + ToString(upper_bound) + "] for this segment.");
-   const auto iter  = std::find_if(CumulativeLengths_.begin(), CumulativeLengths_.end(), [param_length](auto l){ return param_length <= l; });
-   const auto index = std::distance(CumulativeLengths_.begin(), iter);
-   const Real param = param_length - (index != 0 ? CumulativeLengths_[index - 1] : Zero);
+   const T* const lengths = CumulativeLengths_.data();
+   const size_t n_segments = CumulativeLengths_.size();
 
-   return isBounded<true, true>(param, Zero, Segments_[index].Length()) ? Segments_[index].Point(param) :
+   // The segment is the first whose cumulative length is at least the arc length, which lies in [first, last].
+   size_t first(0), last(hint);
+   if(hint < n_segments && (hint == 0 || lengths[hint - 1] < arc_length))
+   {
+      first = hint;
+      for(size_t step = 1;; step *= 2)
+      {
+         last = first + step - 1;
+         if(last >= n_segments || arc_length <= lengths[last]) break;
+         first = last + 1;
+      }
+      last = Min(last, n_segments);
+   }
+   else last = Min(hint, n_segments);
+
+   // The arc length at the end of the chain can exceed the rounded cumulative lengths in the last bit.
+   const auto index = static_cast<size_t>(std::lower_bound(lengths + first, lengths + last, arc_length) - lengths);
+   return Min(index, n_segments - 1);
+}
+
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+LineSegmentChain<D, T>::SegmentPoint(const size_t index, const T arc_length) const
+{
+   // The rounded cumulative lengths can differ from the segment lengths in the last bit, which is clipped.
+   const auto& segment = Segments_.data()[index];
+   const T param = Min(arc_length - (index != 0 ? CumulativeLengths_.data()[index - 1] : T(Zero)), segment.Length());
+
+   return isBounded<true, true>(param, T(Zero), segment.Length()) ? segment.Point(param) :
           throw std::domain_error("The parameter for segment " + ToString(index) + " in the chain is out of bounds.");
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-LineSegmentChain<D>::Tangent(const Real t) const
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+LineSegmentChain<D, T>::SegmentTangent(const size_t index) const
 {
-   EXIT("TODO")
+   return (this->UnitSpeed_ ? T(One) : ChainLength_) * Segments_.data()[index].Tangent(T(Zero));
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-LineSegmentChain<D>::Normal(const Real t) const
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+LineSegmentChain<D, T>::SegmentNormal(const size_t index) const
 {
-   EXIT("TODO")
+   if constexpr(D == 2)
+   {
+      const auto tangent = Segments_.data()[index].Tangent(T(Zero));
+      return Vector{-tangent[1], tangent[0]};
+   }
+   else throw std::domain_error("The normal of a line segment chain is only defined in two dimensions.");
+}
+
+template<size_t D, std::floating_point T>
+template<class F>
+void
+LineSegmentChain<D, T>::Evaluate(std::span<const T> params, std::span<Vector> results, F&& function) const
+{
+   if(params.empty()) return;
+
+   // Check the parameters beforehand, so that evaluation cannot throw on any thread.
+   for(const T t : params) ArcLength(t);
+
+   const T scale = this->UnitSpeed_ ? T(One) : ChainLength_;
+   parallel::For(params.size(), [&](const size_t first, const size_t last)
+   {
+      size_t index(0);
+      FOR(i, first, last)
+      {
+         const T arc_length = params[i] * scale;
+         index = SegmentIndex(arc_length, index);
+         results[i] = function(index, arc_length);
+      }
+   });
 }
 
 /***************************************************************************************************************************************************************
@@ -137,87 +425,149 @@ LineSegmentChain<D>::Normal(const Real t) const
 
 /** Circle
 ***************************************************************************************************************************************************************/
-template<size_t D>
-Circle<D>::Circle(const Real radius, const Vector& centre)
+template<size_t D, std::floating_point T>
+Circle<D, T>::Circle(const T radius, const Vector& centre)
    : Circle(radius, Zero, centre) {}
 
-template<size_t D>
-Circle<D>::Circle(const Real radius, const Real start_angle, const Vector& centre)
-   : Centre_(centre), Radius_(radius), StartAngle_(start_angle), Normaliser_(One / Radius_) { ASSERT(Positive(radius), "A circle's radius cannot be negative.") }
+template<size_t D, std::floating_point T>
+Circle<D, T>::Circle(const T radius, const T start_angle, const Vector& centre)
+   : Centre_(centre), Radius_(radius), StartAngle_(start_angle), Normaliser_(T(One) / Radius_), Length_(T(TwoPi) * Radius_) { ASSERT(Positive(radius), "A circle's radius cannot be negative.") }
 
-template<size_t D>
-constexpr SVectorR<D>
-Circle<D>::Point(const Real t) const
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+Circle<D, T>::Point(const T t) const
 {
-   const Real max_bound = this->UnitSpeed_ ? TwoPi * Radius_ : One;
-   ASSERT((isBounded<true, true>(t, Zero, max_bound)), "The parameter exceeds the expected bounds.")
-
+   CheckParam(t);
    const auto theta = Angle(t);
-   return ToVector<D>(SVectorR3{Radius_ * std::cos(theta), Radius_ * std::sin(theta), Zero}) + Centre_;
+   return ToVector<D>(SVector3<T>{Radius_ * std::cos(theta), Radius_ * std::sin(theta), T(Zero)}) + Centre_;
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-Circle<D>::Tangent(const Real t) const
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+Circle<D, T>::Tangent(const T t) const
 {
    const auto theta = Angle(t);
-   return ToVector<D>(SVectorR3{-Radius_ * std::sin(theta), Radius_ * std::cos(theta), Zero});
+   return ToVector<D>(SVector3<T>{-Radius_ * std::sin(theta), Radius_ * std::cos(theta), T(Zero)});
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-Circle<D>::Normal(const Real t) const
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+Circle<D, T>::Normal(const T t) const
 {
    const auto theta = Angle(t);
-   return ToVector<D>(SVectorR3{-Radius_ * std::cos(theta), -Radius_ * std::sin(theta), Zero});
+   return ToVector<D>(SVector3<T>{-Radius_ * std::cos(theta), -Radius_ * std::sin(theta), T(Zero)});
 }
 
-template<size_t D>
-constexpr Real
-Circle<D>::Angle(const Real t) const { return StartAngle_ + t * (this->UnitSpeed_ ? Normaliser_ : TwoPi); }
+template<size_t D, std::floating_point T>
+void
+Circle<D, T>::ComputePoints(std::span<const T> params, std::span<Vector> points) const
+{
+   for(const T t : params) CheckParam(t);
+   detail::ForEachSinCos(params, [this](const T t){ return Angle(t); }, [&](const size_t i, const T sin, const T cos)
+   {
+      detail::StorePlanar<D>(Radius_ * cos, Radius_ * sin, points[i].data(), Centre_.data());
+   });
+}
+
+template<size_t D, std::floating_point T>
+void
+Circle<D, T>::ComputeTangents(std::span<const T> params, std::span<Vector> tangents) const
+{
+   detail::ForEachSinCos(params, [this](const T t){ return Angle(t); }, [&](const size_t i, const T sin, const T cos)
+   {
+      detail::StorePlanar<D>(-Radius_ * sin, Radius_ * cos, tangents[i].data());
+   });
+}
+
+template<size_t D, std::floating_point T>
+void
+Circle<D, T>::ComputeNormals(std::span<const T> params, std::span<Vector> normals) const
+{
+   detail::ForEachSinCos(params, [this](const T t){ return Angle(t); }, [&](const size_t i, const T sin, const T cos)
+   {
+      detail::StorePlanar<D>(-Radius_ * cos, -Radius_ * sin, normals[i].data());
+   });
+}
+
+template<size_t D, std::floating_point T>
+constexpr void
+Circle<D, T>::CheckParam(const T t) const
+{
+   const T max_bound = this->UnitSpeed_ ? T(TwoPi) * Radius_ : T(One);
+   ASSERT((isBounded<true, true>(t, T(Zero), max_bound)), "The parameter exceeds the expected bounds.")
+}
+
+template<size_t D, std::floating_point T>
+constexpr T
+Circle<D, T>::Angle(const T t) const { return StartAngle_ + t * (this->UnitSpeed_ ? Normaliser_ : T(TwoPi)); }
 
 /** Circular Arc
 ***************************************************************************************************************************************************************/
-template<size_t D>
-Arc<D>::Arc(const Real radius, const Real angle, const Vector& centre)
+template<size_t D, std::floating_point T>
+Arc<D, T>::Arc(const T radius, const T angle, const Vector& centre)
    : Arc(radius, Zero, angle, centre) {}
 
-template<size_t D>
-Arc<D>::Arc(const Real radius, const Real start_angle, const Real end_angle, const Vector& centre)
-   : Circle<D>(radius, start_angle, centre), EndAngle_(end_angle)
+template<size_t D, std::floating_point T>
+Arc<D, T>::Arc(const T radius, const T start_angle, const T end_angle, const Vector& centre)
+   : Circle<D, T>(radius, start_angle, centre), EndAngle_(end_angle)
 {
    ASSERT(Positive(radius), "An arc's radius cannot be negative.")
-   ASSERT((isBounded<true, true>(start_angle, Zero, TwoPi)), "An arc's start angle must be in the range [0, 2*PI].")
-   ASSERT((isBounded<true, true>(end_angle, Zero, TwoPi)), "An arc's end angle must be in the range [0, 2*PI].")
+   ASSERT((isBounded<true, true>(start_angle, T(Zero), T(TwoPi))), "An arc's start angle must be in the range [0, 2*PI].")
+   ASSERT((isBounded<true, true>(end_angle, T(Zero), T(TwoPi))), "An arc's end angle must be in the range [0, 2*PI].")
+   this->Length_ = radius * Abs(end_angle - start_angle);
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-Arc<D>::Point(const Real t) const
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+Arc<D, T>::Point(const T t) const
 {
    CheckAngle(t);
-   return Circle<D>::Point(t);
+   return Circle<D, T>::Point(t);
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-Arc<D>::Tangent(const Real t) const
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+Arc<D, T>::Tangent(const T t) const
 {
    CheckAngle(t);
-   return Circle<D>::Tangent(t);
+   return Circle<D, T>::Tangent(t);
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-Arc<D>::Normal(const Real t) const
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+Arc<D, T>::Normal(const T t) const
 {
    CheckAngle(t);
-   return Circle<D>::Normal(t);
+   return Circle<D, T>::Normal(t);
+}
+
+template<size_t D, std::floating_point T>
+void
+Arc<D, T>::ComputePoints(std::span<const T> params, std::span<Vector> points) const
+{
+   for(const T t : params) CheckAngle(t);
+   Circle<D, T>::ComputePoints(params, points);
 }
 
-template<size_t D>
+template<size_t D, std::floating_point T>
+void
+Arc<D, T>::ComputeTangents(std::span<const T> params, std::span<Vector> tangents) const
+{
+   for(const T t : params) CheckAngle(t);
+   Circle<D, T>::ComputeTangents(params, tangents);
+}
+
+template<size_t D, std::floating_point T>
+void
+Arc<D, T>::ComputeNormals(std::span<const T> params, std::span<Vector> normals) const
+{
+   for(const T t : params) CheckAngle(t);
+   Circle<D, T>::ComputeNormals(params, normals);
+}
+
+template<size_t D, std::floating_point T>
 constexpr void
-Arc<D>::CheckAngle(const Real t) const
+Arc<D, T>::CheckAngle(const T t) const
 {
    const auto theta = this->Angle(t);
    const auto min_max = std::minmax(this->StartAngle_, EndAngle_);
@@ -227,29 +577,115 @@ Arc<D>::CheckAngle(const Real t) const
 
 /** Ellipse
 ***************************************************************************************************************************************************************/
-template<size_t D>
-Ellipse<D>::Ellipse(const Real radius_x, const Real radius_y, const Vector& centre)
-   : Centre_(centre), RadiusX_(radius_x), RadiusY_(radius_y) { ASSERT(Positive(radius_x) && Positive(radius_y), "An ellipse's radii cannot be negative.") }
+template<size_t D, std::floating_point T>
+Ellipse<D, T>::Ellipse(const T radius_x, const T radius_y, const Vector& centre, const T tolerance)
+   : Centre_(centre), RadiusX_(radius_x), RadiusY_(radius_y),
+     ArcLengths_([radius_x, radius_y](const T t){ return std::hypot(radius_x * std::sin(t), radius_y * std::cos(t)); }, T(Zero), T(TwoPi), tolerance),
+     Length_(ArcLengths_.Length()) { ASSERT(Positive(radius_x) && Positive(radius_y), "An ellipse's radii cannot be negative.") }
+
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+Ellipse<D, T>::Point(const T t) const
+{
+   const auto theta = Angle(t);
+   return ToVector<D>(SVector3<T>{RadiusX_ * std::cos(theta), RadiusY_ * std::sin(theta), T(Zero)}) + Centre_;
+}
 
-template<size_t D>
-constexpr SVectorR<D>
-Ellipse<D>::Point(const Real t) const
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+Ellipse<D, T>::Tangent(const T t) const
 {
-   return ToVector<D>(SVectorR3{RadiusX_ * std::cos(t), RadiusY_ * std::sin(t), Zero}) + Centre_;
+   const auto theta = Angle(t);
+   const auto [x, y] = PlanarTangent(std::sin(theta), std::cos(theta));
+   return ToVector<D>(SVector3<T>{x, y, T(Zero)});
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-Ellipse<D>::Tangent(const Real t) const
+template<size_t D, std::floating_point T>
+constexpr SVector<T, D>
+Ellipse<D, T>::Normal(const T t) const
 {
-   EXIT("TODO")
+   const auto theta = Angle(t);
+   const auto [x, y] = PlanarNormal(std::sin(theta), std::cos(theta));
+   return ToVector<D>(SVector3<T>{x, y, T(Zero)});
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-Ellipse<D>::Normal(const Real t) const
+template<size_t D, std::floating_point T>
+void
+Ellipse<D, T>::ComputePoints(std::span<const T> params, std::span<Vector> points) const
 {
-   EXIT("TODO")
+   for(const T t : params) CheckParam(t);
+   detail::ForEachSinCos(params, [this](const T t){ return Angle(t); }, [&](const size_t i, const T sin, const T cos)
+   {
+      detail::StorePlanar<D>(RadiusX_ * cos, RadiusY_ * sin, points[i].data(), Centre_.data());
+   });
 }
 
-}
\ No newline at end of file
+template<size_t D, std::floating_point T>
+void
+Ellipse<D, T>::ComputeTangents(std::span<const T> params, std::span<Vector> tangents) const
+{
+   for(const T t : params) CheckParam(t);
+   detail::ForEachSinCos(params, [this](const T t){ return Angle(t); }, [&](const size_t i, const T sin, const T cos)
+   {
+      const auto [x, y] = PlanarTangent(sin, cos);
+      detail::StorePlanar<D>(x, y, tangents[i].data());
+   });
+}
+
+template<size_t D, std::floating_point T>
+void
+Ellipse<D, T>::ComputeNormals(std::span<const T> params, std::span<Vector> normals) const
+{
+   for(const T t : params) CheckParam(t);
+   detail::ForEachSinCos(params, [this](const T t){ return Angle(t); }, [&](const size_t i, const T sin, const T cos)
+   {
+      const auto [x, y] = PlanarNormal(sin, cos);
+      detail::StorePlanar<D>(x, y, normals[i].data());
+   });
+}
+
+template<size_t D, std::floating_point T>
+constexpr void
+Ellipse<D, T>::CheckParam(const T t) const
+{
+   if(this->UnitSpeed_ && !isBounded<true, true>(t, T(Zero), Length_))
+      throw std::domain_error("The parameter must be in the range [0, " + ToString(Length_) + "] for this ellipse.");
+}
+
+template<size_t D, std::floating_point T>
+constexpr T
+Ellipse<D, T>::Angle(const T t) const
+{
+   CheckParam(t);
+   return this->UnitSpeed_ ? ArcLengths_.Parameter(t) : t;
+}
+
+template<size_t D, std::floating_point T>
+constexpr std::pair<T, T>
+Ellipse<D, T>::PlanarTangent(const T sin, const T cos) const
+{
+   const T x = -RadiusX_ * sin;
+   const T y =  RadiusY_ * cos;
+   if(!this->UnitSpeed_) return {x, y};
+
+   const T speed = std::hypot(x, y);
+   return {x / speed, y / speed};
+}
+
+template<size_t D, std::floating_point T>
+constexpr std::pair<T, T>
+Ellipse<D, T>::PlanarNormal(const T sin, const T cos) const
+{
+   const T x = -RadiusX_ * cos;
+   const T y = -RadiusY_ * sin;
+   if(!this->UnitSpeed_) return {x, y};
+
+   // Second derivative with respect to arc length, i.e. the component of the second derivative normal to the tangent, divided by the squared speed.
+   const T dx = -RadiusX_ * sin;
+   const T dy =  RadiusY_ * cos;
+   const T speed_squared = dx * dx + dy * dy;
+   const T projection    = (x * dx + y * dy) / speed_squared;
+   return {(x - projection * dx) / speed_squared, (y - projection * dy) / speed_squared};
+}
+
+}
@@ -41,6 +41,22 @@ public:
 };
 
 
+/** Helix defined only by its scalar evaluations, for non-negative parameters, so that its batches fall back on them. */
+class Helix : public Curve<3, Real>
+{
+public:
+  SVectorR3 Point(const Real param) const override { Check(param); return {std::cos(param), std::sin(param), param}; }
+
+  SVectorR3 Tangent(const Real param) const override { Check(param); return {-std::sin(param), std::cos(param), One}; }
+
+  SVectorR3 Normal(const Real param) const override { Check(param); return {-std::cos(param), -std::sin(param), Zero}; }
+
+  Real Length() const override { return std::numeric_limits<Real>::infinity(); }
+
+private:
+  static void Check(const Real param) { if(param < Zero) throw std::domain_error("The helix parameter must be non-negative."); }
+};
+
 /***************************************************************************************************************************************************************
 * Linear/Piecewise Linear Curves
 ***************************************************************************************************************************************************************/
@@ -237,6 +253,67 @@ TEST_F(CurveTest, LineSegmentChain)
   FOR(i, 3) EXPECT_NEAR(p[i], vertices.front()[i], Ten * Small);
 }
 
+TEST_F(CurveTest, LineSegmentChainBatches)
+{
+  // Spiral of many segments of varying length.
+  const size_t n_vertices = 5000;
+  DynamicArray<SVectorR2> vertices(n_vertices);
+  FOR(i, n_vertices)
+  {
+    const Real theta = 0.01 * i * i / n_vertices;
+    vertices[i] = (One + theta) * SVectorR2{std::cos(theta), std::sin(theta)};
+  }
+  LineSegmentChain chain(vertices);
+
+  // Unsorted and sorted parameters, including the ends of the chain.
+  RandomReal.Reset(Zero, One);
+  DynamicArray<Real> params(20000);
+  FOR(i, params.size()) params[i] = RandomReal();
+  params[0] = Zero;
+  params[1] = One;
+  DynamicArray<Real> sorted_params(params);
+  std::sort(sorted_params.begin(), sorted_params.end());
+
+  for(const auto& parameters : {params, sorted_params})
+  {
+    const auto points   = chain.Points(parameters);
+    const auto tangents = chain.Tangents(parameters);
+    const auto normals  = chain.Normals(parameters);
+    ASSERT_EQ(points.size(), parameters.size());
+    FOR(i, parameters.size())
+    {
+      const auto point = chain.Point(parameters[i]);
+      const auto tangent = chain.Tangent(parameters[i]);
+      FOR(j, 2)
+      {
+        EXPECT_EQ(points[i][j], point[j]);
+        EXPECT_EQ(tangents[i][j], tangent[j]);
+      }
+      EXPECT_NEAR(Magnitude(tangents[i]), chain.Length(), 1.0e-12 * chain.Length());
+      EXPECT_NEAR(Magnitude(normals[i]), One, 1.0e-14);
+      EXPECT_NEAR(InnerProduct(tangents[i], normals[i]), Zero, 1.0e-12 * chain.Length());
+    }
+  }
+
+  // The tangent of a segment is parallel to it, and the parameter of each vertex belongs to the preceding segment.
+  chain.MakeUnitSpeed();
+  Real vertex_length(Zero);
+  FOR(i, 1, n_vertices)
+  {
+    const SVectorR2 direction = vertices[i] - vertices[i - 1];
+    vertex_length += Magnitude(direction);
+    const auto tangent = chain.Tangent(Min(vertex_length, chain.Length()));
+    EXPECT_NEAR(CrossProduct(ToVector<3>(tangent), ToVector<3>(direction))[2], Zero, 1.0e-14);
+    EXPECT_GT(InnerProduct(tangent, direction), Zero);
+  }
+  EXPECT_THROW(chain.Points(DynamicArray<Real>{Zero, -Small}), std::domain_error);
+
+  const DynamicArray<SVectorR3> vertices_3d{SVectorR3{Zero, Zero, Zero}, SVectorR3{One, Zero, Zero}, SVectorR3{One, One, One}};
+  const LineSegmentChain chain_3d(vertices_3d);
+  EXPECT_THROW(chain_3d.Normal(Half), std::domain_error);
+  EXPECT_THROW(chain_3d.Normals(params), std::domain_error);
+}
+
 /***************************************************************************************************************************************************************
 * Circular/Elliptical Curves
 ***************************************************************************************************************************************************************/
@@ -339,6 +416,193 @@ TEST_F(CurveTest, Ellipse)
   // Unit speed parametrised - requires root-finding and quadrature first.
 }
 
+TEST_F(CurveTest, SinglePrecision)
+{
+  DynamicArray<SVectorF2> vertices(4);
+  FOR(i, vertices.size()) vertices[i] = SVectorF2{static_cast<float>(i), static_cast<float>(i * i)};
+
+  LineSegmentChain chain(vertices);
+  const Real chain_length = std::sqrt(Two) + std::sqrt(Ten) + std::sqrt(26.0);
+  EXPECT_NEAR(chain.Length(), chain_length, 1e-5);
+
+  auto p = chain.Point(1.0f);
+  FOR(i, 2) EXPECT_FLOAT_EQ(p[i], vertices.back()[i]);
+
+  chain.MakeUnitSpeed();
+  p = chain.Point(1.0f);
+  FOR(i, 2) EXPECT_FLOAT_EQ(p[i], std::sqrt(0.5f));
+
+  Circle<2, float> circle(2.0f);
+  p = circle.Point(0.25f);
+  EXPECT_NEAR(p[0], Zero, 1e-6);
+  EXPECT_FLOAT_EQ(p[1], 2.0f);
+
+  Ellipse<2, float> ellipse(2.0f, 1.0f);
+  EXPECT_NEAR(ellipse.Length(), 9.688448220547676, 1e-5);
+  ellipse.MakeUnitSpeed();
+  p = ellipse.Point(0.25f * ellipse.Length());
+  EXPECT_NEAR(p[0], Zero, 1e-5);
+  EXPECT_FLOAT_EQ(p[1], 1.0f);
+}
+
+TEST_F(CurveTest, Batches)
+{
+  RandomReal.Reset(Zero, One);
+  DynamicArray<Real> params(1000);
+  FOR(i, params.size()) params[i] = RandomReal();
+  params[0] = Zero;
+  params[1] = One;
+
+  // Compare the batches of a curve with its scalar evaluations.
+  const auto check = [&](const auto& curve, const DynamicArray<Real>& parameters, const bool is_frame_checked)
+  {
+    const auto points = curve.Points(parameters);
+    ASSERT_EQ(points.size(), parameters.size());
+    DynamicArray<SVectorR3> tangents(parameters.size()), normals(parameters.size());
+    if(is_frame_checked)
+    {
+      curve.Tangents(parameters, tangents);
+      curve.Normals(parameters, normals);
+    }
+    FOR(i, parameters.size())
+    {
+      const auto point = curve.Point(parameters[i]);
+      FOR(j, 3) EXPECT_NEAR(points[i][j], point[j], 4.0 * Small * (One + Abs(point[j])));
+      if(!is_frame_checked) continue;
+
+      const auto tangent = curve.Tangent(parameters[i]);
+      const auto normal  = curve.Normal(parameters[i]);
+      FOR(j, 3)
+      {
+        EXPECT_NEAR(tangents[i][j], tangent[j], 4.0 * Small * (One + Abs(tangent[j])));
+        EXPECT_NEAR(normals[i][j], normal[j], 4.0 * Small * (One + Abs(normal[j])));
+      }
+    }
+  };
+
+  // Planar curves embedded in 3D, whose third components are those of their centres.
+  const SVectorR3 centre{One, -Two, Three};
+  Circle<3, Real> circle(Three, QuarterPi, centre);
+  check(circle, params, true);
+  circle.MakeUnitSpeed();
+  DynamicArray<Real> arc_lengths(params);
+  for(auto& s : arc_lengths) s *= TwoPi * Three;
+  check(circle, arc_lengths, true);
+
+  // The parameters of arcs span whole circles, of which this arc is half.
+  const Arc<3, Real> arc(Two, HalfPi, Pi + HalfPi, centre);
+  DynamicArray<Real> arc_params(params);
+  for(auto& t : arc_params) t *= 0.49;
+  check(arc, arc_params, true);
+
+  DynamicArray<Real> angles(params);
+  for(auto& t : angles) t = Ten * (t - Half);
+  const Ellipse<3, Real> ellipse(Four, Half, centre);
+  check(ellipse, angles, true);
+  const auto tangent = ellipse.Tangent(QuarterPi);
+  const auto point   = ellipse.Point(QuarterPi) - centre;
+  EXPECT_NEAR(InnerProduct(tangent, ellipse.Normal(QuarterPi)), (Four * Four - Half * Half) / Two, 4.0 * Small * Ten);
+  EXPECT_NEAR(CrossProduct(tangent, point)[2], -Two, 4.0 * Small);
+
+  Line<3, Real> line(SVectorR3{One, Two, Two}, centre);
+  check(line, angles, false);
+  line.MakeUnitSpeed();
+  check(line, angles, false);
+  EXPECT_EQ(line.Tangents(angles)[0], line.Tangent(Zero));
+
+  // Parameters are checked before any are evaluated.
+  const LineSegment<3, Real> segment(centre, SVectorR3{});
+  check(segment, params, false);
+  EXPECT_THROW(segment.Points(angles), std::domain_error);
+  const Ray<3, Real> ray(centre);
+  EXPECT_THROW(ray.Points(angles), std::domain_error);
+  check(ray, params, false);
+
+  // Curves without batched overloads fall back on their scalar evaluations, whose exceptions are rethrown.
+  const Helix helix;
+  check(helix, params, true);
+  EXPECT_THROW(helix.Points(angles), std::domain_error);
+  EXPECT_THROW(helix.Normals(angles), std::domain_error);
+
+  // Single precision, and parameter mismatches.
+  Circle<2, float> circle_f(2.0f);
+  DynamicArray<float> params_f(params.size());
+  FOR(i, params.size()) params_f[i] = static_cast<float>(params[i]);
+  const auto points_f = circle_f.Points(params_f);
+  FOR(i, params.size()) FOR(j, 2) EXPECT_NEAR(points_f[i][j], circle_f.Point(params_f[i])[j], 1.0e-6);
+  DynamicArray<SVectorR3> too_few(params.size() - 1);
+  EXPECT_DEATH(circle.Points(params, too_few), "");
+}
+
+TEST_F(CurveTest, ArcLengthTables)
+{
+  // Speed whose arc length, t + t^3 / 3, is known.
+  const ArcLengthTable<Real> table([](const Real t){ return One + t * t; }, Zero, Two);
+  EXPECT_TRUE(table.isConverged());
+  EXPECT_NEAR(table.Length(), Two + Eight / Three, 1.0e-13);
+  RandomReal.Reset(Zero, Two);
+  FOR(i, 100)
+  {
+    const Real t = RandomReal();
+    const Real arc_length = t + t * t * t / Three;
+    EXPECT_NEAR(table.ArcLength(t), arc_length, 1.0e-13);
+    EXPECT_NEAR(table.Parameter(arc_length), t, 1.0e-12);
+  }
+  EXPECT_DOUBLE_EQ(table.Parameter(table.Length()), Two);
+  EXPECT_THROW(table.ArcLength(2.01), std::domain_error);
+  EXPECT_THROW(table.Parameter(-Small), std::domain_error);
+
+  // The number of intervals, and hence memory, is bounded, even if the tolerance cannot be met.
+  const ArcLengthTable<Real> coarse_table([](const Real t){ return std::sqrt(t); }, Zero, One, Small, 64);
+  EXPECT_FALSE(coarse_table.isConverged());
+  EXPECT_LE(coarse_table.IntervalCount(), 64);
+  EXPECT_NEAR(coarse_table.Length(), Two / Three, 1.0e-6);
+
+  // Tables of general curves, e.g. a circular ellipse, parametrised by angle.
+  const Ellipse<3, Real> circle(Three, Three);
+  const Curve<3, Real>& curve = circle;
+  const auto circle_table = curve.MakeArcLengthTable(Zero, Pi);
+  EXPECT_NEAR(circle_table.Length(), Three * Pi, 1.0e-12);
+  EXPECT_NEAR(circle_table.Parameter(Three * QuarterPi), QuarterPi, 1.0e-12);
+  EXPECT_NEAR(circle.Length(), Six * Pi, 1.0e-12);
+
+  // Ellipse of eccentricity sqrt(3) / 2, whose circumference is 4 E(3/4), where E is the complete elliptic integral of the second kind.
+  const SVectorR2 centre{One, Two};
+  Ellipse<2, Real> ellipse(One, Half, centre);
+  EXPECT_NEAR(ellipse.Length(), 4.844224110273838, 1.0e-12);
+  EXPECT_NEAR(ellipse.ArcLengths().ArcLength(HalfPi), Quarter * ellipse.Length(), 1.0e-12);
+
+  // At unit speed, points are equally spaced along the ellipse, and tangents are unit vectors.
+  ellipse.MakeUnitSpeed();
+  const size_t n_points = 4000;
+  DynamicArray<Real> arc_lengths(n_points + 1);
+  FOR(i, n_points + 1) arc_lengths[i] = ellipse.Length() * static_cast<Real>(i) / n_points;
+  arc_lengths.back() = ellipse.Length();
+  const auto points   = ellipse.Points(arc_lengths);
+  const auto tangents = ellipse.Tangents(arc_lengths);
+  const auto normals  = ellipse.Normals(arc_lengths);
+  Real length(Zero);
+  FOR(i, n_points + 1)
+  {
+    FOR(j, 2) EXPECT_NEAR(points[i][j], ellipse.Point(arc_lengths[i])[j], 1.0e-14);
+    EXPECT_NEAR(Magnitude(tangents[i]), One, 1.0e-14);
+    EXPECT_NEAR(InnerProduct(tangents[i], normals[i]), Zero, 1.0e-13);
+    if(i > 0)
+    {
+      const Real chord = Magnitude(points[i] - points[i - 1]);
+      EXPECT_NEAR(chord, ellipse.Length() / n_points, 1.0e-7);
+      length += chord;
+    }
+  }
+  EXPECT_NEAR(length, ellipse.Length(), 1.0e-5);
+  FOR(j, 2) EXPECT_NEAR(points.back()[j], points[0][j], 1.0e-12);
+
+  // The curvature at the ends of the major axis is a / b^2.
+  EXPECT_NEAR(Magnitude(ellipse.Normal(Zero)), Four, 1.0e-12);
+  EXPECT_THROW(ellipse.Point(ellipse.Length() + 0.01), std::domain_error);
+  EXPECT_THROW(ellipse.Points(DynamicArray<Real>{Zero, -0.01}), std::domain_error);
+}
+
 }
 
 #endif
\ No newline at end of file
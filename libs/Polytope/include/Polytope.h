@@ -16,6 +16,7 @@
 
 #include "../../../include/Global.h"
 #include "../../DataContainer/include/Array.h"
+#include "../../DataContainer/include/SmallArray.h"
 #include "../../LinearAlgebra/include/Vector.h"
 #include "Categories.h"
 
@@ -70,7 +71,7 @@ struct DynamicPolytope : public Polytope<DynamicPolytope<cat, dim>, cat, dim>
    virtual ~DynamicPolytope() = 0;
 
    DynamicArray<SVectorR<dim>> Vertices;
-   DynamicArray<DynamicArray<size_t>> Faces;
+   DynamicArray<SmallArray<size_t, 4>> Faces;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,104 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "../../DataContainer/include/Array.h"
+#include "../../DataContainer/include/MultiArrayView.h"
+#include "../../DataContainer/include/Parallel.h"
+#include "../../LinearAlgebra/include/GEMM.h"
+#include "Tensor.h"
+
+#include <string>
+#include <string_view>
+
+/***************************************************************************************************************************************************************
+* Tensor Contraction
+*
+* Einstein-summation contractions of tensors, specified by subscripts as in NumPy, e.g. "ij,jk->ik" for a matrix product, "ijkl,kl->ij" for a double
+* contraction, "i,j->ij" for an outer product, "ji" for a transpose, or "ii" for a trace.
+*
+* Contractions of more than two tensors are evaluated pairwise, greedily contracting the pair whose contraction takes the fewest multiply-adds first. Each
+* pairwise contraction is lowered to a (batched) matrix product: the labels shared by both tensors and the output are batch indices, those shared by both
+* tensors only are contracted, and the others are the row and column indices of the product. Groups of labels whose strides are compatible are merged into
+* single matrix dimensions, so that tensors are multiplied in place by the blocked, multithreaded GEMM kernels. Tensors whose labels cannot be merged (or
+* which have labels to be summed out beforehand) are first gathered into contiguous blocks, which costs a single pass over their entries. Batches of small
+* products are distributed over threads.
+***************************************************************************************************************************************************************/
+
+namespace aprn {
+
+/** Contract tensors as specified by their subscripts, which give one letter per dimension of each tensor (separated by commas), and optionally the
+    letters of the output following "->". Letters repeated within a tensor take its diagonal, and letters absent from the output are summed over. If the
+    output is omitted, it has the letters that appear exactly once, in alphabetical order. A full contraction returns a rank-0 tensor. Throws an
+    invalid_argument exception for malformed subscripts, or for dimensions that do not match. */
+template<typename T, class... D>
+DynamicTensor<T>
+Einsum(const std::string_view subscripts, const Tensor<T, D>&... tensors);
+
+namespace detail {
+
+/** Parsed subscripts, i.e. the labels of each input tensor and of the output. */
+struct EinsumSubscripts
+{
+  DynamicArray<std::string> Inputs;
+  std::string               Output;
+};
+
+EinsumSubscripts
+ParseSubscripts(const std::string_view subscripts, const size_t n_tensors);
+
+/** Strided operand of a contraction, with one distinct label per dimension, whose entry at the multi-index (i_0, i_1, ...) is
+    data()[i_0 * Strides[0] + i_1 * Strides[1] + ...]. Intermediate results own their (contiguous) entries. */
+template<typename T>
+struct EinsumOperand
+{
+  std::string     Labels;
+  MultiIndex      Dimensions;
+  StrideArray     Strides;
+  const T*        External{nullptr};
+  DynamicArray<T> Storage;
+
+  const T*
+  data() const { return Storage.empty() ? External : Storage.data(); }
+
+  size_t
+  size() const { return Product(Dimensions.begin(), Dimensions.end()); }
+
+  size_t
+  Dimension(const char label) const { return Dimensions[Labels.find(label)]; }
+};
+
+/** Operand of a tensor, whose repeated labels are merged into a single (diagonal) dimension with the sum of their strides. */
+template<typename T, class D>
+EinsumOperand<T>
+MakeOperand(const Tensor<T, D>& tensor, const std::string& labels);
+
+/** Copy the entries of an operand to contiguous (column-major) storage with the given labels, summing over its other labels. */
+template<typename T>
+void
+Gather(const EinsumOperand<T>& operand, const std::string& labels, T* result);
+
+/** Contract two operands, keeping the given labels, which are all kept in the given order if it is fixed. The result is written to the given
+    destination if possible (i.e. if the labels are in a fixed order), and otherwise to storage owned by the result. */
+template<typename T>
+EinsumOperand<T>
+ContractPair(const EinsumOperand<T>& a, const EinsumOperand<T>& b, const std::string& kept, const bool is_order_fixed, T* destination = nullptr);
+
+}//detail
+
+}
+
+#include "../src/Einsum.cpp"
@@ -18,25 +18,203 @@
 #include "../../DataContainer/include/MultiArray.h"
 #include "../../DataContainer/include/NumericContainer.h"
 
+/***************************************************************************************************************************************************************
+* Tensors
+*
+* Tensors store their entries in column-major order, and are numeric containers, so that entry-wise arithmetic between tensors (and tensor views) builds
+* lazily evaluated expressions, which are only evaluated, in a single pass, when assigned to a tensor or view, or converted to a DynamicTensor.
+*
+* Tensor views are non-owning, strided views of the entries of a tensor, which permute, slice or broadcast its dimensions without copying any entries, and
+* compose with each other and with entry-wise arithmetic. E.g. the sum of a vector field u(i, x, y) and the transpose of another, v(i, y, x), scaled by a
+* scalar field s(x, y), is evaluated in a single pass, without any transient copies, by
+*
+*   w = (u.View() + v.Permute({0, 2, 1})) * s.Broadcast({3, nx, ny});
+***************************************************************************************************************************************************************/
+
 namespace aprn{
 
+template<typename T, class D> class Tensor;
+template<typename T, class A = std::allocator<T>> class DynamicTensor;
+
+namespace detail {
+
+/** Check whether two tensors (or tensor views) have the same rank and dimensions. */
+template<class X0, class X1>
+bool
+isShapeSame(const X0& tensor0, const X1& tensor1);
+
+/** Check whether every tensor (or tensor view) operand of an expression has the shape of the given tensor, as entry-wise operations only compare sizes. */
+template<class X, class E>
+bool
+isShapeConsistent(const X& tensor, const E& expression);
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* Tensor View Class
+***************************************************************************************************************************************************************/
+
+/** Non-owning view of the entries of a tensor (or of another view), whose dimensions may be permuted, sliced and broadcast. Copying a view copies the
+    reference to the entries, whereas assigning to a view (from a view, scalar, or expression) assigns its entries, through a temporary copy if the assigned
+    operands read any of them in a different order. The viewed entries must outlive the view. */
+template<typename T>
+class TensorView : public detail::NumericContainer<RemoveConst<T>, TensorView<T>>
+{
+  using Base = detail::NumericContainer<RemoveConst<T>, TensorView<T>>;
+
+public:
+  using value_type     = RemoveConst<T>;
+  using result_type    = DynamicTensor<value_type>;
+  using iterator       = MultiArrayViewIterator<T>;
+  using const_iterator = MultiArrayViewIterator<T>;
+
+  /** Constructors. */
+  TensorView() = default;
+
+  explicit TensorView(const MultiArrayView<T>& view)
+    : View_(view) {}
+
+  TensorView(const TensorView&) = default;
+
+  /** Conversion of a mutable view to a const view. */
+  template<typename T2>
+  requires (isTypeSame<const T2, T>() && !isTypeSame<T2, T>())
+  TensorView(const TensorView<T2>& other)
+    : View_(other.ArrayView()) {}
+
+  /** Entry-wise assignment. */
+  TensorView& operator=(const TensorView& other);
+
+  TensorView& operator=(const std::convertible_to<value_type> auto value);
+
+  template<class D>
+  TensorView& operator=(const Tensor<value_type, D>& tensor);
+
+  /** Expression assignment, whose tensor operands must all have the shape of the view. */
+  template<detail::NumericExpressionType E>
+  TensorView& operator=(const E& expression);
+
+  using Base::operator=;
+
+  /** Size and shape. */
+  size_t size() const noexcept { return View_.size(); }
+
+  size_t Rank() const noexcept { return View_.Rank(); }
+
+  size_t Dimension(const size_t dimension) const { return View_.Dimensions()[dimension]; }
+
+  /** Underlying strided view. */
+  const MultiArrayView<T>& ArrayView() const noexcept { return View_; }
+
+  /** Subscript operator overloads. The linear index follows the view's column-major ordering. */
+  T& operator()(const std::convertible_to<size_t> auto... multi_index) const { return View_(multi_index...); }
+
+  T& operator[](const size_t index) const { return View_[index]; }
+
+  /** Views of a slice at a fixed index of one dimension (which reduces the rank), and of a sub-block. */
+  TensorView Slice(const size_t dimension, const size_t index) const { return TensorView(View_.Slice(dimension, index)); }
+
+  TensorView Block(const MultiIndex& first, const MultiIndex& extents) const { return TensorView(View_.Block(first, extents)); }
+
+  /** Views with permuted dimensions, whose dimension i is dimension order[i] of this view, and with two dimensions swapped. */
+  TensorView Permute(const MultiIndex& order) const { return TensorView(View_.Permute(order)); }
+
+  TensorView Transpose(const size_t dimension0 = 0, const size_t dimension1 = 1) const;
+
+  /** View broadcast to the given dimensions, to which the view's dimensions are aligned from the last (see MultiArrayView::Broadcast). */
+  TensorView Broadcast(const MultiIndex& dimensions) const { return TensorView(View_.Broadcast(dimensions)); }
+
+  /** Iterators. */
+  iterator begin() const { return View_.begin(); }
+
+  iterator end() const { return View_.end(); }
+
+private:
+  MultiArrayView<T> View_;
+};
+
 /***************************************************************************************************************************************************************
 * Tensor Abstract Base Class
 ***************************************************************************************************************************************************************/
 template<typename T, class D>
 class Tensor : public detail::NumericContainer<T, Tensor<T, D>>
 {
+  using Base = detail::NumericContainer<T, Tensor<T, D>>;
+
 protected:
   constexpr Tensor();
 
 public:
-  /** Subscript operator overloads. */
+  using value_type  = T;
+  using result_type = DynamicTensor<T>;
+  using layout_type = layout::ColumnMajor;
+
+  /** Number of dimensions, the size of a given dimension, and the number of entries. */
+  constexpr size_t
+  Rank() const { return Derived().Entries.Rank(); }
+
+  constexpr size_t
+  Dimension(const size_t dimension) const { return Derived().Entries.Dimension(dimension); }
+
+  constexpr size_t
+  size() const { return static_cast<size_t>(end() - begin()); }
+
+  /** Entries, stored in column-major order. */
+  constexpr T*
+  data() { return Derived().Entries.data(); }
+
+  constexpr const T*
+  data() const { return Derived().Entries.data(); }
+
+  /** Subscript operator overloads. The linear index is the column-major storage index. */
   constexpr T&
   operator()(std::convertible_to<size_t> auto... multi_index);
 
   constexpr const T&
   operator()(const std::convertible_to<size_t> auto... multi_index) const;
 
+  constexpr T&
+  operator[](const size_t index);
+
+  constexpr const T&
+  operator[](const size_t index) const;
+
+  /** Views of all entries, and of permuted, sliced and broadcast dimensions (see TensorView). */
+  TensorView<T>
+  View() { return TensorView<T>(Derived().Entries.View()); }
+
+  TensorView<const T>
+  View() const { return TensorView<const T>(Derived().Entries.View()); }
+
+  TensorView<T>
+  Permute(const MultiIndex& order) { return View().Permute(order); }
+
+  TensorView<const T>
+  Permute(const MultiIndex& order) const { return View().Permute(order); }
+
+  TensorView<T>
+  Slice(const size_t dimension, const size_t index) { return View().Slice(dimension, index); }
+
+  TensorView<const T>
+  Slice(const size_t dimension, const size_t index) const { return View().Slice(dimension, index); }
+
+  TensorView<const T>
+  Broadcast(const MultiIndex& dimensions) const { return View().Broadcast(dimensions); }
+
+  /** Expression assignment, evaluated in-place in a single pass (unless a view operand reads the entries of this tensor in a different order, in which
+      case the expression is first evaluated into a temporary), whose tensor operands must all have the shape of this tensor. */
+  template<detail::NumericExpressionType E>
+  constexpr Tensor&
+  operator=(const E& expression);
+
+  /** View assignment, which copies the viewed entries (e.g. of a permuted or broadcast view) in the view's order, and whose dimensions must match. */
+  template<typename T2>
+  requires (isTypeSame<RemoveConst<T2>, T>())
+  Tensor&
+  operator=(const TensorView<T2>& view);
+
+  using Base::operator=;
+
   /** Assignment operator overloads. */
   constexpr D&
   operator=(const std::initializer_list<T>& _value_array) noexcept;
@@ -79,6 +257,8 @@ class StaticTensor : public Tensor<T, StaticTensor<T, dims...>>
 public:
   StaticTensor();
 
+  using Tensor<T, StaticTensor<T, dims...>>::operator=;
+
 private:
   StaticMultiArray<T, dims...> Entries;
 };
@@ -86,20 +266,39 @@ private:
 /***************************************************************************************************************************************************************
 * Dynamic Tensor Class
 ***************************************************************************************************************************************************************/
-template<typename T>
-class DynamicTensor : public Tensor<T, DynamicTensor<T>>
+template<typename T, class A>
+class DynamicTensor : public Tensor<T, DynamicTensor<T, A>>
 {
-  friend Tensor<T, DynamicTensor<T>>;
+  friend Tensor<T, DynamicTensor<T, A>>;
 
 public:
   DynamicTensor();
 
   DynamicTensor(const std::convertible_to<size_t> auto... _dimensions);
 
+  explicit DynamicTensor(const A& allocator);
+
+  /** Construction from a run-time list of dimensions, which may be empty for a rank-0 (scalar) tensor. */
+  explicit DynamicTensor(const MultiIndex& _dimensions);
+
+  /** Construction from a tensor view, e.g. to copy a permuted or broadcast view into owned entries. */
+  template<typename T2>
+  requires (isTypeSame<RemoveConst<T2>, T>())
+  DynamicTensor(const TensorView<T2>& view);
+
   inline void Resize(const std::convertible_to<size_t> auto... _dimensions) { Entries.Resize(_dimensions...); }
 
+  inline void Resize(const MultiIndex& _dimensions) { Entries.Resize(_dimensions); }
+
+  /** Resize to the dimensions of another tensor or tensor view, e.g. those of the leading operand of an expression evaluated into this tensor, or to those
+      of the tensor operands of an expression, which must all match. */
+  template<class X>
+  void Reshape(const X& other);
+
+  using Tensor<T, DynamicTensor<T, A>>::operator=;
+
 private:
-  DynamicMultiArray<T> Entries;
+  DynamicMultiArray<T, layout::ColumnMajor, A> Entries;
 };
 
 
@@ -0,0 +1,414 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#ifndef EINSUM_TEMPLATE_DEF
+#define EINSUM_TEMPLATE_DEF
+
+#include "../include/Einsum.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Tensor Contraction
+***************************************************************************************************************************************************************/
+template<typename T, class... D>
+DynamicTensor<T>
+Einsum(const std::string_view subscripts, const Tensor<T, D>&... tensors)
+{
+  STATIC_ASSERT(0 < sizeof...(D), "At least one tensor must be contracted.")
+
+  const auto parsed = detail::ParseSubscripts(subscripts, sizeof...(D));
+  const auto& output = parsed.Output;
+
+  DynamicArray<detail::EinsumOperand<T>> operands;
+  operands.reserve(sizeof...(D));
+  size_t i_tensor(0);
+  (operands.push_back(detail::MakeOperand(tensors, parsed.Inputs[i_tensor++])), ...);
+
+  // Check that each label has the same dimension in every tensor.
+  const auto label_dimension = [&](const char label)
+  {
+    for(const auto& operand : operands)
+      if(operand.Labels.find(label) != std::string::npos) return operand.Dimension(label);
+    return size_t(0);
+  };
+  for(const auto& operand : operands)
+    FOR(i, operand.Labels.size())
+      if(operand.Dimensions[i] != label_dimension(operand.Labels[i]))
+        throw std::invalid_argument("The dimensions of label '" + std::string(1, operand.Labels[i]) + "' do not match between tensors.");
+
+  MultiIndex dimensions(output.size());
+  FOR(i, output.size()) dimensions[i] = label_dimension(output[i]);
+  DynamicTensor<T> result(dimensions);
+
+  // Greedily contract the pair of operands whose contraction takes the fewest multiply-adds, keeping the labels of the output and of the other operands.
+  while(operands.size() > 2)
+  {
+    size_t p_min(0), q_min(1);
+    size_t min_cost(MaxInt<size_t>);
+    FOR(p, operands.size())
+      FOR(q, p + 1, operands.size())
+      {
+        size_t cost = operands[p].size();
+        for(const char label : operands[q].Labels)
+          if(operands[p].Labels.find(label) == std::string::npos) cost *= operands[q].Dimension(label);
+        if(cost < min_cost) std::tie(p_min, q_min, min_cost) = std::make_tuple(p, q, cost);
+      }
+
+    std::string kept = output;
+    FOR(r, operands.size())
+      if(r != p_min && r != q_min) kept += operands[r].Labels;
+
+    auto contracted = detail::ContractPair(operands[p_min], operands[q_min], kept, false);
+    operands.erase(operands.begin() + q_min);
+    operands.erase(operands.begin() + p_min);
+    operands.push_back(std::move(contracted));
+  }
+
+  if(operands.size() == 2)
+  {
+    const auto contracted = detail::ContractPair(operands[0], operands[1], output, true, result.data());
+    if(contracted.data() != result.data()) detail::Gather(contracted, output, result.data());
+  }
+  else detail::Gather(operands[0], output, result.data());
+
+  return result;
+}
+
+namespace detail {
+
+/***************************************************************************************************************************************************************
+* Subscript Parsing
+***************************************************************************************************************************************************************/
+inline EinsumSubscripts
+ParseSubscripts(const std::string_view subscripts, const size_t n_tensors)
+{
+  std::string spec;
+  for(const char c : subscripts)
+    if(!std::isspace(static_cast<unsigned char>(c))) spec += c;
+
+  const auto check_labels = [](const std::string& labels)
+  {
+    for(const char label : labels)
+      if(!std::isalpha(static_cast<unsigned char>(label))) throw std::invalid_argument("The subscript '" + std::string(1, label) + "' is not a letter.");
+  };
+
+  EinsumSubscripts parsed;
+  const auto arrow = spec.find("->");
+  const std::string inputs = spec.substr(0, arrow);
+  for(size_t first = 0;;)
+  {
+    const auto comma = inputs.find(',', first);
+    parsed.Inputs.push_back(inputs.substr(first, comma - first));
+    check_labels(parsed.Inputs.back());
+    if(comma == std::string::npos) break;
+    first = comma + 1;
+  }
+  if(parsed.Inputs.size() != n_tensors)
+    throw std::invalid_argument("The subscripts are given for " + ToString(parsed.Inputs.size()) + " tensors, rather than " + ToString(n_tensors) + ".");
+
+  if(arrow != std::string::npos)
+  {
+    parsed.Output = spec.substr(arrow + 2);
+    check_labels(parsed.Output);
+    FOR(i, parsed.Output.size())
+    {
+      const char label = parsed.Output[i];
+      if(parsed.Output.find(label, i + 1) != std::string::npos)
+        throw std::invalid_argument("The output subscript '" + std::string(1, label) + "' is repeated.");
+      if(inputs.find(label) == std::string::npos)
+        throw std::invalid_argument("The output subscript '" + std::string(1, label) + "' is not a subscript of any tensor.");
+    }
+  }
+  else
+  {
+    std::string labels = inputs;
+    std::sort(labels.begin(), labels.end());
+    FOR(i, labels.size())
+      if(labels[i] != ',' && std::count(labels.begin(), labels.end(), labels[i]) == 1) parsed.Output += labels[i];
+  }
+
+  return parsed;
+}
+
+/***************************************************************************************************************************************************************
+* Operands
+***************************************************************************************************************************************************************/
+template<typename T, class D>
+EinsumOperand<T>
+MakeOperand(const Tensor<T, D>& tensor, const std::string& labels)
+{
+  if(labels.size() != tensor.Rank())
+    throw std::invalid_argument("The tensor of rank " + ToString(tensor.Rank()) + " is given " + ToString(labels.size()) + " subscripts.");
+
+  EinsumOperand<T> operand;
+  operand.External = tensor.data();
+  std::ptrdiff_t stride(1);
+  FOR(i, labels.size())
+  {
+    const size_t dimension = tensor.Dimension(i);
+    const auto position = operand.Labels.find(labels[i]);
+    if(position == std::string::npos)
+    {
+      operand.Labels += labels[i];
+      operand.Dimensions.push_back(dimension);
+      operand.Strides.push_back(stride);
+    }
+    else if(operand.Dimensions[position] == dimension) operand.Strides[position] += stride;
+    else throw std::invalid_argument("The dimensions of the repeated label '" + std::string(1, labels[i]) + "' must be equal.");
+
+    stride *= static_cast<std::ptrdiff_t>(dimension);
+  }
+  return operand;
+}
+
+template<typename T>
+void
+Gather(const EinsumOperand<T>& operand, const std::string& labels, T* result)
+{
+  using A = AccumulationType<T>;
+
+  MultiIndex  dimensions, sum_dimensions;
+  StrideArray strides, sum_strides;
+  for(const char label : labels)
+  {
+    dimensions.push_back(operand.Dimension(label));
+    strides.push_back(operand.Strides[operand.Labels.find(label)]);
+  }
+  FOR(i, operand.Labels.size())
+    if(labels.find(operand.Labels[i]) == std::string::npos)
+    {
+      sum_dimensions.push_back(operand.Dimensions[i]);
+      sum_strides.push_back(operand.Strides[i]);
+    }
+
+  const T* const data = operand.data();
+  const size_t rank = dimensions.size();
+  const size_t sum_rank = sum_dimensions.size();
+  const size_t n_summed = Product(sum_dimensions.begin(), sum_dimensions.end());
+
+  // Walk the result contiguously, stepping through the operand's strides with an odometer, and sum over the other labels with a second odometer.
+  parallel::For(Product(dimensions.begin(), dimensions.end()), [&](const size_t first, const size_t last)
+  {
+    MultiIndex index(rank), sum_index(sum_rank, 0);
+    std::ptrdiff_t offset(0);
+    size_t remainder = first;
+    FOR(d, rank)
+    {
+      index[d] = remainder % dimensions[d];
+      remainder /= dimensions[d];
+      offset += static_cast<std::ptrdiff_t>(index[d]) * strides[d];
+    }
+
+    FOR(i, first, last)
+    {
+      if(sum_rank == 0) result[i] = data[offset];
+      else
+      {
+        A sum(0);
+        std::ptrdiff_t sum_offset = offset;
+        FOR(j, n_summed)
+        {
+          sum += data[sum_offset];
+          for(size_t d = 0; d < sum_rank; ++d)
+          {
+            sum_offset += sum_strides[d];
+            if(++sum_index[d] < sum_dimensions[d]) break;
+            sum_offset -= static_cast<std::ptrdiff_t>(sum_dimensions[d]) * sum_strides[d];
+            sum_index[d] = 0;
+          }
+        }
+        result[i] = static_cast<T>(sum);
+      }
+
+      for(size_t d = 0; d < rank; ++d)
+      {
+        offset += strides[d];
+        if(++index[d] < dimensions[d]) break;
+        offset -= static_cast<std::ptrdiff_t>(dimensions[d]) * strides[d];
+        index[d] = 0;
+      }
+    }
+  });
+}
+
+/** Operand with the given labels of another, whose entries are gathered contiguously (summing over its other labels). */
+template<typename T>
+EinsumOperand<T>
+Pack(const EinsumOperand<T>& operand, const std::string& labels)
+{
+  EinsumOperand<T> packed;
+  packed.Labels = labels;
+  std::ptrdiff_t stride(1);
+  for(const char label : labels)
+  {
+    packed.Dimensions.push_back(operand.Dimension(label));
+    packed.Strides.push_back(stride);
+    stride *= static_cast<std::ptrdiff_t>(packed.Dimensions.back());
+  }
+  packed.Storage.resize(packed.size());
+  Gather(operand, labels, packed.Storage.data());
+  return packed;
+}
+
+/** Sort labels into the storage order of an operand (i.e. by increasing stride), or into the order of a given string. */
+template<typename T>
+std::string
+StorageOrder(const EinsumOperand<T>& operand, std::string labels)
+{
+  std::stable_sort(labels.begin(), labels.end(), [&](const char a, const char b)
+                   { return operand.Strides[operand.Labels.find(a)] < operand.Strides[operand.Labels.find(b)]; });
+  return labels;
+}
+
+inline std::string
+OrderAs(const std::string& order, std::string labels)
+{
+  std::stable_sort(labels.begin(), labels.end(), [&](const char a, const char b) { return order.find(a) < order.find(b); });
+  return labels;
+}
+
+/** Check whether consecutive labels of an operand can be merged into a single dimension, i.e. whether each label's stride is the previous label's stride
+    times its dimension, and if so, get the stride of the merged dimension. */
+template<typename T>
+bool
+isMergeable(const EinsumOperand<T>& operand, const std::string& labels, size_t& stride)
+{
+  stride = 1;
+  if(labels.empty()) return true;
+
+  std::ptrdiff_t next_stride(0);
+  FOR(i, labels.size())
+  {
+    const auto position = operand.Labels.find(labels[i]);
+    if(i == 0) stride = static_cast<size_t>(operand.Strides[position]);
+    else if(operand.Strides[position] != next_stride) return false;
+    next_stride = operand.Strides[position] * static_cast<std::ptrdiff_t>(operand.Dimensions[position]);
+  }
+  return true;
+}
+
+/***************************************************************************************************************************************************************
+* Pairwise Contraction
+***************************************************************************************************************************************************************/
+template<typename T>
+EinsumOperand<T>
+ContractPair(const EinsumOperand<T>& a, const EinsumOperand<T>& b, const std::string& kept, const bool is_order_fixed, T* destination)
+{
+  // Classify the labels as the rows (of a only), columns (of b only), contracted and batch labels of a batched matrix product. Labels of a single operand
+  // that are not kept are summed out beforehand.
+  std::string rows, columns, contracted, batch;
+  bool is_a_summed(false), is_b_summed(false);
+  for(const char label : a.Labels)
+  {
+    const bool is_kept = kept.find(label) != std::string::npos;
+    if(b.Labels.find(label) != std::string::npos) (is_kept ? batch : contracted) += label;
+    else if(is_kept) rows += label;
+    else is_a_summed = true;
+  }
+  for(const char label : b.Labels)
+    if(a.Labels.find(label) == std::string::npos)
+    {
+      if(kept.find(label) != std::string::npos) columns += label;
+      else is_b_summed = true;
+    }
+
+  // Order the labels as in the result if its order is fixed, and otherwise as stored, so that they can be merged without packing.
+  contracted = StorageOrder(a, contracted);
+  rows    = is_order_fixed ? OrderAs(kept, rows)    : StorageOrder(a, rows);
+  columns = is_order_fixed ? OrderAs(kept, columns) : StorageOrder(b, columns);
+  batch   = is_order_fixed ? OrderAs(kept, batch)   : StorageOrder(a, batch);
+
+  // Matrix operands, packing either operand if its labels cannot be merged.
+  EinsumOperand<T> a_packed, b_packed;
+  const EinsumOperand<T>* pa = &a;
+  const EinsumOperand<T>* pb = &b;
+  size_t a_row_stride, a_column_stride, b_row_stride, b_column_stride;
+  if(is_a_summed || !isMergeable(a, rows, a_row_stride) || !isMergeable(a, contracted, a_column_stride))
+  {
+    a_packed = Pack(a, rows + contracted + batch);
+    pa = &a_packed;
+    isMergeable(a_packed, rows, a_row_stride);
+    isMergeable(a_packed, contracted, a_column_stride);
+  }
+  if(is_b_summed || !isMergeable(b, contracted, b_row_stride) || !isMergeable(b, columns, b_column_stride))
+  {
+    b_packed = Pack(b, contracted + columns + batch);
+    pb = &b_packed;
+    isMergeable(b_packed, contracted, b_row_stride);
+    isMergeable(b_packed, columns, b_column_stride);
+  }
+
+  // Result, with contiguous row, column and batch labels.
+  EinsumOperand<T> result;
+  result.Labels = rows + columns + batch;
+  std::ptrdiff_t stride(1);
+  for(const char label : result.Labels)
+  {
+    result.Dimensions.push_back(a.Labels.find(label) != std::string::npos ? a.Dimension(label) : b.Dimension(label));
+    result.Strides.push_back(stride);
+    stride *= static_cast<std::ptrdiff_t>(result.Dimensions.back());
+  }
+
+  if(is_order_fixed && destination && result.Labels == kept) result.External = destination;
+  else result.Storage.resize(result.size());
+  T* const c = result.Storage.empty() ? destination : result.Storage.data();
+
+  const auto product = [&](const EinsumOperand<T>& operand, const std::string& labels)
+  {
+    size_t n(1);
+    for(const char label : labels) n *= operand.Dimension(label);
+    return n;
+  };
+  const size_t m = product(a, rows);
+  const size_t n = product(b, columns);
+  const size_t k = product(a, contracted);
+  const size_t n_batches = product(a, batch);
+
+  const auto batch_offset = [&batch](const EinsumOperand<T>& operand, size_t index)
+  {
+    std::ptrdiff_t offset(0);
+    for(const char label : batch)
+    {
+      const auto position = operand.Labels.find(label);
+      offset += static_cast<std::ptrdiff_t>(index % operand.Dimensions[position]) * operand.Strides[position];
+      index /= operand.Dimensions[position];
+    }
+    return offset;
+  };
+
+  // Batches of products that are too small to be multithreaded themselves are distributed over threads.
+  const size_t n_multiply_adds = m * n * k;
+  const bool is_parallel = n_batches > 1 && n_multiply_adds < gemm::MinParallelProduct && n_multiply_adds * n_batches >= gemm::MinParallelProduct &&
+                           omp_get_max_threads() > 1 && !omp_in_parallel();
+
+  #pragma omp parallel for schedule(static) if(is_parallel)
+  for(size_t i = 0; i < n_batches; ++i)
+  {
+    const gemm::Operand<T> a_matrix{pa->data() + batch_offset(*pa, i), a_row_stride, a_column_stride};
+    const gemm::Operand<T> b_matrix{pb->data() + batch_offset(*pb, i), b_row_stride, b_column_stride};
+    gemm::Multiply(m, n, k, a_matrix, b_matrix, c + i * m * n, m);
+  }
+
+  return result;
+}
+
+}//detail
+
+}
+
+#endif
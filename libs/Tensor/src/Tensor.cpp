@@ -17,8 +17,65 @@
 
 #include "../include/Tensor.h"
 
+#include <numeric>
+
 namespace aprn{
 
+/***************************************************************************************************************************************************************
+* Tensor View Class
+***************************************************************************************************************************************************************/
+template<typename T>
+TensorView<T>&
+TensorView<T>::operator=(const TensorView& other)
+{
+  View_ = other.View_;
+  return *this;
+}
+
+template<typename T>
+TensorView<T>&
+TensorView<T>::operator=(const std::convertible_to<value_type> auto value)
+{
+  View_ = value;
+  return *this;
+}
+
+template<typename T>
+template<class D>
+TensorView<T>&
+TensorView<T>::operator=(const Tensor<value_type, D>& tensor)
+{
+  DEBUG_ASSERT(detail::isShapeSame(*this, tensor), "The view dimensions must match the tensor dimensions.")
+  View_ = tensor.View().ArrayView();
+  return *this;
+}
+
+template<typename T>
+template<detail::NumericExpressionType E>
+TensorView<T>&
+TensorView<T>::operator=(const E& expression)
+{
+  DEBUG_ASSERT(detail::isShapeConsistent(*this, expression), "The dimensions of the tensor operands must match the view dimensions.")
+
+  if(detail::isAliased(View_, expression))
+  {
+    const result_type result = expression;
+    View_ = result.View().ArrayView();
+  }
+  else Base::operator=(expression);
+  return *this;
+}
+
+template<typename T>
+TensorView<T>
+TensorView<T>::Transpose(const size_t dimension0, const size_t dimension1) const
+{
+  MultiIndex order(Rank());
+  std::iota(order.begin(), order.end(), size_t(0));
+  std::swap(order[dimension0], order[dimension1]);
+  return Permute(order);
+}
+
 /***************************************************************************************************************************************************************
 * Tensor Abstract Base Class
 ***************************************************************************************************************************************************************/
@@ -28,6 +85,35 @@ constexpr Tensor<T, D>::Tensor()
 
 }
 
+template<typename T, class D>
+template<detail::NumericExpressionType E>
+constexpr Tensor<T, D>&
+Tensor<T, D>::operator=(const E& expression)
+{
+  DEBUG_ASSERT(detail::isShapeConsistent(*this, expression), "The dimensions of the tensor operands must match the tensor dimensions.")
+
+  if(!std::is_constant_evaluated() && detail::isAliased(View().ArrayView(), expression))
+  {
+    const result_type result = expression;
+    std::copy(result.begin(), result.end(), begin());
+    return *this;
+  }
+  return Base::operator=(expression);
+}
+
+template<typename T, class D>
+template<typename T2>
+requires (isTypeSame<RemoveConst<T2>, T>())
+Tensor<T, D>&
+Tensor<T, D>::operator=(const TensorView<T2>& view)
+{
+  DEBUG_ASSERT(detail::isShapeSame(*this, view), "The tensor dimensions must match the view dimensions.")
+
+  auto entries = View().ArrayView();
+  entries = view.ArrayView();
+  return *this;
+}
+
 template<typename T, class D>
 constexpr T&
 Tensor<T, D>::operator()(std::convertible_to<size_t> auto... multi_index)
@@ -42,6 +128,22 @@ Tensor<T, D>::operator()(const std::convertible_to<size_t> auto... multi_index)
   return Derived().Entries(multi_index...);
 }
 
+template<typename T, class D>
+constexpr T&
+Tensor<T, D>::operator[](const size_t index)
+{
+  DEBUG_ASSERT(index < size(), "The index ", index, " must be lesser than the tensor size ", size(), ".")
+  return data()[index];
+}
+
+template<typename T, class D>
+constexpr const T&
+Tensor<T, D>::operator[](const size_t index) const
+{
+  DEBUG_ASSERT(index < size(), "The index ", index, " must be lesser than the tensor size ", size(), ".")
+  return data()[index];
+}
+
 template<typename T, class D>
 constexpr D&
 Tensor<T, D>::operator=(const std::initializer_list<T>& _value_array) noexcept
@@ -68,14 +170,72 @@ StaticTensor<T, dims...>::StaticTensor()
 /***************************************************************************************************************************************************************
 * Dynamic Tensor Class
 ***************************************************************************************************************************************************************/
-template<typename T>
-DynamicTensor<T>::DynamicTensor()
+template<typename T, class A>
+DynamicTensor<T, A>::DynamicTensor()
   : Entries() {}
 
-template<typename T>
-DynamicTensor<T>::DynamicTensor(const std::convertible_to<size_t> auto... _dimensions)
+template<typename T, class A>
+DynamicTensor<T, A>::DynamicTensor(const std::convertible_to<size_t> auto... _dimensions)
   : Entries(_dimensions...) {}
 
+template<typename T, class A>
+DynamicTensor<T, A>::DynamicTensor(const A& allocator)
+  : Entries(allocator) {}
+
+template<typename T, class A>
+DynamicTensor<T, A>::DynamicTensor(const MultiIndex& _dimensions)
+  : Entries(_dimensions) {}
+
+template<typename T, class A>
+template<typename T2>
+requires (isTypeSame<RemoveConst<T2>, T>())
+DynamicTensor<T, A>::DynamicTensor(const TensorView<T2>& view)
+{
+  Reshape(view);
+  *this = view;
+}
+
+template<typename T, class A>
+template<class X>
+void
+DynamicTensor<T, A>::Reshape(const X& other)
+{
+  if constexpr(detail::NumericExpressionType<X>)
+  {
+    Reshape(other.Leading());
+    DEBUG_ASSERT(detail::isShapeConsistent(*this, other), "The dimensions of the tensor operands of the expression must match.")
+  }
+  else
+  {
+    MultiIndex dimensions(other.Rank());
+    FOR(i, dimensions.size()) dimensions[i] = other.Dimension(i);
+    Entries.Resize(dimensions);
+  }
+}
+
+/***************************************************************************************************************************************************************
+* Tensor Shape Functions
+***************************************************************************************************************************************************************/
+template<class X0, class X1>
+bool
+detail::isShapeSame(const X0& tensor0, const X1& tensor1)
+{
+  if(tensor0.Rank() != tensor1.Rank()) return false;
+  FOR(i, tensor0.Rank()) if(tensor0.Dimension(i) != tensor1.Dimension(i)) return false;
+  return true;
+}
+
+template<class X, class E>
+bool
+detail::isShapeConsistent(const X& tensor, const E& expression)
+{
+  if constexpr(requires { expression.Lhs(); expression.Rhs(); })
+    return isShapeConsistent(tensor, expression.Lhs()) && isShapeConsistent(tensor, expression.Rhs());
+  else if constexpr(NumericExpressionType<E>) return isShapeConsistent(tensor, expression.Operand());
+  else if constexpr(requires { expression.Rank(); expression.Dimension(0); }) return isShapeSame(tensor, expression);
+  else return true;
+}
+
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,258 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../include/Einsum.h"
+#include "../include/Tensor.h"
+
+#ifdef DEBUG_MODE
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Tensor Test Fixture
+***************************************************************************************************************************************************************/
+class TensorTest : public testing::Test
+{
+ public:
+   Random<Real> RandomReal;
+
+   TensorTest()
+     : RandomReal(-One, One) {}
+
+   template<class D>
+   void
+   Randomise(Tensor<Real, D>& tensor)
+   {
+      FOR(i, tensor.size()) tensor.data()[i] = RandomReal();
+   }
+};
+
+/***************************************************************************************************************************************************************
+* Tensor Contraction Tests
+***************************************************************************************************************************************************************/
+TEST_F(TensorTest, MatrixContractions)
+{
+  const size_t m = 37, n = 41, k = 53;
+  DynamicTensor<Real> a(m, k), b(k, n);
+  Randomise(a);
+  Randomise(b);
+
+  const auto product = Einsum("ij,jk->ik", a, b);
+  const auto implicit_product = Einsum("ij,jk", a, b);
+  const auto transposed_product = Einsum("ij,kj->ki", a, Einsum("ij->ji", b));
+  ASSERT_EQ(product.Rank(), 2);
+  EXPECT_EQ(product.Dimension(0), m);
+  EXPECT_EQ(product.Dimension(1), n);
+  FOR(i, m)
+    FOR(j, n)
+    {
+      Real expected(Zero);
+      FOR(p, k) expected += a(i, p) * b(p, j);
+      EXPECT_NEAR(product(i, j), expected, 1e-13);
+      EXPECT_EQ(implicit_product(i, j), product(i, j));
+      EXPECT_NEAR(transposed_product(j, i), expected, 1e-13);
+    }
+
+  // Traces, diagonals and outer products.
+  DynamicTensor<Real> square(m, m);
+  Randomise(square);
+  const auto trace = Einsum("ii", square);
+  const auto diagonal = Einsum("ii->i", square);
+  const auto outer = Einsum("i,j->ij", Einsum("ii->i", square), Einsum("ij->i", a));
+  Real expected_trace(Zero);
+  FOR(i, m) expected_trace += square(i, i);
+  EXPECT_EQ(trace.Rank(), 0);
+  EXPECT_NEAR(trace(), expected_trace, 1e-13);
+  FOR(j, m)
+  {
+    EXPECT_EQ(diagonal(j), square(j, j));
+    Real row_sum(Zero);
+    FOR(p, k) row_sum += a(j, p);
+    FOR(i, m) EXPECT_NEAR(outer(i, j), square(i, i) * row_sum, 1e-13);
+  }
+
+  // Chains of products are contracted pairwise.
+  DynamicTensor<Real> c(n, 3);
+  Randomise(c);
+  const auto chain = Einsum("ij,jk,kl->il", a, b, c);
+  FOR(i, m)
+    FOR(l, 3)
+    {
+      Real expected(Zero);
+      FOR(j, n) expected += product(i, j) * c(j, l);
+      EXPECT_NEAR(chain(i, l), expected, 1e-12);
+    }
+
+  EXPECT_THROW(Einsum("ij,jk->ik", a, a), std::invalid_argument);
+  EXPECT_THROW(Einsum("ij,j1->ik", a, b), std::invalid_argument);
+  EXPECT_THROW(Einsum("ijk,jk->ik", a, b), std::invalid_argument);
+  EXPECT_THROW(Einsum("ij,jk->iz", a, b), std::invalid_argument);
+}
+
+TEST_F(TensorTest, HigherRankContractions)
+{
+  // Double contraction of a fourth-order (stiffness) tensor with a second-order (strain) tensor, and with itself.
+  StaticTensor<Real, 3, 3, 3, 3> stiffness;
+  StaticTensor<Real, 3, 3> strain;
+  Randomise(stiffness);
+  Randomise(strain);
+  const auto stress = Einsum("ijkl,kl->ij", stiffness, strain);
+  const auto mixed = Einsum("ijkl,jl->ik", stiffness, strain);
+  const auto squared = Einsum("ijkl,klmn->ijmn", stiffness, stiffness);
+  FOR(i, 3)
+    FOR(j, 3)
+    {
+      Real expected(Zero), expected_mixed(Zero);
+      FOR(k, 3)
+        FOR(l, 3)
+        {
+          expected += stiffness(i, j, k, l) * strain(k, l);
+          expected_mixed += stiffness(i, l, j, k) * strain(l, k);
+        }
+      EXPECT_NEAR(stress(i, j), expected, 1e-13);
+      EXPECT_NEAR(mixed(i, j), expected_mixed, 1e-13);
+
+      FOR(m, 3)
+        FOR(n, 3)
+        {
+          Real expected_squared(Zero);
+          FOR(k, 3) FOR(l, 3) expected_squared += stiffness(i, j, k, l) * stiffness(k, l, m, n);
+          EXPECT_NEAR(squared(i, j, m, n), expected_squared, 1e-13);
+        }
+    }
+
+  // Batched contractions, with the batch index in a different position in the output.
+  const size_t n_batches = 2000;
+  DynamicTensor<Real> a(n_batches, 3, 3), b(n_batches, 3, 3);
+  Randomise(a);
+  Randomise(b);
+  const auto batched = Einsum("bij,bjk->bik", a, b);
+  const auto moved = Einsum("bij,bjk->ikb", a, b);
+  FOR(batch, n_batches)
+    FOR(i, 3)
+      FOR(k, 3)
+      {
+        Real expected(Zero);
+        FOR(j, 3) expected += a(batch, i, j) * b(batch, j, k);
+        EXPECT_NEAR(batched(batch, i, k), expected, 1e-13);
+        EXPECT_EQ(moved(i, k, batch), batched(batch, i, k));
+      }
+}
+
+/***************************************************************************************************************************************************************
+* Tensor View Tests
+***************************************************************************************************************************************************************/
+TEST_F(TensorTest, Views)
+{
+  const size_t dim = 3, nx = 7, ny = 5;
+  DynamicTensor<Real> u(dim, nx, ny), v(dim, ny, nx), scalar(nx, ny);
+  Randomise(u);
+  Randomise(v);
+  Randomise(scalar);
+
+  // Permuted views and entry-wise expressions of views, evaluated on assignment.
+  const auto v_t = v.Permute({0, 2, 1});
+  ASSERT_EQ(v_t.Rank(), 3);
+  EXPECT_EQ(v_t.Dimension(1), nx);
+  EXPECT_EQ(v_t.Dimension(2), ny);
+
+  DynamicTensor<Real> sum = u + v_t;
+  DynamicTensor<Real> scaled(dim, nx, ny);
+  scaled = (u.View() + v_t) * scalar.Broadcast({dim, nx, ny});
+  ASSERT_EQ(sum.Rank(), 3);
+  FOR(i, 3)
+    FOR(x, nx)
+      FOR(y, ny)
+      {
+        EXPECT_EQ(v_t(i, x, y), v(i, y, x));
+        EXPECT_EQ(sum(i, x, y), u(i, x, y) + v(i, y, x));
+        EXPECT_EQ(scaled(i, x, y), (u(i, x, y) + v(i, y, x)) * scalar(x, y));
+      }
+
+  // Broadcasting of singleton dimensions, and transposes.
+  DynamicTensor<Real> column(3, 1);
+  Randomise(column);
+  const DynamicTensor<Real> outer_sum = column.Broadcast({3, 3}) + column.View().Transpose().Broadcast({3, 3});
+  ASSERT_EQ(outer_sum.Rank(), 2);
+  EXPECT_EQ(outer_sum.Dimension(1), 3);
+  FOR(i, 3) FOR(j, 3) EXPECT_EQ(outer_sum(i, j), column(i, 0) + column(j, 0));
+
+  // Rank-reducing slices, and assignment through views.
+  const auto component = u.Slice(0, 1);
+  ASSERT_EQ(component.Rank(), 2);
+  FOR(x, nx) FOR(y, ny) EXPECT_EQ(component(x, y), u(1, x, y));
+
+  u.Slice(0, 2) = scalar.View() * Real(2);
+  u.Slice(0, 0) = Zero;
+  v.Permute({0, 2, 1}) = u;
+  FOR(x, nx)
+    FOR(y, ny)
+    {
+      EXPECT_EQ(u(0, x, y), Zero);
+      EXPECT_EQ(u(2, x, y), Real(2) * scalar(x, y));
+      FOR(i, 3) EXPECT_EQ(v(i, y, x), u(i, x, y));
+    }
+
+  // Operands of the same size but different shapes, e.g. a tensor without its permutation, are rejected.
+  EXPECT_DEATH({ DynamicTensor<Real> mismatch = u + v; }, "");
+  EXPECT_DEATH(sum = u - v, "");
+  EXPECT_DEATH(v.View() = u, "");
+  EXPECT_DEATH(u.Slice(0, 1) = scalar.View().Transpose() * Real(2), "");
+
+  // Assignments of expressions and views that read the assigned entries in a different order, e.g. transposed self-assignment.
+  DynamicTensor<Real> t(3, 3);
+  const auto reset = [&t]() { FOR(i, 3) FOR(j, 3) t(i, j) = static_cast<Real>(10 * i + j); };
+  reset();
+  t = t + t.Permute({1, 0});
+  FOR(i, 3) FOR(j, 3) EXPECT_EQ(t(i, j), static_cast<Real>(11 * (i + j)));
+
+  reset();
+  t.View() = t.Permute({1, 0}) * Real(2);
+  FOR(i, 3) FOR(j, 3) EXPECT_EQ(t(i, j), static_cast<Real>(2 * (10 * j + i)));
+
+  reset();
+  t.View() = t.Permute({1, 0});
+  FOR(i, 3) FOR(j, 3) EXPECT_EQ(t(i, j), static_cast<Real>(10 * j + i));
+  t.Permute({1, 0}) = t;
+  FOR(i, 3) FOR(j, 3) EXPECT_EQ(t(i, j), static_cast<Real>(10 * i + j));
+
+  // Tensors constructed from, and assigned, views copy the viewed entries in the view's order.
+  reset();
+  const DynamicTensor<Real> t_transpose = t.Permute({1, 0});
+  const DynamicTensor<Real> broadcast = std::as_const(t).Slice(1, 2).Broadcast({2, 3});
+  ASSERT_EQ(broadcast.Rank(), 2);
+  EXPECT_EQ(broadcast.Dimension(0), 2);
+  FOR(i, 3)
+  {
+    FOR(j, 3) EXPECT_EQ(t_transpose(i, j), t(j, i));
+    FOR(k, 2) EXPECT_EQ(broadcast(k, i), t(i, 2));
+  }
+
+  t = t.Permute({1, 0});
+  FOR(i, 3) FOR(j, 3) EXPECT_EQ(t(i, j), static_cast<Real>(10 * j + i));
+  t = t_transpose.View().Transpose();
+  FOR(i, 3) FOR(j, 3) EXPECT_EQ(t(i, j), static_cast<Real>(10 * i + j));
+  EXPECT_DEATH(t = u.View(), "");
+
+  // Identical views of the same entries are assigned in-place.
+  t.View() = t.View() * Real(2);
+  FOR(i, 3) FOR(j, 3) EXPECT_EQ(t(i, j), static_cast<Real>(2 * (10 * i + j)));
+}
+
+}
+
+#endif